@@ -35,6 +35,34 @@ namespace DataFusionConstants
   const QString UniqueFeatures("UniqueFeatures");
   const QString Transformation("Transformation");
   const QString SimilarityCoefficient("SimilarityCoefficient");
+  const QString CorrespondingFeatures("CorrespondingFeatures");
+  const QString CorrespondenceGroups("CorrespondenceGroups");
+  const QString FeaturePairs("FeaturePairs");
+  const QString FeaturePairOffsets("FeaturePairOffsets");
+  const QString ReferenceIds("ReferenceIds");
+  const QString MovingIds("MovingIds");
+  const QString VoxelCounts("VoxelCounts");
+  const QString NewFeatures("NewFeatures");
+  const QString EndingFeatures("EndingFeatures");
+  const QString FeatureTracks("FeatureTracks");
+  const QString Tracks("Tracks");
+  const QString FirstStep("FirstStep");
+  const QString LastStep("LastStep");
+  const QString StepVolumes("StepVolumes");
+  const QString Reference("Reference");
+  const QString Moving("Moving");
+  const QString GroundTruthIds("GroundTruthIds");
+  const QString MergedIntoIds("MergedIntoIds");
+  const QString Inliers("Inliers");
+  const QString Residuals("Residuals");
+  const QString RmsResidual("RmsResidual");
+  const QString MedianResidual("MedianResidual");
+  const QString MaxResidual("MaxResidual");
+  const QString ConditionNumber("ConditionNumber");
+  const QString TransformationUncertainty("TransformationUncertainty");
+  const QString DisplacementField("DisplacementField");
+  const QString Displacements("Displacements");
+  const QString Descriptors("Descriptors");
 
   namespace FilterGroups
   {
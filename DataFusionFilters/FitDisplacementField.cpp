@@ -0,0 +1,589 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ *                                                                             *
+ * Copyright (c) 2015 William Lenthe                                           *
+ *                                                                             *
+ * This program is free software: you can redistribute it and/or modify        *
+ * it under the terms of the GNU Lesser General Public License as published by *
+ * the Free Software Foundation, either version 3 of the License, or           *
+ * (at your option) any later version.                                         *
+ *                                                                             *
+ * This program is distributed in the hope that it will be useful,             *
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of              *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the               *
+ * GNU Lesser General Public License for more details.                         *
+ *                                                                             *
+ * You should have received a copy of the GNU Lesser General Public License    *
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.       *
+ *                                                                             *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#include "FitDisplacementField.h"
+
+#include "SIMPLib/Common/Constants.h"
+#include "SIMPLib/FilterParameters/AbstractFilterParametersReader.h"
+#include "SIMPLib/FilterParameters/AbstractFilterParametersWriter.h"
+#include "SIMPLib/Geometry/ImageGeom.h"
+
+#include "SIMPLib/FilterParameters/DataArraySelectionFilterParameter.h"
+#include "SIMPLib/FilterParameters/DoubleFilterParameter.h"
+#include "SIMPLib/FilterParameters/FloatVec3FilterParameter.h"
+#include "SIMPLib/FilterParameters/LinkedBooleanFilterParameter.h"
+#include "SIMPLib/FilterParameters/StringFilterParameter.h"
+
+#ifdef SIMPLib_USE_PARALLEL_ALGORITHMS
+  #include <tbb/parallel_for.h>
+  #include <tbb/blocked_range.h>
+  #include <tbb/partitioner.h>
+  #include <tbb/task_scheduler_init.h>
+#endif
+
+#include "DataFusion/DataFusionConstants.h"
+#include "DataFusion/DataFusionFilters/util/KdTree.h"
+
+// Include the MOC generated file for this class
+#include "moc_FitDisplacementField.cpp"
+
+#include <algorithm>
+#include <cmath>
+
+#include <Eigen/Dense>
+#include <Eigen/Sparse>
+#include <Eigen/IterativeLinearSolvers>
+
+namespace Detail
+{
+// Wendland's C2 function of the distance relative to the support radius: compactly supported and positive definite in 3D
+inline double wendland(double r)
+{
+  if(r >= 1.0) return 0.0;
+  const double a = (1.0 - r) * (1.0 - r);
+  return a * a * (4.0 * r + 1.0);
+}
+
+// finds the nonzero entries of each column of the regularized kernel matrix (control points within the support radius), sorted by row
+class KernelColumns
+{
+  public:
+    KernelColumns(const KdTree<float>& tree, const std::vector<float>& points, float radius, double regularization, std::vector< std::vector< std::pair<int, double> > >& columns) :
+      m_Tree(tree),
+      m_Points(points),
+      m_Radius(radius),
+      m_Regularization(regularization),
+      m_Columns(columns)
+    {}
+
+    void find(size_t start, size_t end) const
+    {
+      std::vector< std::pair<float, size_t> > neighbors;
+      for(size_t i = start; i < end; i++)
+      {
+        m_Tree.radiusSearch(&m_Points[3 * i], m_Radius, neighbors);
+        std::vector< std::pair<int, double> >& column = m_Columns[i];
+        column.clear();
+        column.reserve(neighbors.size());
+        for(size_t j = 0; j < neighbors.size(); j++)
+        {
+          double value = wendland(std::sqrt(static_cast<double>(neighbors[j].first)) / m_Radius);
+          if(neighbors[j].second == i) value += m_Regularization;
+          column.push_back(std::make_pair(static_cast<int>(neighbors[j].second), value));
+        }
+        std::sort(column.begin(), column.end());
+      }
+    }
+
+#ifdef SIMPLib_USE_PARALLEL_ALGORITHMS
+    void operator()(const tbb::blocked_range<size_t>& r) const
+    {
+      find(r.begin(), r.end());
+    }
+#endif
+
+  private:
+    const KdTree<float>& m_Tree;
+    const std::vector<float>& m_Points;
+    float m_Radius;
+    double m_Regularization;
+    std::vector< std::vector< std::pair<int, double> > >& m_Columns;
+};
+
+// evaluates the fitted field (sum of kernel coefficients of control points within the support radius) at the cell centers of each row of the grid
+class FieldEvaluator
+{
+  public:
+    FieldEvaluator(const KdTree<float>& tree, const Eigen::MatrixXd& coefficients, float radius, const size_t dims[3], const float origin[3], const float spacing[3], float* displacements) :
+      m_Tree(tree),
+      m_Coefficients(coefficients),
+      m_Radius(radius),
+      m_Displacements(displacements)
+    {
+      std::copy(dims, dims + 3, m_Dims);
+      std::copy(origin, origin + 3, m_Origin);
+      std::copy(spacing, spacing + 3, m_Spacing);
+    }
+
+    void evaluate(size_t start, size_t end) const
+    {
+      std::vector< std::pair<float, size_t> > neighbors;
+      for(size_t row = start; row < end; row++)
+      {
+        float position[3];
+        position[1] = m_Origin[1] + (static_cast<float>(row % m_Dims[1]) + 0.5f) * m_Spacing[1];
+        position[2] = m_Origin[2] + (static_cast<float>(row / m_Dims[1]) + 0.5f) * m_Spacing[2];
+        for(size_t x = 0; x < m_Dims[0]; x++)
+        {
+          position[0] = m_Origin[0] + (static_cast<float>(x) + 0.5f) * m_Spacing[0];
+          m_Tree.radiusSearch(position, m_Radius, neighbors);
+          double displacement[3] = {0.0, 0.0, 0.0};
+          for(size_t j = 0; j < neighbors.size(); j++)
+          {
+            const double w = wendland(std::sqrt(static_cast<double>(neighbors[j].first)) / m_Radius);
+            for(size_t k = 0; k < 3; k++)
+              displacement[k] += w * m_Coefficients(neighbors[j].second, k);
+          }
+          float* d = m_Displacements + 3 * (row * m_Dims[0] + x);
+          for(size_t k = 0; k < 3; k++)
+            d[k] = static_cast<float>(displacement[k]);
+        }
+      }
+    }
+
+#ifdef SIMPLib_USE_PARALLEL_ALGORITHMS
+    void operator()(const tbb::blocked_range<size_t>& r) const
+    {
+      evaluate(r.begin(), r.end());
+    }
+#endif
+
+  private:
+    const KdTree<float>& m_Tree;
+    const Eigen::MatrixXd& m_Coefficients;
+    float m_Radius;
+    size_t m_Dims[3];
+    float m_Origin[3];
+    float m_Spacing[3];
+    float* m_Displacements;
+};
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+FitDisplacementField::FitDisplacementField() :
+  AbstractFilter(),
+  m_ReferenceCentroidsArrayPath(DREAM3D::Defaults::VolumeDataContainerName, DREAM3D::Defaults::CellFeatureAttributeMatrixName, DREAM3D::FeatureData::Centroids),
+  m_MovingCentroidsArrayPath(DREAM3D::Defaults::VolumeDataContainerName, DREAM3D::Defaults::CellFeatureAttributeMatrixName, DREAM3D::FeatureData::Centroids),
+  m_ReferenceGoodFeaturesArrayPath(DREAM3D::Defaults::VolumeDataContainerName, DREAM3D::Defaults::CellFeatureAttributeMatrixName, DREAM3D::FeatureData::GoodFeatures),
+  m_MovingGoodFeaturesArrayPath(DREAM3D::Defaults::VolumeDataContainerName, DREAM3D::Defaults::CellFeatureAttributeMatrixName, DREAM3D::FeatureData::GoodFeatures),
+  m_TransformationArrayPath(DREAM3D::Defaults::VolumeDataContainerName, DataFusionConstants::Transformation, DataFusionConstants::Transformation),
+  m_UseGoodPoints(true),
+  m_UseTransformation(true),
+  m_SupportRadius(50.0),
+  m_Regularization(0.01),
+  m_DataContainerName(DataFusionConstants::DisplacementField),
+  m_CellAttributeMatrixName(DREAM3D::Defaults::CellAttributeMatrixName),
+  m_DisplacementsArrayName(DataFusionConstants::Displacements),
+  m_ReferenceCentroids(NULL),
+  m_MovingCentroids(NULL),
+  m_ReferenceGoodFeatures(NULL),
+  m_MovingGoodFeatures(NULL),
+  m_Transformation(NULL),
+  m_Displacements(NULL)
+{
+  m_GridSpacing.x = 10.0f;
+  m_GridSpacing.y = 10.0f;
+  m_GridSpacing.z = 10.0f;
+
+  setupFilterParameters();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+FitDisplacementField::~FitDisplacementField()
+{
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void FitDisplacementField::setupFilterParameters()
+{
+  FilterParameterVector parameters;
+
+  parameters.push_back(DoubleFilterParameter::New("Support Radius", "SupportRadius", getSupportRadius(), FilterParameter::Parameter));
+  parameters.push_back(DoubleFilterParameter::New("Regularization", "Regularization", getRegularization(), FilterParameter::Parameter));
+  parameters.push_back(FloatVec3FilterParameter::New("Grid Spacing", "GridSpacing", getGridSpacing(), FilterParameter::Parameter));
+  {
+    QStringList linkedProps;
+    linkedProps << "TransformationArrayPath";
+    parameters.push_back(LinkedBooleanFilterParameter::New("Fit Residual of Transformation", "UseTransformation", getUseTransformation(), linkedProps, FilterParameter::Parameter));
+  }
+  {
+    QStringList linkedProps;
+    linkedProps << "ReferenceGoodFeaturesArrayPath" << "MovingGoodFeaturesArrayPath";
+    parameters.push_back(LinkedBooleanFilterParameter::New("Use Good Points Arrays", "UseGoodPoints", getUseGoodPoints(), linkedProps, FilterParameter::Parameter));
+  }
+
+  //required arrays
+  DataArraySelectionFilterParameter::RequirementType req;
+  parameters.push_back(DataArraySelectionFilterParameter::New("Reference Points", "ReferenceCentroidsArrayPath", getReferenceCentroidsArrayPath(), FilterParameter::RequiredArray, req));
+  parameters.push_back(DataArraySelectionFilterParameter::New("Moving Points", "MovingCentroidsArrayPath", getMovingCentroidsArrayPath(), FilterParameter::RequiredArray, req));
+  parameters.push_back(DataArraySelectionFilterParameter::New("Reference Good Points", "ReferenceGoodFeaturesArrayPath", getReferenceGoodFeaturesArrayPath(), FilterParameter::RequiredArray, req));
+  parameters.push_back(DataArraySelectionFilterParameter::New("Moving Good Points", "MovingGoodFeaturesArrayPath", getMovingGoodFeaturesArrayPath(), FilterParameter::RequiredArray, req));
+  parameters.push_back(DataArraySelectionFilterParameter::New("Transformation", "TransformationArrayPath", getTransformationArrayPath(), FilterParameter::RequiredArray, req));
+
+  //created arrays
+  parameters.push_back(StringFilterParameter::New("Displacement Data Container", "DataContainerName", getDataContainerName(), FilterParameter::CreatedArray));
+  parameters.push_back(StringFilterParameter::New("Cell Attribute Matrix", "CellAttributeMatrixName", getCellAttributeMatrixName(), FilterParameter::CreatedArray));
+  parameters.push_back(StringFilterParameter::New("Displacements", "DisplacementsArrayName", getDisplacementsArrayName(), FilterParameter::CreatedArray));
+
+  setFilterParameters(parameters);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void FitDisplacementField::readFilterParameters(AbstractFilterParametersReader* reader, int index)
+{
+  reader->openFilterGroup(this, index);
+  setSupportRadius( reader->readValue("SupportRadius", getSupportRadius()));
+  setRegularization( reader->readValue("Regularization", getRegularization()));
+  setGridSpacing( reader->readFloatVec3("GridSpacing", getGridSpacing()));
+  setUseTransformation( reader->readValue("UseTransformation", getUseTransformation()));
+  setTransformationArrayPath( reader->readDataArrayPath( "TransformationArrayPath", getTransformationArrayPath() ) );
+  setReferenceCentroidsArrayPath( reader->readDataArrayPath( "ReferenceCentroidsArrayPath", getReferenceCentroidsArrayPath() ) );
+  setMovingCentroidsArrayPath( reader->readDataArrayPath( "MovingCentroidsArrayPath", getMovingCentroidsArrayPath() ) );
+  setUseGoodPoints( reader->readValue("UseGoodPoints", getUseGoodPoints()));
+  setReferenceGoodFeaturesArrayPath( reader->readDataArrayPath( "ReferenceGoodFeaturesArrayPath", getReferenceGoodFeaturesArrayPath() ) );
+  setMovingGoodFeaturesArrayPath( reader->readDataArrayPath( "MovingGoodFeaturesArrayPath", getMovingGoodFeaturesArrayPath() ) );
+  setDataContainerName( reader->readString( "DataContainerName", getDataContainerName() ) );
+  setCellAttributeMatrixName( reader->readString( "CellAttributeMatrixName", getCellAttributeMatrixName() ) );
+  setDisplacementsArrayName( reader->readString( "DisplacementsArrayName", getDisplacementsArrayName() ) );
+  reader->closeFilterGroup();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int FitDisplacementField::writeFilterParameters(AbstractFilterParametersWriter* writer, int index)
+{
+  writer->openFilterGroup(this, index);
+  SIMPL_FILTER_WRITE_PARAMETER(FilterVersion)
+  SIMPL_FILTER_WRITE_PARAMETER(SupportRadius)
+  SIMPL_FILTER_WRITE_PARAMETER(Regularization)
+  SIMPL_FILTER_WRITE_PARAMETER(GridSpacing)
+  SIMPL_FILTER_WRITE_PARAMETER(UseTransformation)
+  SIMPL_FILTER_WRITE_PARAMETER(TransformationArrayPath)
+  SIMPL_FILTER_WRITE_PARAMETER(ReferenceCentroidsArrayPath)
+  SIMPL_FILTER_WRITE_PARAMETER(MovingCentroidsArrayPath)
+  SIMPL_FILTER_WRITE_PARAMETER(UseGoodPoints)
+  SIMPL_FILTER_WRITE_PARAMETER(ReferenceGoodFeaturesArrayPath)
+  SIMPL_FILTER_WRITE_PARAMETER(MovingGoodFeaturesArrayPath)
+  SIMPL_FILTER_WRITE_PARAMETER(DataContainerName)
+  SIMPL_FILTER_WRITE_PARAMETER(CellAttributeMatrixName)
+  SIMPL_FILTER_WRITE_PARAMETER(DisplacementsArrayName)
+  writer->closeFilterGroup();
+  return ++index; // we want to return the next index that was just written to
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void FitDisplacementField::dataCheck()
+{
+  setErrorCondition(0);
+
+  if(getSupportRadius() <= 0.0)
+  {
+    setErrorCondition(-1000);
+    notifyErrorMessage(getHumanLabel(), "Support Radius must be positive", getErrorCondition());
+    return;
+  }
+
+  if(getRegularization() < 0.0)
+  {
+    setErrorCondition(-1001);
+    notifyErrorMessage(getHumanLabel(), "Regularization must be non negative", getErrorCondition());
+    return;
+  }
+
+  if(getGridSpacing().x <= 0.0f || getGridSpacing().y <= 0.0f || getGridSpacing().z <= 0.0f)
+  {
+    setErrorCondition(-1002);
+    notifyErrorMessage(getHumanLabel(), "Grid Spacing must be positive", getErrorCondition());
+    return;
+  }
+
+  //required arrays
+  QVector<size_t> dims(1, 3);
+  QVector<DataArrayPath> referenceDataArrayPaths, movingDataArrayPaths;
+
+  m_ReferenceCentroidsPtr = getDataContainerArray()->getPrereqArrayFromPath<DataArray<float>, AbstractFilter>(this, getReferenceCentroidsArrayPath(), dims);
+  if( NULL != m_ReferenceCentroidsPtr.lock().get() ) m_ReferenceCentroids = m_ReferenceCentroidsPtr.lock()->getPointer(0);
+  if(getErrorCondition() >= 0) referenceDataArrayPaths.push_back(getReferenceCentroidsArrayPath());
+
+  m_MovingCentroidsPtr = getDataContainerArray()->getPrereqArrayFromPath<DataArray<float>, AbstractFilter>(this, getMovingCentroidsArrayPath(), dims);
+  if( NULL != m_MovingCentroidsPtr.lock().get() ) m_MovingCentroids = m_MovingCentroidsPtr.lock()->getPointer(0);
+  if(getErrorCondition() >= 0) movingDataArrayPaths.push_back(getMovingCentroidsArrayPath());
+
+  //centroids must belong to imagegeometery
+  if(getErrorCondition() < 0) return;
+  if(DREAM3D::GeometryType::ImageGeometry != getDataContainerArray()->getDataContainer(getReferenceCentroidsArrayPath().getDataContainerName())->getGeometry()->getGeometryType())
+    notifyErrorMessage(getHumanLabel(), "Rectilinear grid geometry required for Reference Atrribute Matrix.", -390);
+
+  if(DREAM3D::GeometryType::ImageGeometry != getDataContainerArray()->getDataContainer(getMovingCentroidsArrayPath().getDataContainerName())->getGeometry()->getGeometryType())
+    notifyErrorMessage(getHumanLabel(), "Rectilinear grid geometry required for Moving Atrribute Matrix.", -390);
+
+  dims[0] = 1;
+  if(getUseGoodPoints())
+  {
+    m_ReferenceGoodFeaturesPtr = getDataContainerArray()->getPrereqArrayFromPath<DataArray<bool>, AbstractFilter>(this, getReferenceGoodFeaturesArrayPath(), dims);
+    if(getErrorCondition() >= 0) referenceDataArrayPaths.push_back(getReferenceGoodFeaturesArrayPath());
+    if( NULL != m_ReferenceGoodFeaturesPtr.lock().get() ) m_ReferenceGoodFeatures = m_ReferenceGoodFeaturesPtr.lock()->getPointer(0);
+
+    m_MovingGoodFeaturesPtr = getDataContainerArray()->getPrereqArrayFromPath<DataArray<bool>, AbstractFilter>(this, getMovingGoodFeaturesArrayPath(), dims);
+    if(getErrorCondition() >= 0) movingDataArrayPaths.push_back(getMovingGoodFeaturesArrayPath());
+    if( NULL != m_MovingGoodFeaturesPtr.lock().get() ) m_MovingGoodFeatures = m_MovingGoodFeaturesPtr.lock()->getPointer(0);
+  }
+
+  if(getUseTransformation())
+  {
+    QVector<size_t> transDims(2, 4);//4x4 array
+    m_TransformationPtr = getDataContainerArray()->getPrereqArrayFromPath<DataArray<float>, AbstractFilter>(this, getTransformationArrayPath(), transDims);
+    if( NULL != m_TransformationPtr.lock().get() ) m_Transformation = m_TransformationPtr.lock()->getPointer(0);
+  }
+
+  getDataContainerArray()->validateNumberOfTuples<AbstractFilter>(this, referenceDataArrayPaths);
+  getDataContainerArray()->validateNumberOfTuples<AbstractFilter>(this, movingDataArrayPaths);
+  if(getErrorCondition() < 0) return;
+
+  //the displacement grid covers the reference volume
+  ImageGeom::Pointer refGeom = getDataContainerArray()->getDataContainer(getReferenceCentroidsArrayPath().getDataContainerName())->getGeometryAs<ImageGeom>();
+  size_t refDims[3] = {0, 0, 0};
+  float refRes[3] = {0.0f, 0.0f, 0.0f};
+  float origin[3] = {0.0f, 0.0f, 0.0f};
+  refGeom->getDimensions(refDims);
+  refGeom->getResolution(refRes);
+  refGeom->getOrigin(origin);
+
+  float spacing[3] = {getGridSpacing().x, getGridSpacing().y, getGridSpacing().z};
+  size_t gridDims[3];
+  for(size_t i = 0; i < 3; i++)
+    gridDims[i] = std::max<size_t>(1, static_cast<size_t>(std::ceil(refDims[i] * refRes[i] / spacing[i])));
+
+  DataContainer::Pointer m = getDataContainerArray()->createNonPrereqDataContainer<AbstractFilter>(this, getDataContainerName());
+  if(getErrorCondition() < 0) return;
+  ImageGeom::Pointer image = ImageGeom::CreateGeometry(DREAM3D::Geometry::ImageGeometry);
+  image->setDimensions(gridDims);
+  image->setResolution(spacing);
+  image->setOrigin(origin);
+  m->setGeometry(image);
+
+  QVector<size_t> tDims(3, 0);
+  tDims[0] = gridDims[0];
+  tDims[1] = gridDims[1];
+  tDims[2] = gridDims[2];
+  m->createNonPrereqAttributeMatrix<AbstractFilter>(this, getCellAttributeMatrixName(), tDims, DREAM3D::AttributeMatrixType::Cell);
+  if(getErrorCondition() < 0) return;
+
+  dims[0] = 3;
+  DataArrayPath tempPath(getDataContainerName(), getCellAttributeMatrixName(), getDisplacementsArrayName());
+  m_DisplacementsPtr = getDataContainerArray()->createNonPrereqArrayFromPath<DataArray<float>, AbstractFilter, float>(this, tempPath, 0, dims);
+  if( NULL != m_DisplacementsPtr.lock().get() ) m_Displacements = m_DisplacementsPtr.lock()->getPointer(0);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void FitDisplacementField::preflight()
+{
+  // These are the REQUIRED lines of CODE to make sure the filter behaves correctly
+  setInPreflight(true); // Set the fact that we are preflighting.
+  emit preflightAboutToExecute(); // Emit this signal so that other widgets can do one file update
+  emit updateFilterParameters(this); // Emit this signal to have the widgets push their values down to the filter
+  dataCheck(); // Run our DataCheck to make sure everthing is setup correctly
+  emit preflightExecuted(); // We are done preflighting this filter
+  setInPreflight(false); // Inform the system this filter is NOT in preflight mode anymore.
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void FitDisplacementField::execute()
+{
+  setErrorCondition(0);
+  dataCheck();
+  if(getErrorCondition() < 0) { return; }
+
+  if (getCancel() == true) { return; }
+
+#ifdef SIMPLib_USE_PARALLEL_ALGORITHMS
+  tbb::task_scheduler_init init;
+  bool doParallel = true;
+#endif
+
+  //centroids are relative to the origin of their volume
+  float refOrigin[3] = {0.0f, 0.0f, 0.0f};
+  float movOrigin[3] = {0.0f, 0.0f, 0.0f};
+  getDataContainerArray()->getDataContainer(getReferenceCentroidsArrayPath().getDataContainerName())->getGeometryAs<ImageGeom>()->getOrigin(refOrigin);
+  getDataContainerArray()->getDataContainer(getMovingCentroidsArrayPath().getDataContainerName())->getGeometryAs<ImageGeom>()->getOrigin(movOrigin);
+
+  //moving -> reference transformation (identity unless the residual of a transformation is being fit)
+  Eigen::Matrix3d transformation = Eigen::Matrix3d::Identity();
+  Eigen::Vector3d translation = Eigen::Vector3d::Zero();
+  if(getUseTransformation())
+  {
+    for(size_t i = 0; i < 3; i++)
+    {
+      for(size_t j = 0; j < 3; j++)
+        transformation(i, j) = m_Transformation[4 * i + j];
+      translation(i) = m_Transformation[4 * i + 3];
+    }
+  }
+
+  //control points are the absolute reference positions of the good pairs, displacements take the transformed moving point to its reference point
+  size_t numFeatures = std::min(m_ReferenceCentroidsPtr.lock()->getNumberOfTuples(), m_MovingCentroidsPtr.lock()->getNumberOfTuples());
+  std::vector<float> points;
+  std::vector<Eigen::Vector3d> targets;
+  points.reserve(3 * numFeatures);
+  targets.reserve(numFeatures);
+  for(size_t i = 0; i < numFeatures; i++)
+  {
+    if(getUseGoodPoints())
+    {
+      if( !(m_ReferenceGoodFeatures[i] && m_MovingGoodFeatures[i]) )
+        continue;
+    }
+    Eigen::Vector3d reference, moving;
+    for(size_t j = 0; j < 3; j++)
+    {
+      reference(j) = static_cast<double>(m_ReferenceCentroids[3 * i + j]) + refOrigin[j];
+      moving(j) = static_cast<double>(m_MovingCentroids[3 * i + j]) + movOrigin[j];
+      points.push_back(static_cast<float>(reference(j)));
+    }
+    targets.push_back(reference - (transformation * moving + translation));
+  }
+  const size_t numPoints = targets.size();
+
+  //with no control points the field is zero everywhere
+  if(0 == numPoints)
+  {
+    notifyWarningMessage(getHumanLabel(), "No control points, the displacement field is zero", 1);
+    notifyStatusMessage(getHumanLabel(), "Complete");
+    return;
+  }
+
+  //assemble the sparse regularized kernel matrix, each control point only interacts with the control points within the support radius
+  notifyStatusMessage(getHumanLabel(), "Assembling kernel matrix");
+  const float radius = static_cast<float>(getSupportRadius());
+  KdTree<float> tree(&points[0], numPoints, 3);
+  std::vector< std::vector< std::pair<int, double> > > columns(numPoints);
+  Detail::KernelColumns columnFinder(tree, points, radius, getRegularization(), columns);
+#ifdef SIMPLib_USE_PARALLEL_ALGORITHMS
+  if(doParallel == true)
+  {
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, numPoints), columnFinder, tbb::auto_partitioner());
+  }
+  else
+#endif
+  {
+    columnFinder.find(0, numPoints);
+  }
+
+  Eigen::VectorXi columnSizes(numPoints);
+  for(size_t j = 0; j < numPoints; j++)
+    columnSizes(j) = static_cast<int>(columns[j].size());
+  Eigen::SparseMatrix<double> kernel(numPoints, numPoints);
+  kernel.reserve(columnSizes);
+  for(size_t j = 0; j < numPoints; j++)
+  {
+    for(size_t k = 0; k < columns[j].size(); k++)
+      kernel.insert(columns[j][k].first, j) = columns[j][k].second;
+    std::vector< std::pair<int, double> >().swap(columns[j]);
+  }
+  kernel.makeCompressed();
+
+  QString ss = QObject::tr("Solving for %1 control points (%2 kernel entries)").arg(numPoints).arg(kernel.nonZeros());
+  notifyStatusMessage(getHumanLabel(), ss);
+  if (getCancel() == true) { return; }
+
+  //the matrix is symmetric positive definite: conjugate gradients only need matrix vector products and, unlike a sparse cholesky factorization, don't fill in
+  Eigen::MatrixXd rightHandSide(numPoints, 3);
+  for(size_t i = 0; i < numPoints; i++)
+    rightHandSide.row(i) = targets[i].transpose();
+  Eigen::ConjugateGradient<Eigen::SparseMatrix<double>, Eigen::Lower | Eigen::Upper> solver;
+  solver.setTolerance(1e-6);
+  solver.compute(kernel);
+  Eigen::MatrixXd coefficients = solver.solve(rightHandSide);
+  if(Eigen::Success != solver.info())
+  {
+    ss = QObject::tr("Solution did not converge after %1 iterations (relative error %2), increase the regularization").arg(solver.iterations()).arg(solver.error());
+    notifyWarningMessage(getHumanLabel(), ss, 1);
+  }
+  if (getCancel() == true) { return; }
+
+  //the fitted displacement at each control point differs from its target by regularization * coefficient
+  const double rmsResidual = getRegularization() * std::sqrt(coefficients.squaredNorm() / numPoints);
+  ss = QObject::tr("Fit %1 control points, rms residual %2").arg(numPoints).arg(rmsResidual);
+  notifyStatusMessage(getHumanLabel(), ss);
+
+  //evaluate the field at the cell centers of the grid
+  notifyStatusMessage(getHumanLabel(), "Evaluating displacement field");
+  ImageGeom::Pointer grid = getDataContainerArray()->getDataContainer(getDataContainerName())->getGeometryAs<ImageGeom>();
+  size_t gridDims[3] = {0, 0, 0};
+  float gridOrigin[3] = {0.0f, 0.0f, 0.0f};
+  float gridSpacing[3] = {0.0f, 0.0f, 0.0f};
+  grid->getDimensions(gridDims);
+  grid->getOrigin(gridOrigin);
+  grid->getResolution(gridSpacing);
+  Detail::FieldEvaluator evaluator(tree, coefficients, radius, gridDims, gridOrigin, gridSpacing, m_Displacements);
+#ifdef SIMPLib_USE_PARALLEL_ALGORITHMS
+  if(doParallel == true)
+  {
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, gridDims[1] * gridDims[2]), evaluator, tbb::auto_partitioner());
+  }
+  else
+#endif
+  {
+    evaluator.evaluate(0, gridDims[1] * gridDims[2]);
+  }
+
+  notifyStatusMessage(getHumanLabel(), "Complete");
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+AbstractFilter::Pointer FitDisplacementField::newFilterInstance(bool copyFilterParameters)
+{
+  FitDisplacementField::Pointer filter = FitDisplacementField::New();
+  if(true == copyFilterParameters)
+  {
+    copyFilterParameterInstanceVariables(filter.get());
+  }
+  return filter;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+const QString FitDisplacementField::getCompiledLibraryName()
+{ return DataFusionConstants::DataFusionBaseName; }
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+const QString FitDisplacementField::getGroupName()
+{ return DREAM3D::FilterGroups::Unsupported; }
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+const QString FitDisplacementField::getHumanLabel()
+{ return "Fit Displacement Field"; }
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+const QString FitDisplacementField::getSubGroupName()
+{ return DataFusionConstants::FilterGroups::DataFusionFilters; }
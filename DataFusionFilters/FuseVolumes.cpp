@@ -28,6 +28,7 @@
 #include "SIMPLib/FilterParameters/LinkedChoicesFilterParameter.h"
 #include "SIMPLib/FilterParameters/DataArraySelectionFilterParameter.h"
 #include "SIMPLib/FilterParameters/DynamicTableFilterParameter.h"
+#include "SIMPLib/FilterParameters/LinkedBooleanFilterParameter.h"
 
 #ifdef SIMPLib_USE_PARALLEL_ALGORITHMS
   #include <tbb/parallel_for.h>
@@ -39,6 +40,7 @@
 #include <Eigen/Dense>
 
 #include "DataFusion/DataFusionConstants.h"
+#include "DataFusion/DataFusionFilters/util/DisplacementGrid.h"
 
 // Include the MOC generated file for this class
 #include "moc_FuseVolumes.cpp"
@@ -53,7 +55,7 @@ class FuseVolumesImpl
 {
 
   public:
-    FuseVolumesImpl(DimType* movingDims, DimType* referenceDims, float* movingOrign, float* referenceOrign, float* movingSpacing, float* referenceSpacing, Eigen::Matrix3f transform, Eigen::Vector3f translation, AttributeMatrix::Pointer movingAttMatt, AttributeMatrix::Pointer fixedAttMatt, QString prefix, int64_t* newIndicies) :
+    FuseVolumesImpl(DimType* movingDims, DimType* referenceDims, float* movingOrign, float* referenceOrign, float* movingSpacing, float* referenceSpacing, Eigen::Matrix3f transform, Eigen::Vector3f translation, AttributeMatrix::Pointer movingAttMatt, AttributeMatrix::Pointer fixedAttMatt, QString prefix, int64_t* newIndicies, const DisplacementGrid* displacementGrid = NULL) :
     m_movingDims(movingDims),
     m_movingOrigin(movingOrign),
     m_movingResolution(movingSpacing),
@@ -65,7 +67,8 @@ class FuseVolumesImpl
     m_Prefix(prefix),
     m_movingAtrMatPtr(movingAttMatt),
     m_referenceAtrMatPtr(fixedAttMatt),
-    m_newIndicies(newIndicies)
+    m_newIndicies(newIndicies),
+    m_DisplacementGrid(displacementGrid)
     {}
     virtual ~FuseVolumesImpl() {}
 
@@ -85,6 +88,14 @@ class FuseVolumesImpl
             Eigen::Vector3f referencePosition;
             referencePosition<< i * m_referenceResolution[0] + m_referenceOrigin[0], j * m_referenceResolution[1] + m_referenceOrigin[1], k * m_referenceResolution[2] + m_referenceOrigin[2];
 
+            //remove the non-rigid displacement (moving -> reference) before undoing the affine part
+            if(NULL != m_DisplacementGrid)
+            {
+              Eigen::Vector3f displacement;
+              m_DisplacementGrid->interpolate(referencePosition.data(), displacement.data());
+              referencePosition -= displacement;
+            }
+
             //reference position -> moving position
             Eigen::Vector3f movingPosition = m_Transfomration * referencePosition + m_Translation;
 
@@ -130,6 +141,7 @@ class FuseVolumesImpl
     AttributeMatrix::Pointer m_movingAtrMatPtr;
     AttributeMatrix::Pointer m_referenceAtrMatPtr;
     int64_t* m_newIndicies;
+    const DisplacementGrid* m_DisplacementGrid;
 
 };
 
@@ -140,9 +152,13 @@ FuseVolumes::FuseVolumes() :
   AbstractFilter(),
   m_Prefix("fused_"),
   m_TransformationType(0),
+  m_UseDisplacementField(false),
   m_ReferenceVolume(DREAM3D::Defaults::VolumeDataContainerName, DREAM3D::Defaults::CellAttributeMatrixName, ""),
   m_MovingVolume(DREAM3D::Defaults::VolumeDataContainerName, DREAM3D::Defaults::CellAttributeMatrixName, ""),
-  m_TransformationArrayPath(DREAM3D::Defaults::VolumeDataContainerName, DataFusionConstants::Transformation, DataFusionConstants::Transformation)
+  m_TransformationArrayPath(DREAM3D::Defaults::VolumeDataContainerName, DataFusionConstants::Transformation, DataFusionConstants::Transformation),
+  m_DisplacementFieldArrayPath(DataFusionConstants::DisplacementField, DREAM3D::Defaults::CellAttributeMatrixName, DataFusionConstants::Displacements),
+  m_Transformation(NULL),
+  m_DisplacementField(NULL)
 {
   std::vector<std::vector <double> > identity(3, std::vector<double>(4, 0));
   for(size_t i = 0; i < 3; i++) identity[i][i] = 1;
@@ -193,6 +209,13 @@ void FuseVolumes::setupFilterParameters()
   parameters.push_back(DynamicTableFilterParameter::New("Transformation", "ManualTransformation", headers, headers, getManualTransformation().getTableData(), FilterParameter::Parameter, false, false, 3, 4));
   parameters.back()->setGroupIndex(1);
 
+  {
+    QStringList linkedProps;
+    linkedProps << "DisplacementFieldArrayPath";
+    parameters.push_back(LinkedBooleanFilterParameter::New("Apply Displacement Field", "UseDisplacementField", getUseDisplacementField(), linkedProps, FilterParameter::Parameter));
+  }
+  parameters.push_back(DataArraySelectionFilterParameter::New("Displacement Field", "DisplacementFieldArrayPath", getDisplacementFieldArrayPath(), FilterParameter::RequiredArray, req));
+
   setFilterParameters(parameters);
 }
 
@@ -208,6 +231,8 @@ void FuseVolumes::readFilterParameters(AbstractFilterParametersReader* reader, i
   setTransformationType( reader->readValue("TransformationType", getTransformationType()) );
   setTransformationArrayPath( reader->readDataArrayPath( "TransformationArrayPath", getTransformationArrayPath() ) );
   setManualTransformation(reader->readDynamicTableData("ManualTransformation", getManualTransformation()));
+  setUseDisplacementField( reader->readValue("UseDisplacementField", getUseDisplacementField()) );
+  setDisplacementFieldArrayPath( reader->readDataArrayPath( "DisplacementFieldArrayPath", getDisplacementFieldArrayPath() ) );
   reader->closeFilterGroup();
 }
 
@@ -224,6 +249,8 @@ int FuseVolumes::writeFilterParameters(AbstractFilterParametersWriter* writer, i
   SIMPL_FILTER_WRITE_PARAMETER(TransformationType)
   SIMPL_FILTER_WRITE_PARAMETER(TransformationArrayPath)
   SIMPL_FILTER_WRITE_PARAMETER(ManualTransformation)
+  SIMPL_FILTER_WRITE_PARAMETER(UseDisplacementField)
+  SIMPL_FILTER_WRITE_PARAMETER(DisplacementFieldArrayPath)
   writer->closeFilterGroup();
   return ++index; // we want to return the next index that was just written to
 }
@@ -261,6 +288,21 @@ void FuseVolumes::dataCheck()
       { m_Transformation = m_TransformationPtr.lock()->getPointer(0); }
   }
 
+  //get displacement field (sampled on its own image geometry) if needed
+  if(getUseDisplacementField())
+  {
+    m_DisplacementFieldPtr = getDataContainerArray()->getPrereqArrayFromPath<DataArray<float>, AbstractFilter>(this, getDisplacementFieldArrayPath(), QVector<size_t>(1, 3));
+    if( NULL != m_DisplacementFieldPtr.lock().get() )
+    { m_DisplacementField = m_DisplacementFieldPtr.lock()->getPointer(0); }
+    if(getErrorCondition() < 0) { return; }
+    if(DREAM3D::GeometryType::ImageGeometry != getDataContainerArray()->getDataContainer(getDisplacementFieldArrayPath().getDataContainerName())->getGeometry()->getGeometryType())
+    {
+      setErrorCondition(-1004);
+      notifyErrorMessage(getHumanLabel(), "Rectilinear grid geometry required for Displacement Field.", getErrorCondition());
+      return;
+    }
+  }
+
   //loop over attribute arrays of moving, copying to source
   QList<QString> movingArrays = moveCellAttrMat->getAttributeArrayNames();
   size_t numTuples = refCellAttrMat->getNumTuples();
@@ -439,25 +481,41 @@ void FuseVolumes::execute()
   newIndiciesPtr->initializeWithValue(-1);
   int64_t* newindicies = newIndiciesPtr->getPointer(0);
 
+  //non-rigid displacement field (reference -> moving positions are found by subtracting the interpolated displacement first)
+  size_t fieldDims[3] = {1, 1, 1};
+  float fieldOrigin[3] = {0.0f, 0.0f, 0.0f};
+  float fieldSpacing[3] = {1.0f, 1.0f, 1.0f};
+  if(getUseDisplacementField())
+  {
+    ImageGeom::Pointer fieldGeom = getDataContainerArray()->getDataContainer(getDisplacementFieldArrayPath().getDataContainerName())->getGeometryAs<ImageGeom>();
+    fieldGeom->getDimensions(fieldDims);
+    fieldGeom->getOrigin(fieldOrigin);
+    fieldGeom->getResolution(fieldSpacing);
+  }
+  DisplacementGrid displacementGrid(m_DisplacementField, fieldDims, fieldOrigin, fieldSpacing);
+  const DisplacementGrid* displacements = getUseDisplacementField() ? &displacementGrid : NULL;
+
 #ifdef SIMPLib_USE_PARALLEL_ALGORITHMS
   tbb::task_scheduler_init init;
   bool doParallel = true;
 #endif
 
+  notifyStatusMessage(getHumanLabel(), "Mapping reference voxels to moving voxels");
 #ifdef SIMPLib_USE_PARALLEL_ALGORITHMS
   if (doParallel == true)
   {
     tbb::parallel_for(tbb::blocked_range3d<size_t, size_t, size_t>(0, refDims[2]-1, 0, refDims[1]-1, 0, refDims[0]-1),
-                      FuseVolumesImpl(movDims, refDims, movingOrigin, refOrigin, movingRes, refRes, transform, translation, refCellAttrMat, moveCellAttrMat, m_Prefix, newindicies), tbb::auto_partitioner());
+                      FuseVolumesImpl(movDims, refDims, movingOrigin, refOrigin, movingRes, refRes, transform, translation, refCellAttrMat, moveCellAttrMat, m_Prefix, newindicies, displacements), tbb::auto_partitioner());
   }
   else
 #endif
   {
-    FuseVolumesImpl serial(movDims, refDims, movingOrigin, refOrigin, movingRes, refRes, transform, translation, refCellAttrMat, moveCellAttrMat, m_Prefix, newindicies);
+    FuseVolumesImpl serial(movDims, refDims, movingOrigin, refOrigin, movingRes, refRes, transform, translation, refCellAttrMat, moveCellAttrMat, m_Prefix, newindicies, displacements);
     serial.convert(0, refDims[2]-1, 0, refDims[1]-1, 0, refDims[0]-1);
   }
 
   //merge cell attribute matrix
+  notifyStatusMessage(getHumanLabel(), "Copying cell data");
   QList<QString> movingArrayNames = moveCellAttrMat->getAttributeArrayNames();
   for (QList<QString>::iterator iter = movingArrayNames.begin(); iter != movingArrayNames.end(); ++iter)
   {
@@ -50,6 +50,9 @@ class FuseVolumes : public AbstractFilter
     SIMPL_FILTER_PARAMETER(DynamicTableData, ManualTransformation)
     Q_PROPERTY(DynamicTableData ManualTransformation READ getManualTransformation WRITE setManualTransformation)
 
+    SIMPL_FILTER_PARAMETER(bool, UseDisplacementField)
+    Q_PROPERTY(bool UseDisplacementField READ getUseDisplacementField WRITE setUseDisplacementField)
+
     //input array paths
     SIMPL_FILTER_PARAMETER(DataArrayPath, ReferenceVolume)
     Q_PROPERTY(DataArrayPath ReferenceVolume READ getReferenceVolume WRITE setReferenceVolume)
@@ -60,6 +63,9 @@ class FuseVolumes : public AbstractFilter
     SIMPL_FILTER_PARAMETER(DataArrayPath, TransformationArrayPath)
     Q_PROPERTY(DataArrayPath TransformationArrayPath READ getTransformationArrayPath WRITE setTransformationArrayPath)
 
+    SIMPL_FILTER_PARAMETER(DataArrayPath, DisplacementFieldArrayPath)
+    Q_PROPERTY(DataArrayPath DisplacementFieldArrayPath READ getDisplacementFieldArrayPath WRITE setDisplacementFieldArrayPath)
+
 
     /**
      * @brief getCompiledLibraryName Reimplemented from @see AbstractFilter class
@@ -144,6 +150,7 @@ class FuseVolumes : public AbstractFilter
 
   private:
     DEFINE_DATAARRAY_VARIABLE(float, Transformation)
+    DEFINE_DATAARRAY_VARIABLE(float, DisplacementField)
 
     FuseVolumes(const FuseVolumes&); // Copy Constructor Not Implemented
     void operator=(const FuseVolumes&); // Operator '=' Not Implemented
@@ -0,0 +1,826 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ *                                                                             *
+ * Copyright (c) 2015 William Lenthe                                           *
+ *                                                                             *
+ * This program is free software: you can redistribute it and/or modify        *
+ * it under the terms of the GNU Lesser General Public License as published by *
+ * the Free Software Foundation, either version 3 of the License, or           *
+ * (at your option) any later version.                                         *
+ *                                                                             *
+ * This program is distributed in the hope that it will be useful,             *
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of              *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the               *
+ * GNU Lesser General Public License for more details.                         *
+ *                                                                             *
+ * You should have received a copy of the GNU Lesser General Public License    *
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.       *
+ *                                                                             *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+ 
+
+#include "GenerateVoronoiVolumes.h"
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+
+#include "SIMPLib/Common/Constants.h"
+#include "SIMPLib/FilterParameters/AbstractFilterParametersReader.h"
+#include "SIMPLib/FilterParameters/AbstractFilterParametersWriter.h"
+#include "SIMPLib/Geometry/ImageGeom.h"
+
+#include "SIMPLib/FilterParameters/DoubleFilterParameter.h"
+#include "SIMPLib/FilterParameters/FloatVec3FilterParameter.h"
+#include "SIMPLib/FilterParameters/IntFilterParameter.h"
+#include "SIMPLib/FilterParameters/IntVec3FilterParameter.h"
+#include "SIMPLib/FilterParameters/StringFilterParameter.h"
+
+#include "EbsdLib/EbsdConstants.h"
+
+#ifdef SIMPLib_USE_PARALLEL_ALGORITHMS
+  #include <tbb/parallel_for.h>
+  #include <tbb/parallel_reduce.h>
+  #include <tbb/blocked_range.h>
+  #include <tbb/partitioner.h>
+  #include <tbb/task_scheduler_init.h>
+#endif
+
+#include "DataFusion/DataFusionConstants.h"
+#include "DataFusion/DataFusionFilters/util/VoronoiGenerator.h"
+
+// Include the MOC generated file for this class
+#include "moc_GenerateVoronoiVolumes.cpp"
+
+namespace Detail
+{
+// uniformly distributed random orientation (x, y, z, w)
+template<typename Generator>
+void randomQuaternion(Generator& generator, float* q)
+{
+  std::uniform_real_distribution<double> distribution(0.0, 1.0);
+  double u1 = distribution(generator);
+  double u2 = 2.0 * SIMPLib::Constants::k_Pi * distribution(generator);
+  double u3 = 2.0 * SIMPLib::Constants::k_Pi * distribution(generator);
+  q[0] = static_cast<float>(std::sqrt(1.0 - u1) * std::sin(u2));
+  q[1] = static_cast<float>(std::sqrt(1.0 - u1) * std::cos(u2));
+  q[2] = static_cast<float>(std::sqrt(u1) * std::sin(u3));
+  q[3] = static_cast<float>(std::sqrt(u1) * std::cos(u3));
+}
+
+// uniformly distributed random direction
+template<typename Generator>
+void randomDirection(Generator& generator, float* n)
+{
+  std::normal_distribution<float> distribution(0.0f, 1.0f);
+  float length = 0;
+  while(0 == length)
+  {
+    for(size_t i = 0; i < 3; i++)
+      n[i] = distribution(generator);
+    length = std::sqrt(n[0] * n[0] + n[1] * n[1] + n[2] * n[2]);
+  }
+  for(size_t i = 0; i < 3; i++)
+    n[i] /= length;
+}
+
+// rotates an orientation by a random angle (normally distributed with the given standard deviation in radians) about a random axis
+template<typename Generator>
+void perturbQuaternion(Generator& generator, float stdDev, const float* q, float* result)
+{
+  std::copy(q, q + 4, result);
+  if(0 == stdDev) return;
+  float axis[3];
+  randomDirection(generator, axis);
+  std::normal_distribution<float> distribution(0.0f, stdDev);
+  float angle = distribution(generator) / 2;
+  float r[4] = {axis[0] * std::sin(angle), axis[1] * std::sin(angle), axis[2] * std::sin(angle), std::cos(angle)};
+  result[0] = q[3] * r[0] + q[0] * r[3] + q[1] * r[2] - q[2] * r[1];
+  result[1] = q[3] * r[1] - q[0] * r[2] + q[1] * r[3] + q[2] * r[0];
+  result[2] = q[3] * r[2] + q[0] * r[1] - q[1] * r[0] + q[2] * r[3];
+  result[3] = q[3] * r[3] - q[0] * r[0] - q[1] * r[1] - q[2] * r[2];
+}
+
+// deterministic uniform value in [0, 1) for each voxel so noise doesn't depend on the order voxels are visited
+inline double voxelRandom(uint64_t seed, uint64_t index)
+{
+  uint64_t x = seed ^ (index + 0x9E3779B97F4A7C15ULL + (seed << 6) + (seed >> 2));
+  x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ULL;
+  x = (x ^ (x >> 27)) * 0x94D049BB133111EBULL;
+  x = x ^ (x >> 31);
+  return static_cast<double>(x >> 11) / 9007199254740992.0;//2^53
+}
+
+// pairs of labels that share a voxel face (keyed as smaller label << 32 | larger label), found one row at a time
+class NeighborFinder
+{
+  public:
+    NeighborFinder(const int32_t* ids, const size_t dims[3]) :
+      m_Ids(ids),
+      m_Compacted(0)
+    {
+      std::copy(dims, dims + 3, m_Dims);
+    }
+
+    void find(size_t start, size_t end)
+    {
+      const size_t sliceSize = m_Dims[0] * m_Dims[1];
+      for(size_t row = start; row < end; row++)
+      {
+        const size_t y = row % m_Dims[1];
+        const size_t z = row / m_Dims[1];
+        const int32_t* ids = m_Ids + row * m_Dims[0];
+        for(size_t x = 0; x < m_Dims[0]; x++)
+        {
+          if(x + 1 < m_Dims[0]) add(ids[x], ids[x + 1]);
+          if(y + 1 < m_Dims[1]) add(ids[x], ids[x + m_Dims[0]]);
+          if(z + 1 < m_Dims[2]) add(ids[x], ids[x + sliceSize]);
+        }
+        // boundary voxels repeat the same pairs many times, drop duplicates whenever the list has doubled
+        if(m_Pairs.size() > 2 * m_Compacted + 4096) compact();
+      }
+    }
+
+#ifdef SIMPLib_USE_PARALLEL_ALGORITHMS
+    NeighborFinder(NeighborFinder& other, tbb::split) :
+      m_Ids(other.m_Ids),
+      m_Compacted(0)
+    {
+      std::copy(other.m_Dims, other.m_Dims + 3, m_Dims);
+    }
+
+    void operator()(const tbb::blocked_range<size_t>& r)
+    {
+      find(r.begin(), r.end());
+    }
+
+    void join(const NeighborFinder& other)
+    {
+      m_Pairs.insert(m_Pairs.end(), other.m_Pairs.begin(), other.m_Pairs.end());
+      compact();
+    }
+#endif
+
+    // sorted unique neighboring pairs
+    std::vector<uint64_t> pairs()
+    {
+      compact();
+      return m_Pairs;
+    }
+
+  private:
+    void add(int32_t a, int32_t b)
+    {
+      if(a == b || a <= 0 || b <= 0) return;
+      if(a > b) std::swap(a, b);
+      m_Pairs.push_back((static_cast<uint64_t>(a) << 32) | static_cast<uint64_t>(b));
+    }
+
+    void compact()
+    {
+      std::sort(m_Pairs.begin(), m_Pairs.end());
+      m_Pairs.erase(std::unique(m_Pairs.begin(), m_Pairs.end()), m_Pairs.end());
+      m_Compacted = m_Pairs.size();
+    }
+
+    const int32_t* m_Ids;
+    size_t m_Dims[3];
+    std::vector<uint64_t> m_Pairs;
+    size_t m_Compacted;
+};
+
+// turns the Voronoi labels of the moving volume (nearest seed) into its final feature ids: split features are cut by a plane through their seed,
+// merged features take the id of their neighbor, labels are mapped to the shuffled moving ids, and a fraction of voxels is cleared
+class MovingIdsRelabeler
+{
+  public:
+    MovingIdsRelabeler(int32_t* ids, const size_t dims[3], const std::vector<float>& seeds, const std::vector<float>& splitNormals, const std::vector<int32_t>& splitLabels,
+                       const std::vector<int32_t>& labelMap, double voxelNoise, uint64_t noiseSeed) :
+      m_Ids(ids),
+      m_Seeds(seeds),
+      m_SplitNormals(splitNormals),
+      m_SplitLabels(splitLabels),
+      m_LabelMap(labelMap),
+      m_VoxelNoise(voxelNoise),
+      m_NoiseSeed(noiseSeed)
+    {
+      std::copy(dims, dims + 3, m_Dims);
+    }
+
+    void relabel(size_t start, size_t end) const
+    {
+      for(size_t row = start; row < end; row++)
+      {
+        const float y = static_cast<float>(row % m_Dims[1]);
+        const float z = static_cast<float>(row / m_Dims[1]);
+        for(size_t x = 0; x < m_Dims[0]; x++)
+        {
+          size_t index = row * m_Dims[0] + x;
+          int32_t label = m_Ids[index];
+          if(label > 0 && m_SplitLabels[label] > 0)
+          {
+            const float* seed = &m_Seeds[3 * (label - 1)];
+            const float* normal = &m_SplitNormals[3 * (label - 1)];
+            if((x - seed[0]) * normal[0] + (y - seed[1]) * normal[1] + (z - seed[2]) * normal[2] > 0) label = m_SplitLabels[label];
+          }
+          m_Ids[index] = m_LabelMap[label];
+          if(m_VoxelNoise > 0 && voxelRandom(m_NoiseSeed, index) < m_VoxelNoise) m_Ids[index] = 0;
+        }
+      }
+    }
+
+#ifdef SIMPLib_USE_PARALLEL_ALGORITHMS
+    void operator()(const tbb::blocked_range<size_t>& r) const
+    {
+      relabel(r.begin(), r.end());
+    }
+#endif
+
+  private:
+    int32_t* m_Ids;
+    size_t m_Dims[3];
+    const std::vector<float>& m_Seeds;
+    const std::vector<float>& m_SplitNormals;
+    const std::vector<int32_t>& m_SplitLabels;
+    const std::vector<int32_t>& m_LabelMap;
+    double m_VoxelNoise;
+    uint64_t m_NoiseSeed;
+};
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+GenerateVoronoiVolumes::GenerateVoronoiVolumes() :
+  AbstractFilter(),
+  m_NumberOfFeatures(1000),
+  m_RandomSeed(5489),
+  m_RotationAngle(0.0),
+  m_Scale(1.0),
+  m_PositionNoise(0.0),
+  m_OrientationNoise(0.0),
+  m_VoxelNoise(0.0),
+  m_SplitFraction(0.0),
+  m_MergeFraction(0.0),
+  m_ReferenceDataContainerName(DataFusionConstants::Reference),
+  m_MovingDataContainerName(DataFusionConstants::Moving),
+  m_CellAttributeMatrixName(DREAM3D::Defaults::CellAttributeMatrixName),
+  m_CellFeatureAttributeMatrixName(DREAM3D::Defaults::CellFeatureAttributeMatrixName),
+  m_CellEnsembleAttributeMatrixName(DREAM3D::Defaults::CellEnsembleAttributeMatrixName),
+  m_FeatureIdsArrayName(DREAM3D::CellData::FeatureIds),
+  m_QuatsArrayName(DREAM3D::FeatureData::AvgQuats),
+  m_PhasesArrayName(DREAM3D::FeatureData::Phases),
+  m_CrystalStructuresArrayName(DREAM3D::EnsembleData::CrystalStructures),
+  m_GroundTruthIdsArrayName(DataFusionConstants::GroundTruthIds),
+  m_MergedIntoIdsArrayName(DataFusionConstants::MergedIntoIds),
+  m_TransformationAttributeMatrixName(DataFusionConstants::Transformation),
+  m_TransformationArrayName(DataFusionConstants::Transformation),
+  m_Transformation(NULL)
+{
+  m_Dimensions.x = 128;
+  m_Dimensions.y = 128;
+  m_Dimensions.z = 128;
+
+  m_RotationAxis.x = 0.0f;
+  m_RotationAxis.y = 0.0f;
+  m_RotationAxis.z = 1.0f;
+
+  m_Translation.x = 0.0f;
+  m_Translation.y = 0.0f;
+  m_Translation.z = 0.0f;
+
+  setupFilterParameters();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+GenerateVoronoiVolumes::~GenerateVoronoiVolumes()
+{
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void GenerateVoronoiVolumes::setupFilterParameters()
+{
+  FilterParameterVector parameters;
+  parameters.push_back(IntVec3FilterParameter::New("Dimensions", "Dimensions", getDimensions(), FilterParameter::Parameter));
+  parameters.push_back(IntFilterParameter::New("Number of Features", "NumberOfFeatures", getNumberOfFeatures(), FilterParameter::Parameter));
+  parameters.push_back(IntFilterParameter::New("Random Seed", "RandomSeed", getRandomSeed(), FilterParameter::Parameter));
+
+  parameters.push_back(FloatVec3FilterParameter::New("Rotation Axis", "RotationAxis", getRotationAxis(), FilterParameter::Parameter));
+  parameters.push_back(DoubleFilterParameter::New("Rotation Angle (degrees)", "RotationAngle", getRotationAngle(), FilterParameter::Parameter));
+  parameters.push_back(FloatVec3FilterParameter::New("Translation", "Translation", getTranslation(), FilterParameter::Parameter));
+  parameters.push_back(DoubleFilterParameter::New("Scale", "Scale", getScale(), FilterParameter::Parameter));
+
+  parameters.push_back(DoubleFilterParameter::New("Seed Position Noise (voxels)", "PositionNoise", getPositionNoise(), FilterParameter::Parameter));
+  parameters.push_back(DoubleFilterParameter::New("Orientation Noise (degrees)", "OrientationNoise", getOrientationNoise(), FilterParameter::Parameter));
+  parameters.push_back(DoubleFilterParameter::New("Unindexed Voxel Fraction", "VoxelNoise", getVoxelNoise(), FilterParameter::Parameter));
+  parameters.push_back(DoubleFilterParameter::New("Split Feature Fraction", "SplitFraction", getSplitFraction(), FilterParameter::Parameter));
+  parameters.push_back(DoubleFilterParameter::New("Merged Feature Fraction", "MergeFraction", getMergeFraction(), FilterParameter::Parameter));
+
+  parameters.push_back(StringFilterParameter::New("Reference Data Container", "ReferenceDataContainerName", getReferenceDataContainerName(), FilterParameter::CreatedArray));
+  parameters.push_back(StringFilterParameter::New("Moving Data Container", "MovingDataContainerName", getMovingDataContainerName(), FilterParameter::CreatedArray));
+  parameters.push_back(StringFilterParameter::New("Cell Attribute Matrix", "CellAttributeMatrixName", getCellAttributeMatrixName(), FilterParameter::CreatedArray));
+  parameters.push_back(StringFilterParameter::New("Cell Feature Attribute Matrix", "CellFeatureAttributeMatrixName", getCellFeatureAttributeMatrixName(), FilterParameter::CreatedArray));
+  parameters.push_back(StringFilterParameter::New("Cell Ensemble Attribute Matrix", "CellEnsembleAttributeMatrixName", getCellEnsembleAttributeMatrixName(), FilterParameter::CreatedArray));
+  parameters.push_back(StringFilterParameter::New("Feature Ids", "FeatureIdsArrayName", getFeatureIdsArrayName(), FilterParameter::CreatedArray));
+  parameters.push_back(StringFilterParameter::New("Average Quaternions", "QuatsArrayName", getQuatsArrayName(), FilterParameter::CreatedArray));
+  parameters.push_back(StringFilterParameter::New("Phases", "PhasesArrayName", getPhasesArrayName(), FilterParameter::CreatedArray));
+  parameters.push_back(StringFilterParameter::New("Crystal Structures", "CrystalStructuresArrayName", getCrystalStructuresArrayName(), FilterParameter::CreatedArray));
+  parameters.push_back(StringFilterParameter::New("Ground Truth Ids", "GroundTruthIdsArrayName", getGroundTruthIdsArrayName(), FilterParameter::CreatedArray));
+  parameters.push_back(StringFilterParameter::New("Merged Into Ids", "MergedIntoIdsArrayName", getMergedIntoIdsArrayName(), FilterParameter::CreatedArray));
+  parameters.push_back(StringFilterParameter::New("Transformation Attribute Matrix", "TransformationAttributeMatrixName", getTransformationAttributeMatrixName(), FilterParameter::CreatedArray));
+  parameters.push_back(StringFilterParameter::New("Transformation", "TransformationArrayName", getTransformationArrayName(), FilterParameter::CreatedArray));
+  setFilterParameters(parameters);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void GenerateVoronoiVolumes::readFilterParameters(AbstractFilterParametersReader* reader, int index)
+{
+  reader->openFilterGroup(this, index);
+  setDimensions( reader->readIntVec3("Dimensions", getDimensions() ) );
+  setNumberOfFeatures( reader->readValue("NumberOfFeatures", getNumberOfFeatures() ) );
+  setRandomSeed( reader->readValue("RandomSeed", getRandomSeed() ) );
+
+  setRotationAxis( reader->readFloatVec3("RotationAxis", getRotationAxis() ) );
+  setRotationAngle( reader->readValue("RotationAngle", getRotationAngle() ) );
+  setTranslation( reader->readFloatVec3("Translation", getTranslation() ) );
+  setScale( reader->readValue("Scale", getScale() ) );
+
+  setPositionNoise( reader->readValue("PositionNoise", getPositionNoise() ) );
+  setOrientationNoise( reader->readValue("OrientationNoise", getOrientationNoise() ) );
+  setVoxelNoise( reader->readValue("VoxelNoise", getVoxelNoise() ) );
+  setSplitFraction( reader->readValue("SplitFraction", getSplitFraction() ) );
+  setMergeFraction( reader->readValue("MergeFraction", getMergeFraction() ) );
+
+  setReferenceDataContainerName( reader->readString("ReferenceDataContainerName", getReferenceDataContainerName() ) );
+  setMovingDataContainerName( reader->readString("MovingDataContainerName", getMovingDataContainerName() ) );
+  setCellAttributeMatrixName( reader->readString("CellAttributeMatrixName", getCellAttributeMatrixName() ) );
+  setCellFeatureAttributeMatrixName( reader->readString("CellFeatureAttributeMatrixName", getCellFeatureAttributeMatrixName() ) );
+  setCellEnsembleAttributeMatrixName( reader->readString("CellEnsembleAttributeMatrixName", getCellEnsembleAttributeMatrixName() ) );
+  setFeatureIdsArrayName( reader->readString("FeatureIdsArrayName", getFeatureIdsArrayName() ) );
+  setQuatsArrayName( reader->readString("QuatsArrayName", getQuatsArrayName() ) );
+  setPhasesArrayName( reader->readString("PhasesArrayName", getPhasesArrayName() ) );
+  setCrystalStructuresArrayName( reader->readString("CrystalStructuresArrayName", getCrystalStructuresArrayName() ) );
+  setGroundTruthIdsArrayName( reader->readString("GroundTruthIdsArrayName", getGroundTruthIdsArrayName() ) );
+  setMergedIntoIdsArrayName( reader->readString("MergedIntoIdsArrayName", getMergedIntoIdsArrayName() ) );
+  setTransformationAttributeMatrixName( reader->readString("TransformationAttributeMatrixName", getTransformationAttributeMatrixName() ) );
+  setTransformationArrayName( reader->readString("TransformationArrayName", getTransformationArrayName() ) );
+  reader->closeFilterGroup();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int GenerateVoronoiVolumes::writeFilterParameters(AbstractFilterParametersWriter* writer, int index)
+{
+  writer->openFilterGroup(this, index);
+  SIMPL_FILTER_WRITE_PARAMETER(FilterVersion)
+  SIMPL_FILTER_WRITE_PARAMETER(Dimensions)
+  SIMPL_FILTER_WRITE_PARAMETER(NumberOfFeatures)
+  SIMPL_FILTER_WRITE_PARAMETER(RandomSeed)
+
+  SIMPL_FILTER_WRITE_PARAMETER(RotationAxis)
+  SIMPL_FILTER_WRITE_PARAMETER(RotationAngle)
+  SIMPL_FILTER_WRITE_PARAMETER(Translation)
+  SIMPL_FILTER_WRITE_PARAMETER(Scale)
+
+  SIMPL_FILTER_WRITE_PARAMETER(PositionNoise)
+  SIMPL_FILTER_WRITE_PARAMETER(OrientationNoise)
+  SIMPL_FILTER_WRITE_PARAMETER(VoxelNoise)
+  SIMPL_FILTER_WRITE_PARAMETER(SplitFraction)
+  SIMPL_FILTER_WRITE_PARAMETER(MergeFraction)
+
+  SIMPL_FILTER_WRITE_PARAMETER(ReferenceDataContainerName)
+  SIMPL_FILTER_WRITE_PARAMETER(MovingDataContainerName)
+  SIMPL_FILTER_WRITE_PARAMETER(CellAttributeMatrixName)
+  SIMPL_FILTER_WRITE_PARAMETER(CellFeatureAttributeMatrixName)
+  SIMPL_FILTER_WRITE_PARAMETER(CellEnsembleAttributeMatrixName)
+  SIMPL_FILTER_WRITE_PARAMETER(FeatureIdsArrayName)
+  SIMPL_FILTER_WRITE_PARAMETER(QuatsArrayName)
+  SIMPL_FILTER_WRITE_PARAMETER(PhasesArrayName)
+  SIMPL_FILTER_WRITE_PARAMETER(CrystalStructuresArrayName)
+  SIMPL_FILTER_WRITE_PARAMETER(GroundTruthIdsArrayName)
+  SIMPL_FILTER_WRITE_PARAMETER(MergedIntoIdsArrayName)
+  SIMPL_FILTER_WRITE_PARAMETER(TransformationAttributeMatrixName)
+  SIMPL_FILTER_WRITE_PARAMETER(TransformationArrayName)
+  writer->closeFilterGroup();
+  return ++index; // we want to return the next index that was just written to
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void GenerateVoronoiVolumes::createVolume(const QString& name, size_t numFeatures)
+{
+  DataContainer::Pointer m = getDataContainerArray()->createNonPrereqDataContainer<AbstractFilter>(this, name);
+  if(getErrorCondition() < 0) return;
+
+  //both volumes are on a unit grid with the origin at the corner of the first voxel, seeds and the transformation use voxel indices (voxel centers at integer coordinates)
+  size_t dims[3] = {static_cast<size_t>(getDimensions().x), static_cast<size_t>(getDimensions().y), static_cast<size_t>(getDimensions().z)};
+  float res[3] = {1.0f, 1.0f, 1.0f};
+  float origin[3] = {0.0f, 0.0f, 0.0f};
+  ImageGeom::Pointer image = ImageGeom::CreateGeometry(DREAM3D::Geometry::ImageGeometry);
+  image->setDimensions(dims);
+  image->setResolution(res);
+  image->setOrigin(origin);
+  m->setGeometry(image);
+
+  QVector<size_t> tDims(3, 0);
+  tDims[0] = dims[0];
+  tDims[1] = dims[1];
+  tDims[2] = dims[2];
+  m->createNonPrereqAttributeMatrix<AbstractFilter>(this, getCellAttributeMatrixName(), tDims, DREAM3D::AttributeMatrixType::Cell);
+  m->createNonPrereqAttributeMatrix<AbstractFilter>(this, getCellFeatureAttributeMatrixName(), QVector<size_t>(1, numFeatures + 1), DREAM3D::AttributeMatrixType::CellFeature);
+  m->createNonPrereqAttributeMatrix<AbstractFilter>(this, getCellEnsembleAttributeMatrixName(), QVector<size_t>(1, 2), DREAM3D::AttributeMatrixType::CellEnsemble);
+  if(getErrorCondition() < 0) return;
+
+  QVector<size_t> cDims(1, 1);
+  getDataContainerArray()->createNonPrereqArrayFromPath<DataArray<int32_t>, AbstractFilter, int32_t>(this, DataArrayPath(name, getCellAttributeMatrixName(), getFeatureIdsArrayName()), 0, cDims);
+  getDataContainerArray()->createNonPrereqArrayFromPath<DataArray<int32_t>, AbstractFilter, int32_t>(this, DataArrayPath(name, getCellFeatureAttributeMatrixName(), getPhasesArrayName()), 0, cDims);
+  getDataContainerArray()->createNonPrereqArrayFromPath<DataArray<uint32_t>, AbstractFilter, uint32_t>(this, DataArrayPath(name, getCellEnsembleAttributeMatrixName(), getCrystalStructuresArrayName()), Ebsd::CrystalStructure::UnknownCrystalStructure, cDims);
+  cDims[0] = 4;
+  getDataContainerArray()->createNonPrereqArrayFromPath<DataArray<float>, AbstractFilter, float>(this, DataArrayPath(name, getCellFeatureAttributeMatrixName(), getQuatsArrayName()), 0, cDims);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void GenerateVoronoiVolumes::dataCheck()
+{
+  setErrorCondition(0);
+
+  if(getDimensions().x <= 0 || getDimensions().y <= 0 || getDimensions().z <= 0)
+  {
+    setErrorCondition(-1000);
+    notifyErrorMessage(getHumanLabel(), "Dimensions must be positive", getErrorCondition());
+    return;
+  }
+
+  if(getNumberOfFeatures() <= 0)
+  {
+    setErrorCondition(-1001);
+    notifyErrorMessage(getHumanLabel(), "Number of Features must be positive", getErrorCondition());
+    return;
+  }
+
+  if(getScale() <= 0.0)
+  {
+    setErrorCondition(-1002);
+    notifyErrorMessage(getHumanLabel(), "Scale must be positive", getErrorCondition());
+    return;
+  }
+
+  if(0.0 != getRotationAngle() && 0.0f == getRotationAxis().x && 0.0f == getRotationAxis().y && 0.0f == getRotationAxis().z)
+  {
+    setErrorCondition(-1003);
+    notifyErrorMessage(getHumanLabel(), "Rotation Axis must be non zero", getErrorCondition());
+    return;
+  }
+
+  if(getPositionNoise() < 0.0 || getOrientationNoise() < 0.0)
+  {
+    setErrorCondition(-1004);
+    notifyErrorMessage(getHumanLabel(), "Noise standard deviations must be non negative", getErrorCondition());
+    return;
+  }
+
+  if(getVoxelNoise() < 0.0 || getVoxelNoise() > 1.0 || getSplitFraction() < 0.0 || getSplitFraction() > 1.0 || getMergeFraction() < 0.0 || getMergeFraction() > 1.0)
+  {
+    setErrorCondition(-1005);
+    notifyErrorMessage(getHumanLabel(), "Fractions must be between 0 and 1", getErrorCondition());
+    return;
+  }
+
+  //the number of moving features depends on how many features can be split or merged, it is set during execute
+  createVolume(getReferenceDataContainerName(), getNumberOfFeatures());
+  if(getErrorCondition() < 0) return;
+  createVolume(getMovingDataContainerName(), getNumberOfFeatures());
+  if(getErrorCondition() < 0) return;
+
+  DataArrayPath tempPath(getMovingDataContainerName(), getCellFeatureAttributeMatrixName(), getGroundTruthIdsArrayName());
+  getDataContainerArray()->createNonPrereqArrayFromPath<DataArray<int32_t>, AbstractFilter, int32_t>(this, tempPath, 0, QVector<size_t>(1, 1));
+  tempPath.update(getReferenceDataContainerName(), getCellFeatureAttributeMatrixName(), getMergedIntoIdsArrayName());
+  getDataContainerArray()->createNonPrereqArrayFromPath<DataArray<int32_t>, AbstractFilter, int32_t>(this, tempPath, 0, QVector<size_t>(1, 1));
+
+  DataContainer::Pointer m = getDataContainerArray()->getDataContainer(getMovingDataContainerName());
+  m->createNonPrereqAttributeMatrix<AbstractFilter>(this, getTransformationAttributeMatrixName(), QVector<size_t>(1, 1), DREAM3D::AttributeMatrixType::MetaData);
+  if(getErrorCondition() < 0) return;
+  QVector<size_t> transDims(2, 4);//4x4 array
+  tempPath.update(getMovingDataContainerName(), getTransformationAttributeMatrixName(), getTransformationArrayName());
+  m_TransformationPtr = getDataContainerArray()->createNonPrereqArrayFromPath<DataArray<float>, AbstractFilter, float>(this, tempPath, 0, transDims);
+  if( NULL != m_TransformationPtr.lock().get() ) m_Transformation = m_TransformationPtr.lock()->getPointer(0);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void GenerateVoronoiVolumes::preflight()
+{
+  // These are the REQUIRED lines of CODE to make sure the filter behaves correctly
+  setInPreflight(true); // Set the fact that we are preflighting.
+  emit preflightAboutToExecute(); // Emit this signal so that other widgets can do one file update
+  emit updateFilterParameters(this); // Emit this signal to have the widgets push their values down to the filter
+  dataCheck(); // Run our DataCheck to make sure everthing is setup correctly
+  emit preflightExecuted(); // We are done preflighting this filter
+  setInPreflight(false); // Inform the system this filter is NOT in preflight mode anymore.
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void GenerateVoronoiVolumes::execute()
+{
+  setErrorCondition(0);
+  dataCheck();
+  if(getErrorCondition() < 0) { return; }
+
+  if (getCancel() == true) { return; }
+
+#ifdef SIMPLib_USE_PARALLEL_ALGORITHMS
+  tbb::task_scheduler_init init;
+  bool doParallel = true;
+#endif
+
+  const size_t dims[3] = {static_cast<size_t>(getDimensions().x), static_cast<size_t>(getDimensions().y), static_cast<size_t>(getDimensions().z)};
+  const size_t numFeatures = static_cast<size_t>(getNumberOfFeatures());
+  std::mt19937 generator(static_cast<std::mt19937::result_type>(getRandomSeed()));
+  std::uniform_real_distribution<float> uniform(0.0f, 1.0f);
+  std::normal_distribution<float> normal(0.0f, 1.0f);
+
+  //seeds are uniformly distributed over the reference volume with random orientations
+  notifyStatusMessage(getHumanLabel(), "Generating seeds");
+  std::vector<float> referenceSeeds(3 * numFeatures);
+  std::vector<float> referenceQuats(4 * numFeatures);
+  for(size_t i = 0; i < numFeatures; i++)
+  {
+    for(size_t j = 0; j < 3; j++)
+      referenceSeeds[3 * i + j] = uniform(generator) * dims[j] - 0.5f;
+    Detail::randomQuaternion(generator, &referenceQuats[4 * i]);
+  }
+
+  //ground truth similarity transformation (reference = scale * rotation * moving + translation)
+  float axis[3] = {getRotationAxis().x, getRotationAxis().y, getRotationAxis().z};
+  float length = std::sqrt(axis[0] * axis[0] + axis[1] * axis[1] + axis[2] * axis[2]);
+  if(length > 0.0f)
+  {
+    for(size_t i = 0; i < 3; i++)
+      axis[i] /= length;
+  }
+  const float angle = static_cast<float>(getRotationAngle() * SIMPLib::Constants::k_Pi / 180.0);
+  const float c = std::cos(angle), s = std::sin(angle);
+  float rotation[3][3];
+  for(size_t i = 0; i < 3; i++)
+  {
+    for(size_t j = 0; j < 3; j++)
+      rotation[i][j] = (1.0f - c) * axis[i] * axis[j] + (i == j ? c : 0.0f);
+  }
+  rotation[0][1] -= s * axis[2];
+  rotation[0][2] += s * axis[1];
+  rotation[1][0] += s * axis[2];
+  rotation[1][2] -= s * axis[0];
+  rotation[2][0] -= s * axis[1];
+  rotation[2][1] += s * axis[0];
+  const float scale = static_cast<float>(getScale());
+  const float translation[3] = {getTranslation().x, getTranslation().y, getTranslation().z};
+
+  std::fill(m_Transformation, m_Transformation + 16, 0.0f);
+  for(size_t i = 0; i < 3; i++)
+  {
+    for(size_t j = 0; j < 3; j++)
+      m_Transformation[4 * i + j] = scale * rotation[i][j];
+    m_Transformation[4 * i + 3] = translation[i];
+  }
+  m_Transformation[15] = 1.0f;
+
+  //a tessellation is unchanged by a similarity transformation, so the moving volume is the tessellation of the seeds mapped into the moving frame
+  std::vector<float> movingSeeds(3 * numFeatures);
+  const float positionNoise = static_cast<float>(getPositionNoise());
+  for(size_t i = 0; i < numFeatures; i++)
+  {
+    float offset[3];
+    for(size_t j = 0; j < 3; j++)
+      offset[j] = referenceSeeds[3 * i + j] - translation[j];
+    for(size_t j = 0; j < 3; j++)
+    {
+      movingSeeds[3 * i + j] = (rotation[0][j] * offset[0] + rotation[1][j] * offset[1] + rotation[2][j] * offset[2]) / scale;
+      if(positionNoise > 0.0f) movingSeeds[3 * i + j] += positionNoise * normal(generator);
+    }
+  }
+
+  //reference volume
+  notifyStatusMessage(getHumanLabel(), "Labeling reference volume");
+  DataArray<int32_t>::Pointer referenceIdsPtr = getDataContainerArray()->getPrereqArrayFromPath<DataArray<int32_t>, AbstractFilter>(this, DataArrayPath(getReferenceDataContainerName(), getCellAttributeMatrixName(), getFeatureIdsArrayName()), QVector<size_t>(1, 1));
+  VoronoiGenerator(referenceSeeds.data(), numFeatures, dims).label(referenceIdsPtr->getPointer(0));
+
+  if (getCancel() == true) { return; }
+
+  //moving volume (labeled with seed index + 1 until features are split, merged, and shuffled)
+  notifyStatusMessage(getHumanLabel(), "Labeling moving volume");
+  DataArray<int32_t>::Pointer movingIdsPtr = getDataContainerArray()->getPrereqArrayFromPath<DataArray<int32_t>, AbstractFilter>(this, DataArrayPath(getMovingDataContainerName(), getCellAttributeMatrixName(), getFeatureIdsArrayName()), QVector<size_t>(1, 1));
+  VoronoiGenerator(movingSeeds.data(), numFeatures, dims).label(movingIdsPtr->getPointer(0));
+
+  if (getCancel() == true) { return; }
+
+  //merge randomly selected features into their closest unused neighbor then split other randomly selected features
+  //partners are limited to features whose moving cells share a face so every merged feature is a single connected region
+  std::vector<size_t> order(numFeatures);
+  for(size_t i = 0; i < numFeatures; i++)
+    order[i] = i;
+  std::shuffle(order.begin(), order.end(), generator);
+  std::vector<bool> modified(numFeatures, false);
+  std::vector<int32_t> mergeTarget(numFeatures, -1);
+  const size_t targetMerges = static_cast<size_t>(std::floor(getMergeFraction() * numFeatures + 0.5));
+  const size_t targetSplits = static_cast<size_t>(std::floor(getSplitFraction() * numFeatures + 0.5));
+  size_t numMerges = 0;
+  if(targetMerges > 0)
+  {
+    notifyStatusMessage(getHumanLabel(), "Finding neighboring features");
+    Detail::NeighborFinder finder(movingIdsPtr->getPointer(0), dims);
+#ifdef SIMPLib_USE_PARALLEL_ALGORITHMS
+    if (doParallel == true)
+    {
+      tbb::parallel_reduce(tbb::blocked_range<size_t>(0, dims[1] * dims[2]), finder, tbb::auto_partitioner());
+    }
+    else
+#endif
+    {
+      finder.find(0, dims[1] * dims[2]);
+    }
+
+    //neighbors of each label in compressed sparse row order
+    std::vector<uint64_t> pairs = finder.pairs();
+    std::vector<size_t> offsets(numFeatures + 2, 0);
+    for(size_t i = 0; i < pairs.size(); i++)
+    {
+      offsets[(pairs[i] >> 32) + 1]++;
+      offsets[(pairs[i] & 0xFFFFFFFF) + 1]++;
+    }
+    for(size_t i = 1; i < offsets.size(); i++)
+      offsets[i] += offsets[i - 1];
+    std::vector<size_t> fill(offsets.begin(), offsets.end() - 1);
+    std::vector<int32_t> neighbors(2 * pairs.size());
+    for(size_t i = 0; i < pairs.size(); i++)
+    {
+      int32_t a = static_cast<int32_t>(pairs[i] >> 32);
+      int32_t b = static_cast<int32_t>(pairs[i] & 0xFFFFFFFF);
+      neighbors[fill[a]++] = b;
+      neighbors[fill[b]++] = a;
+    }
+
+    for(size_t i = 0; i < numFeatures && numMerges < targetMerges; i++)
+    {
+      size_t feature = order[i];
+      if(modified[feature]) continue;
+      int32_t partner = -1;
+      float partnerDistance = 0.0f;
+      for(size_t j = offsets[feature + 1]; j < offsets[feature + 2]; j++)
+      {
+        size_t neighbor = static_cast<size_t>(neighbors[j] - 1);
+        if(modified[neighbor]) continue;
+        float distance = 0.0f;
+        for(size_t k = 0; k < 3; k++)
+          distance += (referenceSeeds[3 * neighbor + k] - referenceSeeds[3 * feature + k]) * (referenceSeeds[3 * neighbor + k] - referenceSeeds[3 * feature + k]);
+        if(partner < 0 || distance < partnerDistance)
+        {
+          partner = static_cast<int32_t>(neighbor);
+          partnerDistance = distance;
+        }
+      }
+      if(partner < 0) continue;
+      mergeTarget[feature] = partner;
+      modified[feature] = modified[partner] = true;
+      numMerges++;
+    }
+  }
+
+  //labels of the moving tessellation are seed index + 1, split features get a second label past the seeds
+  std::vector<float> splitNormals(3 * numFeatures, 0.0f);
+  std::vector<int32_t> splitLabels(numFeatures + 1, 0);
+  std::vector<size_t> parents(numFeatures + 1);
+  for(size_t i = 0; i <= numFeatures; i++)
+    parents[i] = i;
+  size_t numSplits = 0;
+  for(size_t i = 0; i < numFeatures && numSplits < targetSplits; i++)
+  {
+    size_t feature = order[i];
+    if(modified[feature]) continue;
+    modified[feature] = true;
+    Detail::randomDirection(generator, &splitNormals[3 * feature]);
+    splitLabels[feature + 1] = static_cast<int32_t>(numFeatures + 1 + numSplits);
+    parents.push_back(feature + 1);
+    numSplits++;
+  }
+
+  //surviving labels get shuffled moving ids so matching can't rely on the id order
+  const size_t numLabels = numFeatures + numSplits;
+  const size_t numMovingFeatures = numLabels - numMerges;
+  std::vector<int32_t> movingIds(numMovingFeatures);
+  for(size_t i = 0; i < numMovingFeatures; i++)
+    movingIds[i] = static_cast<int32_t>(i + 1);
+  std::shuffle(movingIds.begin(), movingIds.end(), generator);
+  std::vector<int32_t> labelMap(numLabels + 1, 0);
+  for(size_t label = 1, next = 0; label <= numLabels; label++)
+  {
+    if(label <= numFeatures && mergeTarget[label - 1] >= 0) continue;
+    labelMap[label] = movingIds[next++];
+  }
+  for(size_t i = 0; i < numFeatures; i++)
+  {
+    if(mergeTarget[i] >= 0) labelMap[i + 1] = labelMap[mergeTarget[i] + 1];
+  }
+
+  if (getCancel() == true) { return; }
+
+  notifyStatusMessage(getHumanLabel(), "Splitting and merging features");
+  Detail::MovingIdsRelabeler relabeler(movingIdsPtr->getPointer(0), dims, movingSeeds, splitNormals, splitLabels, labelMap, getVoxelNoise(), static_cast<uint64_t>(getRandomSeed()));
+#ifdef SIMPLib_USE_PARALLEL_ALGORITHMS
+  if (doParallel == true)
+  {
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, dims[1] * dims[2]), relabeler, tbb::auto_partitioner());
+  }
+  else
+#endif
+  {
+    relabeler.relabel(0, dims[1] * dims[2]);
+  }
+
+  //feature data (every feature is a single cubic phase)
+  getDataContainerArray()->getAttributeMatrix(DataArrayPath(getMovingDataContainerName(), getCellFeatureAttributeMatrixName(), ""))->resizeAttributeArrays(QVector<size_t>(1, numMovingFeatures + 1));
+  QVector<size_t> cDims(1, 4);
+  float* referenceQuatsOut = getDataContainerArray()->getPrereqArrayFromPath<DataArray<float>, AbstractFilter>(this, DataArrayPath(getReferenceDataContainerName(), getCellFeatureAttributeMatrixName(), getQuatsArrayName()), cDims)->getPointer(0);
+  float* movingQuatsOut = getDataContainerArray()->getPrereqArrayFromPath<DataArray<float>, AbstractFilter>(this, DataArrayPath(getMovingDataContainerName(), getCellFeatureAttributeMatrixName(), getQuatsArrayName()), cDims)->getPointer(0);
+  cDims[0] = 1;
+  int32_t* referencePhases = getDataContainerArray()->getPrereqArrayFromPath<DataArray<int32_t>, AbstractFilter>(this, DataArrayPath(getReferenceDataContainerName(), getCellFeatureAttributeMatrixName(), getPhasesArrayName()), cDims)->getPointer(0);
+  int32_t* movingPhases = getDataContainerArray()->getPrereqArrayFromPath<DataArray<int32_t>, AbstractFilter>(this, DataArrayPath(getMovingDataContainerName(), getCellFeatureAttributeMatrixName(), getPhasesArrayName()), cDims)->getPointer(0);
+  int32_t* groundTruthIds = getDataContainerArray()->getPrereqArrayFromPath<DataArray<int32_t>, AbstractFilter>(this, DataArrayPath(getMovingDataContainerName(), getCellFeatureAttributeMatrixName(), getGroundTruthIdsArrayName()), cDims)->getPointer(0);
+  int32_t* mergedIntoIds = getDataContainerArray()->getPrereqArrayFromPath<DataArray<int32_t>, AbstractFilter>(this, DataArrayPath(getReferenceDataContainerName(), getCellFeatureAttributeMatrixName(), getMergedIntoIdsArrayName()), cDims)->getPointer(0);
+
+  std::copy(referenceQuats.begin(), referenceQuats.end(), referenceQuatsOut + 4);
+  std::fill(referencePhases + 1, referencePhases + numFeatures + 1, 1);
+  //absorbed reference features have no moving feature of their own, they point to the reference feature they were merged into
+  mergedIntoIds[0] = 0;
+  for(size_t i = 0; i < numFeatures; i++)
+    mergedIntoIds[i + 1] = mergeTarget[i] + 1;
+  std::fill(movingQuatsOut, movingQuatsOut + 4, 0.0f);
+  movingPhases[0] = groundTruthIds[0] = 0;
+  const float orientationNoise = static_cast<float>(getOrientationNoise() * SIMPLib::Constants::k_Pi / 180.0);
+  for(size_t label = 1; label <= numLabels; label++)
+  {
+    if(label <= numFeatures && mergeTarget[label - 1] >= 0) continue;
+    int32_t id = labelMap[label];
+    groundTruthIds[id] = static_cast<int32_t>(parents[label]);
+    movingPhases[id] = 1;
+    Detail::perturbQuaternion(generator, orientationNoise, &referenceQuats[4 * (parents[label] - 1)], movingQuatsOut + 4 * id);
+  }
+
+  const QString names[2] = {getReferenceDataContainerName(), getMovingDataContainerName()};
+  for(size_t i = 0; i < 2; i++)
+  {
+    uint32_t* crystalStructures = getDataContainerArray()->getPrereqArrayFromPath<DataArray<uint32_t>, AbstractFilter>(this, DataArrayPath(names[i], getCellEnsembleAttributeMatrixName(), getCrystalStructuresArrayName()), cDims)->getPointer(0);
+    crystalStructures[0] = Ebsd::CrystalStructure::UnknownCrystalStructure;
+    crystalStructures[1] = Ebsd::CrystalStructure::Cubic_High;
+  }
+
+  notifyStatusMessage(getHumanLabel(), "Complete");
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+AbstractFilter::Pointer GenerateVoronoiVolumes::newFilterInstance(bool copyFilterParameters)
+{
+  GenerateVoronoiVolumes::Pointer filter = GenerateVoronoiVolumes::New();
+  if(true == copyFilterParameters)
+  {
+    copyFilterParameterInstanceVariables(filter.get());
+  }
+  return filter;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+const QString GenerateVoronoiVolumes::getCompiledLibraryName()
+{ return DataFusionConstants::DataFusionBaseName; }
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+const QString GenerateVoronoiVolumes::getGroupName()
+{ return DREAM3D::FilterGroups::Unsupported; }
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+const QString GenerateVoronoiVolumes::getHumanLabel()
+{ return "Generate Voronoi Volumes"; }
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+const QString GenerateVoronoiVolumes::getSubGroupName()
+{ return "DataFusion"; }
@@ -0,0 +1,215 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ *                                                                             *
+ * Copyright (c) 2015 William Lenthe                                           *
+ *                                                                             *
+ * This program is free software: you can redistribute it and/or modify        *
+ * it under the terms of the GNU Lesser General Public License as published by *
+ * the Free Software Foundation, either version 3 of the License, or           *
+ * (at your option) any later version.                                         *
+ *                                                                             *
+ * This program is distributed in the hope that it will be useful,             *
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of              *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the               *
+ * GNU Lesser General Public License for more details.                         *
+ *                                                                             *
+ * You should have received a copy of the GNU Lesser General Public License    *
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.       *
+ *                                                                             *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+ 
+#ifndef _GenerateVoronoiVolumes_H_
+#define _GenerateVoronoiVolumes_H_
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/Common/SIMPLibSetGetMacros.h"
+#include "SIMPLib/Common/AbstractFilter.h"
+
+/**
+ * @brief The GenerateVoronoiVolumes class. See [Filter documentation](@ref GenerateVoronoiVolumes) for details.
+ */
+class GenerateVoronoiVolumes : public AbstractFilter
+{
+  Q_OBJECT /* Need this for Qt's signals and slots mechanism to work */
+
+  public:
+    SIMPL_SHARED_POINTERS(GenerateVoronoiVolumes)
+    SIMPL_STATIC_NEW_MACRO(GenerateVoronoiVolumes)
+    SIMPL_TYPE_MACRO_SUPER(GenerateVoronoiVolumes, AbstractFilter)
+
+    virtual ~GenerateVoronoiVolumes();
+
+    //microstructure
+    SIMPL_FILTER_PARAMETER(IntVec3_t, Dimensions)
+    Q_PROPERTY(IntVec3_t Dimensions READ getDimensions WRITE setDimensions)
+
+    SIMPL_FILTER_PARAMETER(int, NumberOfFeatures)
+    Q_PROPERTY(int NumberOfFeatures READ getNumberOfFeatures WRITE setNumberOfFeatures)
+
+    SIMPL_FILTER_PARAMETER(int, RandomSeed)
+    Q_PROPERTY(int RandomSeed READ getRandomSeed WRITE setRandomSeed)
+
+    //ground truth transformation (moving -> reference)
+    SIMPL_FILTER_PARAMETER(FloatVec3_t, RotationAxis)
+    Q_PROPERTY(FloatVec3_t RotationAxis READ getRotationAxis WRITE setRotationAxis)
+
+    SIMPL_FILTER_PARAMETER(double, RotationAngle)
+    Q_PROPERTY(double RotationAngle READ getRotationAngle WRITE setRotationAngle)
+
+    SIMPL_FILTER_PARAMETER(FloatVec3_t, Translation)
+    Q_PROPERTY(FloatVec3_t Translation READ getTranslation WRITE setTranslation)
+
+    SIMPL_FILTER_PARAMETER(double, Scale)
+    Q_PROPERTY(double Scale READ getScale WRITE setScale)
+
+    //differences between the volumes
+    SIMPL_FILTER_PARAMETER(double, PositionNoise)
+    Q_PROPERTY(double PositionNoise READ getPositionNoise WRITE setPositionNoise)
+
+    SIMPL_FILTER_PARAMETER(double, OrientationNoise)
+    Q_PROPERTY(double OrientationNoise READ getOrientationNoise WRITE setOrientationNoise)
+
+    SIMPL_FILTER_PARAMETER(double, VoxelNoise)
+    Q_PROPERTY(double VoxelNoise READ getVoxelNoise WRITE setVoxelNoise)
+
+    SIMPL_FILTER_PARAMETER(double, SplitFraction)
+    Q_PROPERTY(double SplitFraction READ getSplitFraction WRITE setSplitFraction)
+
+    SIMPL_FILTER_PARAMETER(double, MergeFraction)
+    Q_PROPERTY(double MergeFraction READ getMergeFraction WRITE setMergeFraction)
+
+    //created arrays
+    SIMPL_FILTER_PARAMETER(QString, ReferenceDataContainerName)
+    Q_PROPERTY(QString ReferenceDataContainerName READ getReferenceDataContainerName WRITE setReferenceDataContainerName)
+
+    SIMPL_FILTER_PARAMETER(QString, MovingDataContainerName)
+    Q_PROPERTY(QString MovingDataContainerName READ getMovingDataContainerName WRITE setMovingDataContainerName)
+
+    SIMPL_FILTER_PARAMETER(QString, CellAttributeMatrixName)
+    Q_PROPERTY(QString CellAttributeMatrixName READ getCellAttributeMatrixName WRITE setCellAttributeMatrixName)
+
+    SIMPL_FILTER_PARAMETER(QString, CellFeatureAttributeMatrixName)
+    Q_PROPERTY(QString CellFeatureAttributeMatrixName READ getCellFeatureAttributeMatrixName WRITE setCellFeatureAttributeMatrixName)
+
+    SIMPL_FILTER_PARAMETER(QString, CellEnsembleAttributeMatrixName)
+    Q_PROPERTY(QString CellEnsembleAttributeMatrixName READ getCellEnsembleAttributeMatrixName WRITE setCellEnsembleAttributeMatrixName)
+
+    SIMPL_FILTER_PARAMETER(QString, FeatureIdsArrayName)
+    Q_PROPERTY(QString FeatureIdsArrayName READ getFeatureIdsArrayName WRITE setFeatureIdsArrayName)
+
+    SIMPL_FILTER_PARAMETER(QString, QuatsArrayName)
+    Q_PROPERTY(QString QuatsArrayName READ getQuatsArrayName WRITE setQuatsArrayName)
+
+    SIMPL_FILTER_PARAMETER(QString, PhasesArrayName)
+    Q_PROPERTY(QString PhasesArrayName READ getPhasesArrayName WRITE setPhasesArrayName)
+
+    SIMPL_FILTER_PARAMETER(QString, CrystalStructuresArrayName)
+    Q_PROPERTY(QString CrystalStructuresArrayName READ getCrystalStructuresArrayName WRITE setCrystalStructuresArrayName)
+
+    SIMPL_FILTER_PARAMETER(QString, GroundTruthIdsArrayName)
+    Q_PROPERTY(QString GroundTruthIdsArrayName READ getGroundTruthIdsArrayName WRITE setGroundTruthIdsArrayName)
+
+    SIMPL_FILTER_PARAMETER(QString, MergedIntoIdsArrayName)
+    Q_PROPERTY(QString MergedIntoIdsArrayName READ getMergedIntoIdsArrayName WRITE setMergedIntoIdsArrayName)
+
+    SIMPL_FILTER_PARAMETER(QString, TransformationAttributeMatrixName)
+    Q_PROPERTY(QString TransformationAttributeMatrixName READ getTransformationAttributeMatrixName WRITE setTransformationAttributeMatrixName)
+
+    SIMPL_FILTER_PARAMETER(QString, TransformationArrayName)
+    Q_PROPERTY(QString TransformationArrayName READ getTransformationArrayName WRITE setTransformationArrayName)
+
+    /**
+     * @brief getCompiledLibraryName Reimplemented from @see AbstractFilter class
+     */
+    virtual const QString getCompiledLibraryName();
+
+    /**
+     * @brief newFilterInstance Reimplemented from @see AbstractFilter class
+     */
+    virtual AbstractFilter::Pointer newFilterInstance(bool copyFilterParameters);
+
+    /**
+     * @brief getGroupName Reimplemented from @see AbstractFilter class
+     */
+    virtual const QString getGroupName();
+
+    /**
+     * @brief getSubGroupName Reimplemented from @see AbstractFilter class
+     */
+    virtual const QString getSubGroupName();
+
+    /**
+     * @brief getHumanLabel Reimplemented from @see AbstractFilter class
+     */
+    virtual const QString getHumanLabel();
+
+    /**
+     * @brief setupFilterParameters Reimplemented from @see AbstractFilter class
+     */
+    virtual void setupFilterParameters();
+
+    /**
+     * @brief writeFilterParameters Reimplemented from @see AbstractFilter class
+     */
+    virtual int writeFilterParameters(AbstractFilterParametersWriter* writer, int index);
+
+    /**
+     * @brief readFilterParameters Reimplemented from @see AbstractFilter class
+     */
+    virtual void readFilterParameters(AbstractFilterParametersReader* reader, int index);
+
+   /**
+    * @brief execute Reimplemented from @see AbstractFilter class
+    */
+    virtual void execute();
+
+    /**
+    * @brief preflight Reimplemented from @see AbstractFilter class
+    */
+    virtual void preflight();
+
+  signals:
+    /**
+     * @brief updateFilterParameters Emitted when the Filter requests all the latest Filter parameters
+     * be pushed from a user-facing control (such as a widget)
+     * @param filter Filter instance pointer
+     */
+    void updateFilterParameters(AbstractFilter* filter);
+
+    /**
+     * @brief parametersChanged Emitted when any Filter parameter is changed internally
+     */
+    void parametersChanged();
+
+    /**
+     * @brief preflightAboutToExecute Emitted just before calling dataCheck()
+     */
+    void preflightAboutToExecute();
+
+    /**
+     * @brief preflightExecuted Emitted just after calling dataCheck()
+     */
+    void preflightExecuted();
+
+  protected:
+    GenerateVoronoiVolumes();
+
+    /**
+     * @brief dataCheck Checks for the appropriate parameter values and availability of arrays
+     */
+    void dataCheck();
+
+    /**
+     * @brief createVolume Creates a data container with an image geometry and the cell, feature, and ensemble attribute matrices and arrays
+     * @param name data container name
+     * @param numFeatures number of features (excluding feature 0)
+     */
+    void createVolume(const QString& name, size_t numFeatures);
+
+  private:
+    DEFINE_DATAARRAY_VARIABLE(float, Transformation)
+
+    GenerateVoronoiVolumes(const GenerateVoronoiVolumes&); // Copy Constructor Not Implemented
+    void operator=(const GenerateVoronoiVolumes&); // Operator '=' Not Implemented
+};
+
+#endif /* _GenerateVoronoiVolumes_H_ */
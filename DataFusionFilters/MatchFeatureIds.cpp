@@ -19,6 +19,8 @@
  
 #include "MatchFeatureIds.h"
 
+#include <QtCore/QFileInfo>
+
 #include "SIMPLib/Common/Constants.h"
 #include "SIMPLib/FilterParameters/AbstractFilterParametersReader.h"
 #include "SIMPLib/FilterParameters/AbstractFilterParametersWriter.h"
@@ -26,26 +28,1121 @@
 #include "SIMPLib/FilterParameters/DataArraySelectionFilterParameter.h"
 #include "SIMPLib/FilterParameters/AttributeMatrixSelectionFilterParameter.h"
 #include "SIMPLib/FilterParameters/ChoiceFilterParameter.h"
+#include "SIMPLib/FilterParameters/LinkedChoicesFilterParameter.h"
 #include "SIMPLib/FilterParameters/DoubleFilterParameter.h"
 #include "SIMPLib/FilterParameters/StringFilterParameter.h"
 #include "SIMPLib/FilterParameters/LinkedBooleanFilterParameter.h"
+#include "SIMPLib/FilterParameters/BooleanFilterParameter.h"
 
 #include "SIMPLib/FilterParameters/DataArrayCreationFilterParameter.h"
+#include "SIMPLib/FilterParameters/InputFileFilterParameter.h"
+#include "SIMPLib/FilterParameters/IntFilterParameter.h"
+
+#include "H5Support/H5ScopedSentinel.h"
+
+#ifdef SIMPLib_USE_PARALLEL_ALGORITHMS
+  #include <tbb/parallel_for.h>
+  #include <tbb/parallel_reduce.h>
+  #include <tbb/blocked_range.h>
+  #include <tbb/partitioner.h>
+  #include <tbb/task_scheduler_init.h>
+#endif
+
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <limits>
+#include <queue>
+#include <unordered_map>
+
+#include "DataFusion/DataFusionConstants.h"
+#include "DataFusion/DataFusionFilters/util/FeatureRelabel.h"
+#include "DataFusion/DataFusionFilters/util/H5SlabStream.h"
+#include "DataFusion/DataFusionFilters/util/KdTree.h"
+#include "DataFusion/DataFusionFilters/util/RowRuns.h"
+
+// Include the MOC generated file for this class
+#include "moc_MatchFeatureIds.cpp"
+
+namespace Detail
+{
+// similarity coefficient of a pair of features from their volumes and intersection (0: jaccard, 1: dice, 2: cosine)
+static float similarity(int metric, int64_t overlap, int64_t movingVolume, int64_t referenceVolume)
+{
+  //overlap within a neighborhood can exceed the volume of a thin feature
+  overlap = std::min(overlap, std::min(movingVolume, referenceVolume));
+  switch(metric)
+  {
+    case 0://jaccard
+      return (float)overlap/(movingVolume+referenceVolume-overlap);
+
+    case 1://dice
+      return (float)(2*overlap)/(movingVolume+referenceVolume);
+
+    case 2://cosine
+      return (float)overlap/sqrt(movingVolume*referenceVolume);
+  }
+  return 0.0f;
+}
+
+// custom class to holding pair data
+class OverlapPair {
+ public:
+  int referenceId;
+  int movingId;
+  float index;
+  //ties are broken by id so the order is total (sorting any subset of pairs gives the same relative order)
+  const bool operator< (const OverlapPair &other) const
+  {
+    if(index != other.index) return index < other.index;
+    if(movingId != other.movingId) return movingId < other.movingId;
+    return referenceId < other.referenceId;
+  }
+};
+
+// volumes of each feature from its overlapping pairs
+// volumes only count voxels where both ids are non zero, so every counted voxel belongs to exactly one pair and the volumes are the row and
+// column sums of the (sparse) intersections, found in one serial pass instead of dense per task arrays
+static void featureVolumes(const std::vector< std::pair<uint64_t, int64_t> >& intersections, size_t maxReferenceId, size_t maxMovingId, std::vector<int64_t>& referenceVolumes, std::vector<int64_t>& movingVolumes)
+{
+  referenceVolumes.assign(maxReferenceId, 0);
+  movingVolumes.assign(maxMovingId, 0);
+  for(size_t k = 0; k < intersections.size(); k++)
+  {
+    referenceVolumes[intersections[k].first & 0xFFFFFFFF] += intersections[k].second;
+    movingVolumes[intersections[k].first >> 32] += intersections[k].second;
+  }
+}
+
+// accumulates (sparse) pairwise intersections over a range of voxels
+// each parallel task gets its own map of the pairs it has seen, merged in join() (memory scales with the number of overlapping pairs, not features)
+class OverlapCounter
+{
+  public:
+    // pairs are keyed as moving id (high 32 bits) + reference id (low 32 bits) so that sorted keys are in moving-major order
+    typedef std::unordered_map<uint64_t, int64_t> PairMap;
+
+    OverlapCounter(const int32_t* referenceIds, const int32_t* movingIds) :
+      m_ReferenceIds(referenceIds),
+      m_MovingIds(movingIds)
+    {}
+
+    void count(size_t start, size_t end)
+    {
+      // neighboring voxels usually belong to the same pair, accumulate runs of the same pair and only hash once per run
+      uint64_t lastKey = 0;
+      int64_t runLength = 0;
+      for(size_t i = start; i < end; i++)
+      {
+        int32_t referenceId = m_ReferenceIds[i];
+        int32_t movingId = m_MovingIds[i];
+        if(referenceId > 0 && movingId > 0)
+        {
+          uint64_t key = (static_cast<uint64_t>(movingId) << 32) | static_cast<uint64_t>(referenceId);
+          if(key != lastKey)
+          {
+            if(runLength > 0) m_Intersections[lastKey] += runLength;
+            lastKey = key;
+            runLength = 0;
+          }
+          runLength++;
+        }
+      }
+      if(runLength > 0) m_Intersections[lastKey] += runLength;
+    }
+
+#ifdef SIMPLib_USE_PARALLEL_ALGORITHMS
+    OverlapCounter(OverlapCounter& other, tbb::split) :
+      m_ReferenceIds(other.m_ReferenceIds),
+      m_MovingIds(other.m_MovingIds)
+    {}
+
+    void operator()(const tbb::blocked_range<size_t>& r)
+    {
+      count(r.begin(), r.end());
+    }
+
+    void join(const OverlapCounter& other)
+    {
+      for(PairMap::const_iterator iter = other.m_Intersections.begin(); iter != other.m_Intersections.end(); ++iter)
+        m_Intersections[iter->first] += iter->second;
+    }
+#endif
+
+    // intersections as a list of (key, overlap) sorted by key (independent of how the voxels were split between tasks)
+    std::vector< std::pair<uint64_t, int64_t> > sortedIntersections() const
+    {
+      std::vector< std::pair<uint64_t, int64_t> > pairs(m_Intersections.begin(), m_Intersections.end());
+      std::sort(pairs.begin(), pairs.end());
+      return pairs;
+    }
+
+    // points the counter at a new block of voxels (counts keep accumulating)
+    void setIds(const int32_t* referenceIds, const int32_t* movingIds)
+    {
+      m_ReferenceIds = referenceIds;
+      m_MovingIds = movingIds;
+    }
+
+  private:
+    const int32_t* m_ReferenceIds;
+    const int32_t* m_MovingIds;
+    PairMap m_Intersections;
+};
+
+// axis aligned bounding boxes of every feature in a pair of volumes, found in one pass over the rows of both volumes
+// boxes are stored as min x, y, z, max x, y, z (inclusive) and features without voxels have min > max
+// all tasks grow the same boxes with atomic min / max, so there is nothing to merge and memory doesn't grow with the number of tasks
+class BoundingBoxFinder
+{
+  public:
+    BoundingBoxFinder(const RowRuns& referenceRuns, const RowRuns& movingRuns, size_t dimY, std::vector< std::atomic<int32_t> >& referenceBoxes, std::vector< std::atomic<int32_t> >& movingBoxes) :
+      m_ReferenceRuns(referenceRuns),
+      m_MovingRuns(movingRuns),
+      m_DimY(dimY),
+      m_ReferenceBoxes(referenceBoxes),
+      m_MovingBoxes(movingBoxes)
+    {
+      Initialize(m_ReferenceBoxes);
+      Initialize(m_MovingBoxes);
+    }
+
+    void find(size_t start, size_t end) const
+    {
+      for(size_t row = start; row < end; row++)
+      {
+        int32_t y = static_cast<int32_t>(row % m_DimY);
+        int32_t z = static_cast<int32_t>(row / m_DimY);
+        Update(m_ReferenceRuns.rowBegin(row), m_ReferenceRuns.rowEnd(row), y, z, m_ReferenceBoxes);
+        Update(m_MovingRuns.rowBegin(row), m_MovingRuns.rowEnd(row), y, z, m_MovingBoxes);
+      }
+    }
+
+#ifdef SIMPLib_USE_PARALLEL_ALGORITHMS
+    void operator()(const tbb::blocked_range<size_t>& r) const
+    {
+      find(r.begin(), r.end());
+    }
+#endif
+
+    // plain copy of boxes once all tasks are done
+    static std::vector<int32_t> Load(const std::vector< std::atomic<int32_t> >& boxes)
+    {
+      std::vector<int32_t> values(boxes.size());
+      for(size_t i = 0; i < boxes.size(); i++)
+        values[i] = boxes[i].load(std::memory_order_relaxed);
+      return values;
+    }
+
+  private:
+    static void Initialize(std::vector< std::atomic<int32_t> >& boxes)
+    {
+      for(size_t i = 0; i < boxes.size(); i += 6)
+      {
+        for(size_t j = 0; j < 3; j++)
+        {
+          boxes[i + j].store(std::numeric_limits<int32_t>::max(), std::memory_order_relaxed);
+          boxes[i + j + 3].store(-1, std::memory_order_relaxed);
+        }
+      }
+    }
+
+    // compare and swap only while the value would still shrink / grow, most runs don't change a box so most calls are a single load
+    static void AtomicMin(std::atomic<int32_t>& value, int32_t candidate)
+    {
+      int32_t current = value.load(std::memory_order_relaxed);
+      while(candidate < current && !value.compare_exchange_weak(current, candidate, std::memory_order_relaxed)) {}
+    }
+
+    static void AtomicMax(std::atomic<int32_t>& value, int32_t candidate)
+    {
+      int32_t current = value.load(std::memory_order_relaxed);
+      while(candidate > current && !value.compare_exchange_weak(current, candidate, std::memory_order_relaxed)) {}
+    }
+
+    // grows the boxes once per run of identical ids instead of once per voxel
+    static void Update(const RowRuns::Run* run, const RowRuns::Run* end, int32_t y, int32_t z, std::vector< std::atomic<int32_t> >& boxes)
+    {
+      for( ; run != end; ++run)
+      {
+        if(run->id > 0)
+        {
+          std::atomic<int32_t>* box = &boxes[6 * run->id];
+          AtomicMin(box[0], static_cast<int32_t>(run->begin));
+          AtomicMin(box[1], y);
+          AtomicMin(box[2], z);
+          AtomicMax(box[3], static_cast<int32_t>(run->end - 1));
+          AtomicMax(box[4], y);
+          AtomicMax(box[5], z);
+        }
+      }
+    }
+
+    const RowRuns& m_ReferenceRuns;
+    const RowRuns& m_MovingRuns;
+    size_t m_DimY;
+    std::vector< std::atomic<int32_t> >& m_ReferenceBoxes;
+    std::vector< std::atomic<int32_t> >& m_MovingBoxes;
+};
+
+// uniform grid over a set of bounding boxes (as found by BoundingBoxFinder) with every box listed in each cell it covers, so the boxes that
+// can intersect a query box are found by scanning only the cells the query box covers
+// cells are about the size of an average box so each box covers a few cells and each cell holds a few boxes
+class BoxGrid
+{
+  public:
+    BoxGrid(const std::vector<int32_t>& boxes) :
+      m_Boxes(boxes)
+    {
+      // cell size is the average extent of the boxes along each axis
+      const size_t numBoxes = boxes.size() / 6;
+      int64_t extents[3] = {0, 0, 0};
+      int64_t upper[3] = {1, 1, 1};
+      size_t count = 0;
+      for(size_t i = 1; i < numBoxes; i++)
+      {
+        const int32_t* box = &boxes[6 * i];
+        if(box[3] < 0) continue;
+        count++;
+        for(size_t j = 0; j < 3; j++)
+        {
+          extents[j] += box[j + 3] - box[j] + 1;
+          upper[j] = std::max<int64_t>(upper[j], box[j + 3] + 1);
+        }
+      }
+      for(size_t j = 0; j < 3; j++)
+        m_CellSize[j] = 0 == count ? upper[j] : std::max<int64_t>(1, extents[j] / static_cast<int64_t>(count));
+
+      // boxes of very different shapes can make the average cell much smaller than most boxes, coarsen until there are about as many cells as boxes
+      for(;;)
+      {
+        size_t numCells = 1;
+        for(size_t j = 0; j < 3; j++)
+        {
+          m_Dims[j] = static_cast<size_t>((upper[j] + m_CellSize[j] - 1) / m_CellSize[j]);
+          numCells *= m_Dims[j];
+        }
+        if(numCells <= 4 * count + 1) break;
+        for(size_t j = 0; j < 3; j++)
+          m_CellSize[j] *= 2;
+      }
+
+      // count the boxes in each cell, prefix sum, then list them
+      m_Offsets.assign(m_Dims[0] * m_Dims[1] * m_Dims[2] + 1, 0);
+      for(int pass = 0; pass < 2; pass++)
+      {
+        for(size_t i = 1; i < numBoxes; i++)
+        {
+          const int32_t* box = &boxes[6 * i];
+          if(box[3] < 0) continue;
+          size_t lower[3], higher[3];
+          cells(box, lower, higher);
+          for(size_t z = lower[2]; z <= higher[2]; z++)
+            for(size_t y = lower[1]; y <= higher[1]; y++)
+              for(size_t x = lower[0]; x <= higher[0]; x++)
+              {
+                const size_t c = (z * m_Dims[1] + y) * m_Dims[0] + x;
+                if(0 == pass)
+                  m_Offsets[c + 1]++;
+                else
+                  m_Ids[m_Offsets[c]++] = static_cast<int32_t>(i);
+              }
+        }
+        if(0 == pass)
+        {
+          for(size_t c = 1; c < m_Offsets.size(); c++)
+            m_Offsets[c] += m_Offsets[c - 1];
+          m_Ids.resize(m_Offsets.back());
+        }
+        else
+        {
+          // filling advanced each offset to the start of the next cell
+          for(size_t c = m_Offsets.size() - 1; c > 0; c--)
+            m_Offsets[c] = m_Offsets[c - 1];
+          m_Offsets[0] = 0;
+        }
+      }
+    }
+
+    // ids of the boxes intersecting a query box in increasing order
+    void intersecting(const int32_t* box, std::vector<int32_t>& ids) const
+    {
+      ids.clear();
+      size_t lower[3], higher[3];
+      cells(box, lower, higher);
+      for(size_t z = lower[2]; z <= higher[2]; z++)
+      {
+        for(size_t y = lower[1]; y <= higher[1]; y++)
+        {
+          for(size_t x = lower[0]; x <= higher[0]; x++)
+          {
+            const size_t c = (z * m_Dims[1] + y) * m_Dims[0] + x;
+            for(size_t k = m_Offsets[c]; k < m_Offsets[c + 1]; k++)
+            {
+              const int32_t* other = &m_Boxes[6 * m_Ids[k]];
+              bool intersect = true;
+              for(size_t j = 0; j < 3; j++)
+                if(other[j] > box[j + 3] || box[j] > other[j + 3]) intersect = false;
+              if(!intersect) continue;
+
+              // intersecting boxes share every cell their intersection covers, only report the pair from the cell holding its low corner
+              if(cell(std::max(box[0], other[0]), 0) != x || cell(std::max(box[1], other[1]), 1) != y || cell(std::max(box[2], other[2]), 2) != z) continue;
+              ids.push_back(m_Ids[k]);
+            }
+          }
+        }
+      }
+      std::sort(ids.begin(), ids.end());
+    }
+
+  private:
+    // cell holding a coordinate (coordinates past the grid fall in the edge cells)
+    size_t cell(int32_t value, size_t axis) const
+    {
+      if(value < 0) return 0;
+      return std::min(static_cast<size_t>(value / m_CellSize[axis]), m_Dims[axis] - 1);
+    }
+
+    void cells(const int32_t* box, size_t lower[3], size_t higher[3]) const
+    {
+      for(size_t j = 0; j < 3; j++)
+      {
+        lower[j] = cell(box[j], j);
+        higher[j] = cell(box[j + 3], j);
+      }
+    }
+
+    const std::vector<int32_t>& m_Boxes;
+    int64_t m_CellSize[3];
+    size_t m_Dims[3];
+    std::vector<size_t> m_Offsets;
+    std::vector<int32_t> m_Ids;
+};
+
+// finds the reference boxes intersecting each moving box, either counting them (first pass) or writing them at the moving id's offset (second pass)
+class CandidateFinder
+{
+  public:
+    CandidateFinder(const BoxGrid& grid, const std::vector<int32_t>& movingBoxes, std::vector<size_t>& offsets, std::vector<int32_t>* referenceIds) :
+      m_Grid(grid),
+      m_MovingBoxes(movingBoxes),
+      m_Offsets(offsets),
+      m_ReferenceIds(referenceIds)
+    {}
+
+    void find(size_t start, size_t end) const
+    {
+      std::vector<int32_t> ids;
+      for(size_t i = std::max<size_t>(start, 1); i < end; i++)
+      {
+        const int32_t* box = &m_MovingBoxes[6 * i];
+        if(box[3] < 0) continue;
+        m_Grid.intersecting(box, ids);
+        if(NULL == m_ReferenceIds)
+          m_Offsets[i + 1] = ids.size();
+        else
+          std::copy(ids.begin(), ids.end(), m_ReferenceIds->begin() + m_Offsets[i]);
+      }
+    }
+
+#ifdef SIMPLib_USE_PARALLEL_ALGORITHMS
+    void operator()(const tbb::blocked_range<size_t>& r) const
+    {
+      find(r.begin(), r.end());
+    }
+#endif
+
+  private:
+    const BoxGrid& m_Grid;
+    const std::vector<int32_t>& m_MovingBoxes;
+    std::vector<size_t>& m_Offsets;
+    std::vector<int32_t>* m_ReferenceIds;
+};
+
+// pairs of reference and moving features with intersecting bounding boxes stored in moving-major compressed rows (the reference ids paired
+// with moving id i are referenceIds[offsets[i]] through referenceIds[offsets[i + 1] - 1] in increasing order)
+// the reference boxes are binned in a grid and moving boxes are looked up in parallel (count, prefix sum, fill) so the work scales with the
+// number of features instead of the number of boxes active at once along a sweep
+class CandidatePairs
+{
+  public:
+    CandidatePairs(const std::vector<int32_t>& referenceBoxes, const std::vector<int32_t>& movingBoxes) :
+      m_Offsets(movingBoxes.size() / 6 + 1, 0)
+    {
+      BoxGrid grid(referenceBoxes);
+      const size_t numMoving = m_Offsets.size() - 1;
+      CandidateFinder counter(grid, movingBoxes, m_Offsets, NULL);
+#ifdef SIMPLib_USE_PARALLEL_ALGORITHMS
+      tbb::parallel_for(tbb::blocked_range<size_t>(0, numMoving), counter, tbb::auto_partitioner());
+#else
+      counter.find(0, numMoving);
+#endif
+      for(size_t i = 1; i < m_Offsets.size(); i++)
+        m_Offsets[i] += m_Offsets[i - 1];
+
+      m_ReferenceIds.resize(m_Offsets.back());
+      CandidateFinder writer(grid, movingBoxes, m_Offsets, &m_ReferenceIds);
+#ifdef SIMPLib_USE_PARALLEL_ALGORITHMS
+      tbb::parallel_for(tbb::blocked_range<size_t>(0, numMoving), writer, tbb::auto_partitioner());
+#else
+      writer.find(0, numMoving);
+#endif
+    }
+
+    size_t size() const {return m_ReferenceIds.size();}
+    size_t numMoving() const {return m_Offsets.size() - 1;}
+    size_t begin(size_t movingId) const {return m_Offsets[movingId];}
+    size_t end(size_t movingId) const {return m_Offsets[movingId + 1];}
+    int32_t referenceId(size_t k) const {return m_ReferenceIds[k];}
+
+    // index of a pair or size() if the pair isn't a candidate
+    size_t find(int32_t movingId, int32_t referenceId) const
+    {
+      if(movingId < 0 || static_cast<size_t>(movingId) >= numMoving()) return size();
+      std::vector<int32_t>::const_iterator last = m_ReferenceIds.begin() + m_Offsets[movingId + 1];
+      std::vector<int32_t>::const_iterator iter = std::lower_bound(m_ReferenceIds.begin() + m_Offsets[movingId], last, referenceId);
+      return (iter == last || *iter != referenceId) ? size() : iter - m_ReferenceIds.begin();
+    }
+
+  private:
+    std::vector<size_t> m_Offsets;
+    std::vector<int32_t> m_ReferenceIds;
+};
+
+// accumulates intersections like OverlapCounter but only for candidate pairs, so counts go into one flat array indexed by candidate that is
+// shared by all tasks (atomic adds) instead of a hash table per task, volumes follow from the intersections with featureVolumes()
+// rows are compared run against run, so the work per row scales with the number of runs instead of the number of voxels
+class CandidateOverlapCounter
+{
+  public:
+    CandidateOverlapCounter(const RowRuns& referenceRuns, const RowRuns& movingRuns, const CandidatePairs& candidates, std::atomic<int64_t>* intersections, std::atomic<int64_t>* missed) :
+      m_ReferenceRuns(referenceRuns),
+      m_MovingRuns(movingRuns),
+      m_Candidates(candidates),
+      m_Intersections(intersections),
+      m_Missed(missed)
+    {}
+
+    void count(size_t start, size_t end) const
+    {
+      for(size_t row = start; row < end; row++)
+      {
+        // both rows are covered by runs in order, step through them advancing whichever run ends first
+        const RowRuns::Run* reference = m_ReferenceRuns.rowBegin(row);
+        const RowRuns::Run* referenceEnd = m_ReferenceRuns.rowEnd(row);
+        const RowRuns::Run* moving = m_MovingRuns.rowBegin(row);
+        const RowRuns::Run* movingEnd = m_MovingRuns.rowEnd(row);
+        while(reference != referenceEnd && moving != movingEnd)
+        {
+          if(reference->id > 0 && moving->id > 0)
+          {
+            int64_t overlap = std::min(reference->end, moving->end) - std::max(reference->begin, moving->begin);
+            // features sharing a voxel always have intersecting boxes, a missing pair means the candidates are wrong so it is counted and reported
+            size_t k = m_Candidates.find(moving->id, reference->id);
+            if(k == m_Candidates.size())
+              m_Missed->fetch_add(overlap, std::memory_order_relaxed);
+            else
+              m_Intersections[k].fetch_add(overlap, std::memory_order_relaxed);
+          }
+          if(reference->end < moving->end)
+          {
+            ++reference;
+          }
+          else if(moving->end < reference->end)
+          {
+            ++moving;
+          }
+          else
+          {
+            ++reference;
+            ++moving;
+          }
+        }
+      }
+    }
+
+#ifdef SIMPLib_USE_PARALLEL_ALGORITHMS
+    void operator()(const tbb::blocked_range<size_t>& r) const
+    {
+      count(r.begin(), r.end());
+    }
+#endif
+
+    // candidates that actually overlap as a list of (key, overlap) sorted by key
+    static std::vector< std::pair<uint64_t, int64_t> > SortedIntersections(const CandidatePairs& candidates, const std::vector< std::atomic<int64_t> >& intersections)
+    {
+      std::vector< std::pair<uint64_t, int64_t> > pairs;
+      for(size_t i = 0; i < candidates.numMoving(); i++)
+      {
+        for(size_t k = candidates.begin(i); k < candidates.end(i); k++)
+        {
+          int64_t overlap = intersections[k].load(std::memory_order_relaxed);
+          if(overlap > 0)
+            pairs.push_back(std::make_pair((static_cast<uint64_t>(i) << 32) | static_cast<uint64_t>(candidates.referenceId(k)), overlap));
+        }
+      }
+      return pairs;
+    }
+
+  private:
+    const RowRuns& m_ReferenceRuns;
+    const RowRuns& m_MovingRuns;
+    const CandidatePairs& m_Candidates;
+    std::atomic<int64_t>* m_Intersections;
+    std::atomic<int64_t>* m_Missed;
+};
+
+// accumulates feature volumes and pairwise overlap where a moving voxel overlaps a reference feature if the feature is anywhere in the
+// (2 * radius + 1)^3 box around it, tolerating small misregistration
+// each row's neighborhood is the union of the neighboring rows' reference runs dilated along x, so the work per row scales with the number of
+// runs in (2 * radius + 1)^2 rows instead of the number of voxels in the box
+class DilatedOverlapCounter
+{
+  public:
+    typedef std::unordered_map<uint64_t, int64_t> PairMap;
+
+    DilatedOverlapCounter(const RowRuns& referenceRuns, const RowRuns& movingRuns, size_t dimY, size_t dimZ, int64_t radius, size_t maxReferenceId, size_t maxMovingId) :
+      m_ReferenceRuns(referenceRuns),
+      m_MovingRuns(movingRuns),
+      m_DimY(dimY),
+      m_DimZ(dimZ),
+      m_Radius(radius),
+      m_ReferenceVolumes(maxReferenceId, 0),
+      m_MovingVolumes(maxMovingId, 0)
+    {}
+
+    void count(size_t start, size_t end)
+    {
+      const int64_t rowLength = static_cast<int64_t>(m_ReferenceRuns.rowLength());
+      std::vector<RowRuns::Run> neighbors;
+      for(size_t row = start; row < end; row++)
+      {
+        const RowRuns::Run* movingBegin = m_MovingRuns.rowBegin(row);
+        const RowRuns::Run* movingEnd = m_MovingRuns.rowEnd(row);
+
+        // volumes are counted where both ids are non zero (the same as without dilation)
+        const RowRuns::Run* reference = m_ReferenceRuns.rowBegin(row);
+        const RowRuns::Run* referenceEnd = m_ReferenceRuns.rowEnd(row);
+        const RowRuns::Run* moving = movingBegin;
+        while(reference != referenceEnd && moving != movingEnd)
+        {
+          if(reference->id > 0 && moving->id > 0)
+          {
+            int64_t length = std::min(reference->end, moving->end) - std::max(reference->begin, moving->begin);
+            m_ReferenceVolumes[reference->id] += length;
+            m_MovingVolumes[moving->id] += length;
+          }
+          if(reference->end <= moving->end) ++reference;
+          else ++moving;
+        }
+
+        // gather the dilated reference runs of all neighboring rows and merge the intervals of each id
+        int64_t y = static_cast<int64_t>(row % m_DimY);
+        int64_t z = static_cast<int64_t>(row / m_DimY);
+        neighbors.clear();
+        for(int64_t nz = std::max<int64_t>(z - m_Radius, 0); nz <= std::min<int64_t>(z + m_Radius, m_DimZ - 1); nz++)
+        {
+          for(int64_t ny = std::max<int64_t>(y - m_Radius, 0); ny <= std::min<int64_t>(y + m_Radius, m_DimY - 1); ny++)
+          {
+            size_t neighborRow = static_cast<size_t>(nz) * m_DimY + static_cast<size_t>(ny);
+            for(const RowRuns::Run* run = m_ReferenceRuns.rowBegin(neighborRow); run != m_ReferenceRuns.rowEnd(neighborRow); ++run)
+            {
+              if(run->id <= 0) continue;
+              RowRuns::Run dilated;
+              dilated.id = run->id;
+              dilated.begin = std::max<int64_t>(run->begin - m_Radius, 0);
+              dilated.end = std::min<int64_t>(run->end + m_Radius, rowLength);
+              neighbors.push_back(dilated);
+            }
+          }
+        }
+        std::sort(neighbors.begin(), neighbors.end());
+        size_t numMerged = 0;
+        for(size_t i = 0; i < neighbors.size(); i++)
+        {
+          if(numMerged > 0 && neighbors[numMerged - 1].id == neighbors[i].id && neighbors[i].begin <= neighbors[numMerged - 1].end)
+            neighbors[numMerged - 1].end = std::max(neighbors[numMerged - 1].end, neighbors[i].end);
+          else
+            neighbors[numMerged++] = neighbors[i];
+        }
+
+        // intersect each merged interval with the moving runs of this row
+        for(size_t i = 0; i < numMerged; i++)
+        {
+          const RowRuns::Run& interval = neighbors[i];
+          const RowRuns::Run* run = std::upper_bound(movingBegin, movingEnd, interval.begin, EndsAfter);
+          for(; run != movingEnd && run->begin < interval.end; ++run)
+          {
+            if(run->id <= 0) continue;
+            uint64_t key = (static_cast<uint64_t>(run->id) << 32) | static_cast<uint64_t>(interval.id);
+            m_Intersections[key] += std::min(interval.end, run->end) - std::max(interval.begin, run->begin);
+          }
+        }
+      }
+    }
+
+#ifdef SIMPLib_USE_PARALLEL_ALGORITHMS
+    DilatedOverlapCounter(DilatedOverlapCounter& other, tbb::split) :
+      m_ReferenceRuns(other.m_ReferenceRuns),
+      m_MovingRuns(other.m_MovingRuns),
+      m_DimY(other.m_DimY),
+      m_DimZ(other.m_DimZ),
+      m_Radius(other.m_Radius),
+      m_ReferenceVolumes(other.m_ReferenceVolumes.size(), 0),
+      m_MovingVolumes(other.m_MovingVolumes.size(), 0)
+    {}
+
+    void operator()(const tbb::blocked_range<size_t>& r)
+    {
+      count(r.begin(), r.end());
+    }
+
+    void join(const DilatedOverlapCounter& other)
+    {
+      for(size_t i = 0; i < m_ReferenceVolumes.size(); i++)
+        m_ReferenceVolumes[i] += other.m_ReferenceVolumes[i];
+      for(size_t i = 0; i < m_MovingVolumes.size(); i++)
+        m_MovingVolumes[i] += other.m_MovingVolumes[i];
+      for(PairMap::const_iterator iter = other.m_Intersections.begin(); iter != other.m_Intersections.end(); ++iter)
+        m_Intersections[iter->first] += iter->second;
+    }
+#endif
+
+    std::vector< std::pair<uint64_t, int64_t> > sortedIntersections() const
+    {
+      std::vector< std::pair<uint64_t, int64_t> > pairs(m_Intersections.begin(), m_Intersections.end());
+      std::sort(pairs.begin(), pairs.end());
+      return pairs;
+    }
+
+    const std::vector<int64_t>& referenceVolumes() const {return m_ReferenceVolumes;}
+    const std::vector<int64_t>& movingVolumes() const {return m_MovingVolumes;}
+
+  private:
+    static bool EndsAfter(int64_t x, const RowRuns::Run& run) {return x < run.end;}
+
+    const RowRuns& m_ReferenceRuns;
+    const RowRuns& m_MovingRuns;
+    size_t m_DimY;
+    size_t m_DimZ;
+    int64_t m_Radius;
+    std::vector<int64_t> m_ReferenceVolumes;
+    std::vector<int64_t> m_MovingVolumes;
+    PairMap m_Intersections;
+};
+
+// maximum weight matching of a sparse bipartite graph using successive shortest augmenting paths (Jonker-Volgenant style, Dijkstra on reduced costs)
+// moving features are rows, reference features are columns, every row also has a private zero cost column so it may stay unmatched
+// only the edges of the overlap graph are stored and each augmentation only explores columns reachable from the new row
+class SparseAssignment
+{
+  public:
+    // returns the indices of the assigned pairs
+    static std::vector<size_t> solve(const OverlapPair* pairs, size_t numPairs)
+    {
+      std::vector<size_t> assigned;
+      if(0 == numPairs) return assigned;
+
+      //compact feature ids to local row (moving) and column (reference) indices
+      std::vector<int> rowIds, colIds;
+      rowIds.reserve(numPairs);
+      colIds.reserve(numPairs);
+      for(size_t i = 0; i < numPairs; i++)
+      {
+        rowIds.push_back(pairs[i].movingId);
+        colIds.push_back(pairs[i].referenceId);
+      }
+      std::sort(rowIds.begin(), rowIds.end());
+      rowIds.erase(std::unique(rowIds.begin(), rowIds.end()), rowIds.end());
+      std::sort(colIds.begin(), colIds.end());
+      colIds.erase(std::unique(colIds.begin(), colIds.end()), colIds.end());
+      const size_t numRows = rowIds.size();
+      const size_t numRealCols = colIds.size();
+      const size_t numCols = numRealCols + numRows;//column numRealCols + i is the 'unmatched' column of row i
+
+      //build compressed adjacency list for rows (cost is negative similarity)
+      std::vector<size_t> offsets(numRows + 1, 0);
+      std::vector<size_t> pairRow(numPairs);
+      for(size_t i = 0; i < numPairs; i++)
+      {
+        pairRow[i] = std::lower_bound(rowIds.begin(), rowIds.end(), pairs[i].movingId) - rowIds.begin();
+        offsets[pairRow[i] + 1]++;
+      }
+      for(size_t i = 0; i < numRows; i++)
+        offsets[i + 1] += offsets[i] + 1;//+1 for unmatched column
+      std::vector<size_t> edgeCol(offsets[numRows]), edgePair(offsets[numRows]);
+      std::vector<double> edgeCost(offsets[numRows]);
+      std::vector<size_t> fill(offsets.begin(), offsets.end() - 1);
+      for(size_t i = 0; i < numRows; i++)
+      {
+        size_t e = fill[i]++;
+        edgeCol[e] = numRealCols + i;
+        edgePair[e] = kNone;
+        edgeCost[e] = 0.0;
+      }
+      for(size_t i = 0; i < numPairs; i++)
+      {
+        size_t e = fill[pairRow[i]]++;
+        edgeCol[e] = std::lower_bound(colIds.begin(), colIds.end(), pairs[i].referenceId) - colIds.begin();
+        edgePair[e] = i;
+        edgeCost[e] = -static_cast<double>(pairs[i].index);
+      }
+
+      //dual variables and current assignment
+      std::vector<double> u(numRows, 0.0), v(numCols, 0.0);
+      std::vector<size_t> col4row(numRows, kNone), row4col(numCols, kNone), edge4row(numRows, kNone);
+
+      //workspace for shortest path search (only touched entries are reset)
+      const double inf = std::numeric_limits<double>::infinity();
+      std::vector<double> shortest(numCols, inf);
+      std::vector<size_t> path(numCols, kNone), pathEdge(numCols, kNone);
+      std::vector<char> scannedCol(numCols, 0);
+      std::vector<size_t> touchedCols, scannedRows, scannedCols;
+      typedef std::pair<double, size_t> QueueEntry;
+
+      for(size_t cur = 0; cur < numRows; cur++)
+      {
+        std::priority_queue<QueueEntry, std::vector<QueueEntry>, std::greater<QueueEntry> > queue;
+        double minVal = 0.0;
+        size_t i = cur;
+        size_t sink = kNone;
+        while(kNone == sink)
+        {
+          //relax edges out of row i
+          scannedRows.push_back(i);
+          for(size_t e = offsets[i]; e < offsets[i + 1]; e++)
+          {
+            size_t j = edgeCol[e];
+            if(scannedCol[j]) continue;
+            double r = minVal + edgeCost[e] - u[i] - v[j];
+            if(r < shortest[j])
+            {
+              if(inf == shortest[j]) touchedCols.push_back(j);
+              shortest[j] = r;
+              path[j] = i;
+              pathEdge[j] = e;
+              queue.push(QueueEntry(r, j));
+            }
+          }
+
+          //closest unscanned column (the unmatched column of the new row is always reachable so the queue can't run dry)
+          size_t j = kNone;
+          while(kNone == j)
+          {
+            QueueEntry entry = queue.top();
+            queue.pop();
+            if(!scannedCol[entry.second] && entry.first == shortest[entry.second]) j = entry.second;
+          }
+          minVal = shortest[j];
+          scannedCol[j] = 1;
+          scannedCols.push_back(j);
+          if(kNone == row4col[j])
+            sink = j;
+          else
+            i = row4col[j];
+        }
+
+        //update dual variables
+        u[cur] += minVal;
+        for(size_t k = 0; k < scannedRows.size(); k++)
+        {
+          size_t row = scannedRows[k];
+          if(row != cur) u[row] += minVal - shortest[col4row[row]];
+        }
+        for(size_t k = 0; k < scannedCols.size(); k++)
+        {
+          size_t col = scannedCols[k];
+          v[col] -= minVal - shortest[col];
+        }
+
+        //augment along the alternating path
+        size_t j = sink;
+        while(true)
+        {
+          size_t row = path[j];
+          row4col[j] = row;
+          edge4row[row] = pathEdge[j];
+          std::swap(col4row[row], j);
+          if(row == cur) break;
+        }
+
+        //reset workspace
+        for(size_t k = 0; k < touchedCols.size(); k++)
+        {
+          shortest[touchedCols[k]] = inf;
+          scannedCol[touchedCols[k]] = 0;
+        }
+        touchedCols.clear();
+        scannedRows.clear();
+        scannedCols.clear();
+      }
+
+      //convert assignment back to pairs (skipping rows left unmatched)
+      for(size_t i = 0; i < numRows; i++)
+      {
+        if(kNone != edgePair[edge4row[i]])
+          assigned.push_back(edgePair[edge4row[i]]);
+      }
+      return assigned;
+    }
+
+  private:
+    static const size_t kNone;
+};
+const size_t SparseAssignment::kNone = static_cast<size_t>(-1);
+
+// computes the misorientation angle of every candidate pair
+// symmetry operators are stored as structure of arrays (padded to a multiple of 8 with duplicates of the identity) so the inner loop vectorizes
+class MisorientationCalculator
+{
+  public:
+    MisorientationCalculator(const std::vector<OverlapPair>& pairs, const float* referenceQuats, const float* movingQuats, const int32_t* referencePhases, const unsigned int* referenceCrystalStructures, const std::vector< std::vector<float> >& symOps, float* misorientations) :
+      m_Pairs(pairs),
+      m_ReferenceQuats(referenceQuats),
+      m_MovingQuats(movingQuats),
+      m_ReferencePhases(referencePhases),
+      m_ReferenceCrystalStructures(referenceCrystalStructures),
+      m_SymOps(symOps),
+      m_Misorientations(misorientations)
+    {}
+
+    // builds the padded structure of arrays symmetry operators for all crystal structures: {w0..wn, x0..xn, y0..yn, z0..zn}
+    static std::vector< std::vector<float> > BuildSymOps(QVector<SpaceGroupOps::Pointer> orientationOps)
+    {
+      std::vector< std::vector<float> > symOps(orientationOps.size());
+      for(int i = 0; i < orientationOps.size(); i++)
+      {
+        int numOps = orientationOps[i]->getNumSymOps();
+        int paddedOps = 8 * ((numOps + 7) / 8);
+        symOps[i].resize(4 * paddedOps);
+        for(int j = 0; j < paddedOps; j++)
+        {
+          QuatF symQuat;
+          orientationOps[i]->getQuatSymOp(j < numOps ? j : 0, symQuat);
+          symOps[i][j] = symQuat.w;
+          symOps[i][paddedOps + j] = symQuat.x;
+          symOps[i][2 * paddedOps + j] = symQuat.y;
+          symOps[i][3 * paddedOps + j] = symQuat.z;
+        }
+      }
+      return symOps;
+    }
+
+    void compute(size_t start, size_t end) const
+    {
+      const QuatF* referenceQuats = reinterpret_cast<const QuatF*>(m_ReferenceQuats);
+      const QuatF* movingQuats = reinterpret_cast<const QuatF*>(m_MovingQuats);
+      for(size_t i = start; i < end; i++)
+      {
+        //pairs with different reference and moving crystal structures were dropped while building pairs, so the reference structure is shared
+        unsigned int xtal = m_ReferenceCrystalStructures[m_ReferencePhases[m_Pairs[i].referenceId]];
+        if(Ebsd::CrystalStructure::UnknownCrystalStructure == xtal || xtal >= m_SymOps.size())
+        {
+          m_Misorientations[i] = std::numeric_limits<float>::infinity();
+          continue;
+        }
+
+        //delta = reference * moving^-1 (the same convention as LaueOps::getMisoQuat(reference, moving, ...))
+        QuatF gRef, gMovInv, delta;
+        QuaternionMathF::Copy(referenceQuats[m_Pairs[i].referenceId], gRef);
+        QuaternionMathF::Copy(movingQuats[m_Pairs[i].movingId], gMovInv);
+        QuaternionMathF::Conjugate(gMovInv);
+        QuaternionMathF::Multiply(gRef, gMovInv, delta);
+
+        //largest |w| of delta * symmetry operator gives the smallest rotation angle
+        const size_t numOps = m_SymOps[xtal].size() / 4;
+        const float* sw = &m_SymOps[xtal][0];
+        const float* sx = sw + numOps;
+        const float* sy = sx + numOps;
+        const float* sz = sy + numOps;
+        float cosMax = 0.0f;
+        for(size_t j = 0; j < numOps; j++)
+        {
+          float cosAngle = fabs(delta.w * sw[j] - delta.x * sx[j] - delta.y * sy[j] - delta.z * sz[j]);
+          cosMax = cosAngle > cosMax ? cosAngle : cosMax;
+        }
+        m_Misorientations[i] = 2.0f * acos(std::min(cosMax, 1.0f));
+      }
+    }
+
+#ifdef SIMPLib_USE_PARALLEL_ALGORITHMS
+    void operator()(const tbb::blocked_range<size_t>& r) const
+    {
+      compute(r.begin(), r.end());
+    }
+#endif
+
+  private:
+    const std::vector<OverlapPair>& m_Pairs;
+    const float* m_ReferenceQuats;
+    const float* m_MovingQuats;
+    const int32_t* m_ReferencePhases;
+    const unsigned int* m_ReferenceCrystalStructures;
+    const std::vector< std::vector<float> >& m_SymOps;
+    float* m_Misorientations;
+};
+
+// finds the reference features near each moving feature with a kd tree of reference centroids
+// candidates are scored by 1 - distance / radius (times the ratio of equivalent diameters if available)
+class CentroidPairFinder
+{
+  public:
+    CentroidPairFinder(const KdTree<float>& referenceTree, const float* movingPositions, float radius, const float* referenceDiameters, const float* movingDiameters, std::vector< std::vector< std::pair<uint64_t, float> > >& candidates) :
+      m_ReferenceTree(referenceTree),
+      m_MovingPositions(movingPositions),
+      m_Radius(radius),
+      m_ReferenceDiameters(referenceDiameters),
+      m_MovingDiameters(movingDiameters),
+      m_Candidates(candidates)
+    {}
+
+    void find(size_t start, size_t end) const
+    {
+      std::vector< std::pair<float, size_t> > neighbors;
+      for(size_t i = std::max<size_t>(start, 1); i < end; i++)
+      {
+        m_ReferenceTree.radiusSearch(m_MovingPositions + 3 * i, m_Radius, neighbors);
+        for(size_t k = 0; k < neighbors.size(); k++)
+        {
+          size_t j = neighbors[k].second;
+          if(0 == j) continue;
+          float score = 1.0f - sqrt(neighbors[k].first) / m_Radius;
+          if(NULL != m_ReferenceDiameters)
+          {
+            float larger = std::max(m_ReferenceDiameters[j], m_MovingDiameters[i]);
+            score *= larger > 0.0f ? std::min(m_ReferenceDiameters[j], m_MovingDiameters[i]) / larger : 0.0f;
+          }
+          uint64_t key = (static_cast<uint64_t>(i) << 32) | static_cast<uint64_t>(j);
+          m_Candidates[i].push_back(std::make_pair(key, score));
+        }
+        std::sort(m_Candidates[i].begin(), m_Candidates[i].end());
+      }
+    }
+
+#ifdef SIMPLib_USE_PARALLEL_ALGORITHMS
+    void operator()(const tbb::blocked_range<size_t>& r) const
+    {
+      find(r.begin(), r.end());
+    }
+#endif
+
+  private:
+    const KdTree<float>& m_ReferenceTree;
+    const float* m_MovingPositions;
+    float m_Radius;
+    const float* m_ReferenceDiameters;
+    const float* m_MovingDiameters;
+    std::vector< std::vector< std::pair<uint64_t, float> > >& m_Candidates;
+};
+
+// disjoint set forest (union by size + path halving) used to split the overlap graph into independent clusters
+class UnionFind
+{
+  public:
+    UnionFind(size_t size) : m_Parent(size), m_Size(size, 1)
+    {
+      for(size_t i = 0; i < size; i++)
+        m_Parent[i] = i;
+    }
+
+    size_t find(size_t i)
+    {
+      while(m_Parent[i] != i)
+      {
+        m_Parent[i] = m_Parent[m_Parent[i]];
+        i = m_Parent[i];
+      }
+      return i;
+    }
 
-#include "DataFusion/DataFusionConstants.h"
+    void merge(size_t i, size_t j)
+    {
+      i = find(i);
+      j = find(j);
+      if(i == j) return;
+      if(m_Size[i] < m_Size[j]) std::swap(i, j);
+      m_Parent[j] = i;
+      m_Size[i] += m_Size[j];
+    }
 
-// Include the MOC generated file for this class
-#include "moc_MatchFeatureIds.cpp"
+  private:
+    std::vector<size_t> m_Parent;
+    std::vector<size_t> m_Size;
+};
 
-namespace Detail
+// matches the pairs of each connected component of the overlap graph independently
+// components share no features so they can be solved concurrently without synchronization
+class ComponentMatcher
 {
-// custom class to holding pair data
-class OverlapPair {
- public:
-  int referenceId;
-  int movingId;
-  float index;
-  const bool operator< (const OverlapPair &other) const {return index < other.index;}
+  public:
+    ComponentMatcher(std::vector<OverlapPair>& pairs, const std::vector<size_t>& componentOffsets, const std::vector<size_t>& componentMaxMatches, int method, size_t* idMap, bool* referenceUnique, bool* movingUnique, float* overlap) :
+      m_Pairs(pairs),
+      m_ComponentOffsets(componentOffsets),
+      m_ComponentMaxMatches(componentMaxMatches),
+      m_Method(method),
+      m_IdMap(idMap),
+      m_ReferenceUnique(referenceUnique),
+      m_MovingUnique(movingUnique),
+      m_Overlap(overlap)
+    {}
+
+    void match(size_t start, size_t end) const
+    {
+      for(size_t c = start; c < end; c++)
+      {
+        OverlapPair* pairs = &m_Pairs[m_ComponentOffsets[c]];
+        size_t numPairs = m_ComponentOffsets[c + 1] - m_ComponentOffsets[c];
+        if(0 == m_Method)
+        {
+          // assign grains by overlap (most overlap first), pairs are pulled from a heap so only the pairs that are visited get ordered
+          // once every grain on the smaller side of the component is matched the remaining pairs can't be assigned
+          std::make_heap(pairs, pairs + numPairs);
+          size_t numMatched = 0;
+          for(size_t i = numPairs; i > 0 && numMatched < m_ComponentMaxMatches[c]; i--)
+          {
+            std::pop_heap(pairs, pairs + i);
+            const OverlapPair& pair = pairs[i - 1];
+            if(m_ReferenceUnique[pair.referenceId] && m_MovingUnique[pair.movingId])
+            {
+              assign(pair);
+              numMatched++;
+            }
+          }
+        }
+        else
+        {
+          // assign grains to maximize the total similarity of all matched pairs
+          std::vector<size_t> assignedPairs = SparseAssignment::solve(pairs, numPairs);
+          for(size_t i = 0; i < assignedPairs.size(); i++)
+            assign(pairs[assignedPairs[i]]);
+        }
+      }
+    }
+
+#ifdef SIMPLib_USE_PARALLEL_ALGORITHMS
+    void operator()(const tbb::blocked_range<size_t>& r) const
+    {
+      match(r.begin(), r.end());
+    }
+#endif
+
+  private:
+    void assign(const OverlapPair& pair) const
+    {
+      m_IdMap[pair.movingId] = pair.referenceId;
+      m_ReferenceUnique[pair.referenceId] = false;
+      m_MovingUnique[pair.movingId] = false;
+      m_Overlap[pair.movingId] = pair.index;
+    }
+
+    std::vector<OverlapPair>& m_Pairs;
+    const std::vector<size_t>& m_ComponentOffsets;
+    const std::vector<size_t>& m_ComponentMaxMatches;
+    int m_Method;
+    size_t* m_IdMap;
+    bool* m_ReferenceUnique;
+    bool* m_MovingUnique;
+    float* m_Overlap;
 };
 }
 
@@ -58,6 +1155,21 @@ MatchFeatureIds::MatchFeatureIds() :
   m_MovingCellFeatureAttributeMatrixPath(DREAM3D::Defaults::VolumeDataContainerName, DREAM3D::Defaults::CellFeatureAttributeMatrixName, ""),
   m_ReferenceFeatureIdsArrayPath(DREAM3D::Defaults::VolumeDataContainerName, DREAM3D::Defaults::CellAttributeMatrixName, DREAM3D::CellData::FeatureIds),
   m_MovingFeatureIdsArrayPath(DREAM3D::Defaults::VolumeDataContainerName, DREAM3D::Defaults::CellAttributeMatrixName, DREAM3D::CellData::FeatureIds),
+  m_CorrespondenceSource(0),
+  m_ReferenceCentroidsArrayPath(DREAM3D::Defaults::VolumeDataContainerName, DREAM3D::Defaults::CellFeatureAttributeMatrixName, DREAM3D::FeatureData::Centroids),
+  m_MovingCentroidsArrayPath(DREAM3D::Defaults::VolumeDataContainerName, DREAM3D::Defaults::CellFeatureAttributeMatrixName, DREAM3D::FeatureData::Centroids),
+  m_CentroidTolerance(1.0),
+  m_UseDiameters(false),
+  m_ReferenceDiametersArrayPath(DREAM3D::Defaults::VolumeDataContainerName, DREAM3D::Defaults::CellFeatureAttributeMatrixName, DREAM3D::FeatureData::EquivalentDiameters),
+  m_MovingDiametersArrayPath(DREAM3D::Defaults::VolumeDataContainerName, DREAM3D::Defaults::CellFeatureAttributeMatrixName, DREAM3D::FeatureData::EquivalentDiameters),
+  m_UseTransformation(false),
+  m_TransformationArrayPath(DREAM3D::Defaults::VolumeDataContainerName, DataFusionConstants::Transformation, DataFusionConstants::Transformation),
+  m_UseDilation(false),
+  m_DilationRadius(1),
+  m_UseStreaming(false),
+  m_StreamingFilePath(""),
+  m_SlabThickness(16),
+  m_RewriteInPlace(false),
   m_ReferenceQuatsArrayPath(DREAM3D::Defaults::VolumeDataContainerName, DREAM3D::Defaults::CellFeatureAttributeMatrixName, DREAM3D::FeatureData::AvgQuats),
   m_MovingQuatsArrayPath(DREAM3D::Defaults::VolumeDataContainerName, DREAM3D::Defaults::CellFeatureAttributeMatrixName, DREAM3D::FeatureData::AvgQuats),
   m_ReferencePhasesArrayPath(DREAM3D::Defaults::VolumeDataContainerName, DREAM3D::Defaults::CellFeatureAttributeMatrixName, DREAM3D::FeatureData::Phases),
@@ -67,10 +1179,20 @@ MatchFeatureIds::MatchFeatureIds() :
   m_OverlapArrayName(DataFusionConstants::SimilarityCoefficient),
   m_ReferenceUniqueArrayName(DataFusionConstants::UniqueFeatures),
   m_MovingUniqueArrayName(DataFusionConstants::UniqueFeatures),
+  m_ReferenceCorrespondencesArrayName(DataFusionConstants::CorrespondingFeatures),
+  m_MovingCorrespondencesArrayName(DataFusionConstants::CorrespondingFeatures),
+  m_ReferenceGroupIdsArrayName(DataFusionConstants::CorrespondenceGroups),
+  m_MovingGroupIdsArrayName(DataFusionConstants::CorrespondenceGroups),
   m_Metric(1),
   m_MetricThreshold(0.5),
+  m_MatchingMethod(0),
   m_UseOrientations(false),
   m_OrientationTolerance(5.0),
+  m_DetectSplitsMerges(false),
+  m_ContainmentThreshold(0.75),
+  m_ExportOverlapTable(false),
+  m_OverlapTableAttributeMatrixName(DataFusionConstants::FeaturePairs),
+  m_OverlapTableOffsetsArrayName(DataFusionConstants::FeaturePairOffsets),
   m_Overlap(NULL),
   m_ReferenceUnique(NULL),
   m_MovingUnique(NULL),
@@ -81,7 +1203,21 @@ MatchFeatureIds::MatchFeatureIds() :
   m_ReferencePhases(NULL),
   m_MovingPhases(NULL),
   m_ReferenceCrystalStructures(NULL),
-  m_MovingCrystalStructures(NULL)
+  m_MovingCrystalStructures(NULL),
+  m_ReferenceCentroids(NULL),
+  m_MovingCentroids(NULL),
+  m_ReferenceDiameters(NULL),
+  m_MovingDiameters(NULL),
+  m_Transformation(NULL),
+  m_ReferenceGroupIds(NULL),
+  m_MovingGroupIds(NULL),
+  m_PairReferenceIds(NULL),
+  m_PairMovingIds(NULL),
+  m_PairVoxelCounts(NULL),
+  m_PairMetric(NULL),
+  m_OverlapTableOffsets(NULL),
+  m_ReferenceCache(NULL),
+  m_MovingCache(NULL)
 {
   m_OrientationOps = SpaceGroupOps::getOrientationOpsQVector();
   setupFilterParameters();
@@ -101,8 +1237,52 @@ void MatchFeatureIds::setupFilterParameters()
 {
   FilterParameterVector parameters;
   DataArraySelectionFilterParameter::RequirementType req;
+  {
+    QVector<QString> choices;
+    choices.push_back("Voxel Overlap");
+    choices.push_back("Feature Centroids");
+    QStringList linkedProps;
+    linkedProps << "ReferenceFeatureIdsArrayPath" << "ReferenceCentroidsArrayPath" << "MovingCentroidsArrayPath" << "CentroidTolerance";
+    LinkedChoicesFilterParameter::Pointer parameter = LinkedChoicesFilterParameter::New();
+    parameter->setHumanLabel("Correspondence Source");
+    parameter->setPropertyName("CorrespondenceSource");
+    parameter->setChoices(choices);
+    parameter->setLinkedProperties(linkedProps);
+    parameter->setCategory(FilterParameter::Parameter);
+    parameters.push_back(parameter);
+  }
   parameters.push_back(DataArraySelectionFilterParameter::New("Reference Feature Ids", "ReferenceFeatureIdsArrayPath", getReferenceFeatureIdsArrayPath(), FilterParameter::RequiredArray, req));
+  parameters.back()->setGroupIndex(0);
   parameters.push_back(DataArraySelectionFilterParameter::New("Moving Feature Ids", "MovingFeatureIdsArrayPath", getMovingFeatureIdsArrayPath(), FilterParameter::RequiredArray, req));
+  parameters.push_back(DataArraySelectionFilterParameter::New("Reference Centroids", "ReferenceCentroidsArrayPath", getReferenceCentroidsArrayPath(), FilterParameter::RequiredArray, req));
+  parameters.back()->setGroupIndex(1);
+  parameters.push_back(DataArraySelectionFilterParameter::New("Moving Centroids", "MovingCentroidsArrayPath", getMovingCentroidsArrayPath(), FilterParameter::RequiredArray, req));
+  parameters.back()->setGroupIndex(1);
+  parameters.push_back(DoubleFilterParameter::New("Search Radius", "CentroidTolerance", getCentroidTolerance(), FilterParameter::Parameter));
+  parameters.back()->setGroupIndex(1);
+
+  QStringList diameterProps;
+  diameterProps<<"ReferenceDiametersArrayPath"<<"MovingDiametersArrayPath";
+  parameters.push_back(LinkedBooleanFilterParameter::New("Compare Equivalent Diameters", "UseDiameters", getUseDiameters(), diameterProps, FilterParameter::Parameter));
+  parameters.push_back(DataArraySelectionFilterParameter::New("Reference Equivalent Diameters", "ReferenceDiametersArrayPath", getReferenceDiametersArrayPath(), FilterParameter::RequiredArray, req));
+  parameters.push_back(DataArraySelectionFilterParameter::New("Moving Equivalent Diameters", "MovingDiametersArrayPath", getMovingDiametersArrayPath(), FilterParameter::RequiredArray, req));
+
+  QStringList transformationProps;
+  transformationProps<<"TransformationArrayPath";
+  parameters.push_back(LinkedBooleanFilterParameter::New("Transform Moving Centroids", "UseTransformation", getUseTransformation(), transformationProps, FilterParameter::Parameter));
+  parameters.push_back(DataArraySelectionFilterParameter::New("Transformation", "TransformationArrayPath", getTransformationArrayPath(), FilterParameter::RequiredArray, req));
+
+  QStringList dilationProps;
+  dilationProps<<"DilationRadius";
+  parameters.push_back(LinkedBooleanFilterParameter::New("Count Overlap Within Neighborhood", "UseDilation", getUseDilation(), dilationProps, FilterParameter::Parameter));
+  parameters.push_back(IntFilterParameter::New("Neighborhood Radius (voxels)", "DilationRadius", getDilationRadius(), FilterParameter::Parameter));
+
+  QStringList streamingProps;
+  streamingProps<<"StreamingFilePath"<<"SlabThickness"<<"RewriteInPlace";
+  parameters.push_back(LinkedBooleanFilterParameter::New("Stream Feature Ids From File", "UseStreaming", getUseStreaming(), streamingProps, FilterParameter::Parameter));
+  parameters.push_back(InputFileFilterParameter::New("Feature Ids File", "StreamingFilePath", getStreamingFilePath(), FilterParameter::Parameter, "*.dream3d", "DREAM3D File"));
+  parameters.push_back(IntFilterParameter::New("Slab Thickness (slices)", "SlabThickness", getSlabThickness(), FilterParameter::Parameter));
+  parameters.push_back(BooleanFilterParameter::New("Renumber Feature Ids In Place", "RewriteInPlace", getRewriteInPlace(), FilterParameter::Parameter));
 
   AttributeMatrixSelectionFilterParameter::RequirementType amReq;
   parameters.push_back(AttributeMatrixSelectionFilterParameter::New("Reference Cell Feature Attribute Matrix", "ReferenceCellFeatureAttributeMatrixPath", getReferenceCellFeatureAttributeMatrixPath(), FilterParameter::RequiredArray, amReq));
@@ -121,6 +1301,18 @@ void MatchFeatureIds::setupFilterParameters()
 
   parameters.push_back(DoubleFilterParameter::New("Minimum Metric Value", "MetricThreshold", getMetricThreshold(), FilterParameter::Parameter));
 
+  {
+    QVector<QString> choices;
+    choices.push_back("Greedy");
+    choices.push_back("Optimal");
+    ChoiceFilterParameter::Pointer parameter = ChoiceFilterParameter::New();
+    parameter->setHumanLabel("Matching Method");
+    parameter->setPropertyName("MatchingMethod");
+    parameter->setChoices(choices);
+    parameter->setCategory(FilterParameter::Parameter);
+    parameters.push_back(parameter);
+  }
+
   parameters.push_back(StringFilterParameter::New("Matched Similarity Coefficient", "OverlapArrayName", getOverlapArrayName(), FilterParameter::CreatedArray));
   parameters.push_back(StringFilterParameter::New("Reference Unique Grains", "ReferenceUniqueArrayName", getReferenceUniqueArrayName(), FilterParameter::CreatedArray));
   parameters.push_back(StringFilterParameter::New("Moving Unique Grains", "MovingUniqueArrayName", getMovingUniqueArrayName(), FilterParameter::CreatedArray));
@@ -138,6 +1330,21 @@ void MatchFeatureIds::setupFilterParameters()
 
   parameters.push_back(DataArraySelectionFilterParameter::New("Reference Features Crystal Structures", "ReferenceCrystalStructuresArrayPath", getReferenceCrystalStructuresArrayPath(), FilterParameter::RequiredArray, req));
   parameters.push_back(DataArraySelectionFilterParameter::New("Moving Features Crystal Structures", "MovingCrystalStructuresArrayPath", getMovingCrystalStructuresArrayPath(), FilterParameter::RequiredArray, req));
+
+  linkedProps.clear();
+  linkedProps<<"ContainmentThreshold"<<"ReferenceCorrespondencesArrayName"<<"MovingCorrespondencesArrayName"<<"ReferenceGroupIdsArrayName"<<"MovingGroupIdsArrayName";
+  parameters.push_back(LinkedBooleanFilterParameter::New("Detect Splits and Merges", "DetectSplitsMerges", getDetectSplitsMerges(), linkedProps, FilterParameter::Parameter));
+  parameters.push_back(DoubleFilterParameter::New("Minimum Contained Fraction", "ContainmentThreshold", getContainmentThreshold(), FilterParameter::Parameter));
+  parameters.push_back(StringFilterParameter::New("Reference Corresponding Features", "ReferenceCorrespondencesArrayName", getReferenceCorrespondencesArrayName(), FilterParameter::CreatedArray));
+  parameters.push_back(StringFilterParameter::New("Moving Corresponding Features", "MovingCorrespondencesArrayName", getMovingCorrespondencesArrayName(), FilterParameter::CreatedArray));
+  parameters.push_back(StringFilterParameter::New("Reference Correspondence Groups", "ReferenceGroupIdsArrayName", getReferenceGroupIdsArrayName(), FilterParameter::CreatedArray));
+  parameters.push_back(StringFilterParameter::New("Moving Correspondence Groups", "MovingGroupIdsArrayName", getMovingGroupIdsArrayName(), FilterParameter::CreatedArray));
+
+  linkedProps.clear();
+  linkedProps<<"OverlapTableAttributeMatrixName"<<"OverlapTableOffsetsArrayName";
+  parameters.push_back(LinkedBooleanFilterParameter::New("Export Overlap Table", "ExportOverlapTable", getExportOverlapTable(), linkedProps, FilterParameter::Parameter));
+  parameters.push_back(StringFilterParameter::New("Feature Pair Attribute Matrix", "OverlapTableAttributeMatrixName", getOverlapTableAttributeMatrixName(), FilterParameter::CreatedArray));
+  parameters.push_back(StringFilterParameter::New("Reference Feature Pair Offsets", "OverlapTableOffsetsArrayName", getOverlapTableOffsetsArrayName(), FilterParameter::CreatedArray));
   setFilterParameters(parameters);
 }
 
@@ -149,11 +1356,27 @@ void MatchFeatureIds::readFilterParameters(AbstractFilterParametersReader* reade
   reader->openFilterGroup(this, index);
   setReferenceFeatureIdsArrayPath( reader->readDataArrayPath( "ReferenceFeatureIdsArrayPath", getReferenceFeatureIdsArrayPath() ) );
   setMovingFeatureIdsArrayPath( reader->readDataArrayPath( "MovingFeatureIdsArrayPath", getMovingFeatureIdsArrayPath() ) );
+  setCorrespondenceSource( reader->readValue("CorrespondenceSource", getCorrespondenceSource() ) );
+  setReferenceCentroidsArrayPath( reader->readDataArrayPath( "ReferenceCentroidsArrayPath", getReferenceCentroidsArrayPath() ) );
+  setMovingCentroidsArrayPath( reader->readDataArrayPath( "MovingCentroidsArrayPath", getMovingCentroidsArrayPath() ) );
+  setCentroidTolerance( reader->readValue("CentroidTolerance", getCentroidTolerance() ) );
+  setUseDiameters( reader->readValue("UseDiameters", getUseDiameters() ) );
+  setReferenceDiametersArrayPath( reader->readDataArrayPath( "ReferenceDiametersArrayPath", getReferenceDiametersArrayPath() ) );
+  setMovingDiametersArrayPath( reader->readDataArrayPath( "MovingDiametersArrayPath", getMovingDiametersArrayPath() ) );
+  setUseTransformation( reader->readValue("UseTransformation", getUseTransformation() ) );
+  setTransformationArrayPath( reader->readDataArrayPath( "TransformationArrayPath", getTransformationArrayPath() ) );
+  setUseDilation( reader->readValue("UseDilation", getUseDilation() ) );
+  setDilationRadius( reader->readValue("DilationRadius", getDilationRadius() ) );
+  setUseStreaming( reader->readValue("UseStreaming", getUseStreaming() ) );
+  setStreamingFilePath( reader->readString("StreamingFilePath", getStreamingFilePath() ) );
+  setSlabThickness( reader->readValue("SlabThickness", getSlabThickness() ) );
+  setRewriteInPlace( reader->readValue("RewriteInPlace", getRewriteInPlace() ) );
   setReferenceCellFeatureAttributeMatrixPath( reader->readDataArrayPath("ReferenceCellFeatureAttributeMatrixPath", getReferenceCellFeatureAttributeMatrixPath() ) );
   setMovingCellFeatureAttributeMatrixPath( reader->readDataArrayPath("MovingCellFeatureAttributeMatrixPath", getMovingCellFeatureAttributeMatrixPath() ) );
 
   setMetric( reader->readValue("Metric", getMetric()) );
   setMetricThreshold( reader->readValue("MetricThreshold", getMetricThreshold() ) );
+  setMatchingMethod( reader->readValue("MatchingMethod", getMatchingMethod() ) );
   setReferenceUniqueArrayName( reader->readString("ReferenceUniqueArrayName", getReferenceUniqueArrayName() ) );
   setMovingUniqueArrayName( reader->readString("MovingUniqueArrayName", getMovingUniqueArrayName() ) );
 
@@ -166,6 +1389,17 @@ void MatchFeatureIds::readFilterParameters(AbstractFilterParametersReader* reade
   setMovingPhasesArrayPath( reader->readDataArrayPath( "MovingPhasesArrayPath", getMovingPhasesArrayPath() ) );
   setMovingCrystalStructuresArrayPath( reader->readDataArrayPath( "MovingCrystalStructuresArrayPath", getMovingCrystalStructuresArrayPath() ) );
 
+  setDetectSplitsMerges(reader->readValue("DetectSplitsMerges", getDetectSplitsMerges() ) );
+  setContainmentThreshold(reader->readValue("ContainmentThreshold", getContainmentThreshold() ) );
+  setReferenceCorrespondencesArrayName( reader->readString("ReferenceCorrespondencesArrayName", getReferenceCorrespondencesArrayName() ) );
+  setMovingCorrespondencesArrayName( reader->readString("MovingCorrespondencesArrayName", getMovingCorrespondencesArrayName() ) );
+  setReferenceGroupIdsArrayName( reader->readString("ReferenceGroupIdsArrayName", getReferenceGroupIdsArrayName() ) );
+  setMovingGroupIdsArrayName( reader->readString("MovingGroupIdsArrayName", getMovingGroupIdsArrayName() ) );
+
+  setExportOverlapTable(reader->readValue("ExportOverlapTable", getExportOverlapTable() ) );
+  setOverlapTableAttributeMatrixName( reader->readString("OverlapTableAttributeMatrixName", getOverlapTableAttributeMatrixName() ) );
+  setOverlapTableOffsetsArrayName( reader->readString("OverlapTableOffsetsArrayName", getOverlapTableOffsetsArrayName() ) );
+
   reader->closeFilterGroup();
 }
 
@@ -178,11 +1412,27 @@ int MatchFeatureIds::writeFilterParameters(AbstractFilterParametersWriter* write
   SIMPL_FILTER_WRITE_PARAMETER(FilterVersion)
   SIMPL_FILTER_WRITE_PARAMETER(ReferenceFeatureIdsArrayPath)
   SIMPL_FILTER_WRITE_PARAMETER(MovingFeatureIdsArrayPath)
+  SIMPL_FILTER_WRITE_PARAMETER(CorrespondenceSource)
+  SIMPL_FILTER_WRITE_PARAMETER(ReferenceCentroidsArrayPath)
+  SIMPL_FILTER_WRITE_PARAMETER(MovingCentroidsArrayPath)
+  SIMPL_FILTER_WRITE_PARAMETER(CentroidTolerance)
+  SIMPL_FILTER_WRITE_PARAMETER(UseDiameters)
+  SIMPL_FILTER_WRITE_PARAMETER(ReferenceDiametersArrayPath)
+  SIMPL_FILTER_WRITE_PARAMETER(MovingDiametersArrayPath)
+  SIMPL_FILTER_WRITE_PARAMETER(UseTransformation)
+  SIMPL_FILTER_WRITE_PARAMETER(TransformationArrayPath)
+  SIMPL_FILTER_WRITE_PARAMETER(UseDilation)
+  SIMPL_FILTER_WRITE_PARAMETER(DilationRadius)
+  SIMPL_FILTER_WRITE_PARAMETER(UseStreaming)
+  SIMPL_FILTER_WRITE_PARAMETER(StreamingFilePath)
+  SIMPL_FILTER_WRITE_PARAMETER(SlabThickness)
+  SIMPL_FILTER_WRITE_PARAMETER(RewriteInPlace)
   SIMPL_FILTER_WRITE_PARAMETER(ReferenceCellFeatureAttributeMatrixPath)
   SIMPL_FILTER_WRITE_PARAMETER(MovingCellFeatureAttributeMatrixPath)
 
   SIMPL_FILTER_WRITE_PARAMETER(Metric)
   SIMPL_FILTER_WRITE_PARAMETER(MetricThreshold)
+  SIMPL_FILTER_WRITE_PARAMETER(MatchingMethod)
   SIMPL_FILTER_WRITE_PARAMETER(OverlapArrayName)
   SIMPL_FILTER_WRITE_PARAMETER(ReferenceUniqueArrayName)
   SIMPL_FILTER_WRITE_PARAMETER(MovingUniqueArrayName)
@@ -195,6 +1445,17 @@ int MatchFeatureIds::writeFilterParameters(AbstractFilterParametersWriter* write
   SIMPL_FILTER_WRITE_PARAMETER(MovingQuatsArrayPath)
   SIMPL_FILTER_WRITE_PARAMETER(MovingPhasesArrayPath)
   SIMPL_FILTER_WRITE_PARAMETER(MovingCrystalStructuresArrayPath)
+
+  SIMPL_FILTER_WRITE_PARAMETER(DetectSplitsMerges)
+  SIMPL_FILTER_WRITE_PARAMETER(ContainmentThreshold)
+  SIMPL_FILTER_WRITE_PARAMETER(ReferenceCorrespondencesArrayName)
+  SIMPL_FILTER_WRITE_PARAMETER(MovingCorrespondencesArrayName)
+  SIMPL_FILTER_WRITE_PARAMETER(ReferenceGroupIdsArrayName)
+  SIMPL_FILTER_WRITE_PARAMETER(MovingGroupIdsArrayName)
+
+  SIMPL_FILTER_WRITE_PARAMETER(ExportOverlapTable)
+  SIMPL_FILTER_WRITE_PARAMETER(OverlapTableAttributeMatrixName)
+  SIMPL_FILTER_WRITE_PARAMETER(OverlapTableOffsetsArrayName)
   writer->closeFilterGroup();
   return ++index; // we want to return the next index that was just written to
 }
@@ -219,15 +1480,109 @@ void MatchFeatureIds::dataCheck()
     notifyErrorMessage(getHumanLabel(), "'Moving Cell Feature Attribute Matrix' and 'Reference Cell Feature Attribute Matrix' must be different", -1001);
   if(getErrorCondition() < 0) return;
 
+  //options that need voxel level overlap
+  bool useCentroids = 1 == getCorrespondenceSource();
+  if(useCentroids)
+  {
+    if(getUseStreaming())
+      notifyErrorMessage(getHumanLabel(), "'Stream Feature Ids From File' requires the 'Voxel Overlap' correspondence source", -1009);
+    if(getDetectSplitsMerges())
+      notifyErrorMessage(getHumanLabel(), "'Detect Splits and Merges' requires the 'Voxel Overlap' correspondence source", -1009);
+    if(getExportOverlapTable())
+      notifyErrorMessage(getHumanLabel(), "'Export Overlap Table' requires the 'Voxel Overlap' correspondence source", -1009);
+    if(getUseDilation())
+      notifyErrorMessage(getHumanLabel(), "'Count Overlap Within Neighborhood' requires the 'Voxel Overlap' correspondence source", -1009);
+    if(getCentroidTolerance() <= 0.0)
+      notifyErrorMessage(getHumanLabel(), "'Search Radius' must be positive", -1010);
+    if(getErrorCondition() < 0) return;
+  }
+
+  if(getUseDilation())
+  {
+    //slabs would need to share a halo of neighboring slices
+    if(getUseStreaming())
+      notifyErrorMessage(getHumanLabel(), "'Count Overlap Within Neighborhood' can't be combined with 'Stream Feature Ids From File'", -1009);
+    if(getDilationRadius() < 1)
+      notifyErrorMessage(getHumanLabel(), "'Neighborhood Radius' must be at least 1", -1012);
+    if(getErrorCondition() < 0) return;
+  }
+
   //required arrays
   QVector<size_t> dims(1, 1);
-  m_ReferenceFeatureIdsPtr = getDataContainerArray()->getPrereqArrayFromPath<DataArray<int32_t>, AbstractFilter>(this, getReferenceFeatureIdsArrayPath(), dims);
-  if( NULL != m_ReferenceFeatureIdsPtr.lock().get() )
-  { m_ReferenceFeatureIds = m_ReferenceFeatureIdsPtr.lock()->getPointer(0); }
+  if(getUseStreaming())
+  {
+    //feature ids stay on disk, only check that both arrays exist in the file and have the same size
+    if(!QFileInfo(getStreamingFilePath()).exists())
+    {
+      QString ss = QObject::tr("The feature ids file '%1' does not exist").arg(getStreamingFilePath());
+      notifyErrorMessage(getHumanLabel(), ss, -1003);
+      return;
+    }
+    if(getSlabThickness() < 1)
+    {
+      notifyErrorMessage(getHumanLabel(), "'Slab Thickness' must be at least 1", -1004);
+      return;
+    }
+    hid_t fileId = H5Fopen(getStreamingFilePath().toLatin1().data(), H5F_ACC_RDONLY, H5P_DEFAULT);
+    if(fileId < 0)
+    {
+      QString ss = QObject::tr("Unable to open the feature ids file '%1'").arg(getStreamingFilePath());
+      notifyErrorMessage(getHumanLabel(), ss, -1003);
+      return;
+    }
+    H5ScopedFileSentinel sentinel(&fileId, true);
+    H5SlabStream referenceStream, movingStream;
+    if(!referenceStream.open(fileId, H5SlabStream::datasetPath(getReferenceFeatureIdsArrayPath())))
+    {
+      setErrorCondition(-1005);
+      notifyErrorMessage(getHumanLabel(), "'Reference Feature Ids' could not be found as a 32 bit integer array in the feature ids file", getErrorCondition());
+    }
+    else if(!movingStream.open(fileId, H5SlabStream::datasetPath(getMovingFeatureIdsArrayPath())))
+    {
+      setErrorCondition(-1005);
+      notifyErrorMessage(getHumanLabel(), "'Moving Feature Ids' could not be found as a 32 bit integer array in the feature ids file", getErrorCondition());
+    }
+    else if(referenceStream.dimensions() != movingStream.dimensions())
+    {
+      setErrorCondition(-1006);
+      notifyErrorMessage(getHumanLabel(), "'Moving Feature Ids' and 'Reference Feature Ids' must have the same dimensions", getErrorCondition());
+    }
+
+    //HDF5 never reuses the space of the replaced array
+    if(!getRewriteInPlace())
+      notifyWarningMessage(getHumanLabel(), "Each run adds the size of 'Moving Feature Ids' to the feature ids file (repack it with h5repack to reclaim the space) unless the ids are renumbered in place", 1);
+  }
+  else
+  {
+    //reference ids are only needed to compute overlap (moving ids are always relabeled)
+    if(!useCentroids)
+    {
+      m_ReferenceFeatureIdsPtr = getDataContainerArray()->getPrereqArrayFromPath<DataArray<int32_t>, AbstractFilter>(this, getReferenceFeatureIdsArrayPath(), dims);
+      if( NULL != m_ReferenceFeatureIdsPtr.lock().get() )
+      { m_ReferenceFeatureIds = m_ReferenceFeatureIdsPtr.lock()->getPointer(0); }
+    }
+
+    m_MovingFeatureIdsPtr = getDataContainerArray()->getPrereqArrayFromPath<DataArray<int32_t>, AbstractFilter>(this, getMovingFeatureIdsArrayPath(), dims);
+    if( NULL != m_MovingFeatureIdsPtr.lock().get() )
+    { m_MovingFeatureIds = m_MovingFeatureIdsPtr.lock()->getPointer(0); }
+  }
 
-  m_MovingFeatureIdsPtr = getDataContainerArray()->getPrereqArrayFromPath<DataArray<int32_t>, AbstractFilter>(this, getMovingFeatureIdsArrayPath(), dims);
-  if( NULL != m_MovingFeatureIdsPtr.lock().get() )
-  { m_MovingFeatureIds = m_MovingFeatureIdsPtr.lock()->getPointer(0); }
+  //neighborhoods are defined by the grid of the feature ids
+  if(getUseDilation() && getErrorCondition() >= 0)
+  {
+    IGeometry::Pointer geom = getDataContainerArray()->getDataContainer(getMovingFeatureIdsArrayPath().getDataContainerName())->getGeometry();
+    if(NULL == geom.get() || DREAM3D::GeometryType::ImageGeometry != geom->getGeometryType())
+    {
+      notifyErrorMessage(getHumanLabel(), "Rectilinear grid geometry required for 'Moving Feature Ids'", -390);
+    }
+    else
+    {
+      size_t udims[3] = { 0, 0, 0 };
+      getDataContainerArray()->getDataContainer(getMovingFeatureIdsArrayPath().getDataContainerName())->getGeometryAs<ImageGeom>()->getDimensions(udims);
+      if(udims[0] * udims[1] * udims[2] != m_MovingFeatureIdsPtr.lock()->getNumberOfTuples() || m_ReferenceFeatureIdsPtr.lock()->getNumberOfTuples() != m_MovingFeatureIdsPtr.lock()->getNumberOfTuples())
+        notifyErrorMessage(getHumanLabel(), "'Moving Feature Ids' and 'Reference Feature Ids' must both have one value per voxel of the moving geometry", -1013);
+    }
+  }
 
   if(getReferenceFeatureIdsArrayPath() == getMovingCellFeatureAttributeMatrixPath())
     notifyErrorMessage(getHumanLabel(), "'Moving Feature Ids' and 'Reference Feature Ids' must be different", -1001);
@@ -269,6 +1624,62 @@ void MatchFeatureIds::dataCheck()
   }
   if(getErrorCondition() < 0) return;
 
+  if(useCentroids)
+  {
+    dims[0] = 3;
+    QVector<DataArrayPath> referenceDataArrayPaths, movingDataArrayPaths;
+    m_ReferenceCentroidsPtr = getDataContainerArray()->getPrereqArrayFromPath<DataArray<float>, AbstractFilter>(this, getReferenceCentroidsArrayPath(), dims);
+    if( NULL != m_ReferenceCentroidsPtr.lock().get() )
+    { m_ReferenceCentroids = m_ReferenceCentroidsPtr.lock()->getPointer(0); }
+    if(getErrorCondition() >= 0) { referenceDataArrayPaths.push_back(getReferenceCentroidsArrayPath()); }
+
+    m_MovingCentroidsPtr = getDataContainerArray()->getPrereqArrayFromPath<DataArray<float>, AbstractFilter>(this, getMovingCentroidsArrayPath(), dims);
+    if( NULL != m_MovingCentroidsPtr.lock().get() )
+    { m_MovingCentroids = m_MovingCentroidsPtr.lock()->getPointer(0); }
+    if(getErrorCondition() >= 0) { movingDataArrayPaths.push_back(getMovingCentroidsArrayPath()); }
+    if(getErrorCondition() < 0) return;
+
+    //centroids are relative to the origin of their geometry
+    IGeometry::Pointer referenceGeom = getDataContainerArray()->getDataContainer(getReferenceCentroidsArrayPath().getDataContainerName())->getGeometry();
+    IGeometry::Pointer movingGeom = getDataContainerArray()->getDataContainer(getMovingCentroidsArrayPath().getDataContainerName())->getGeometry();
+    if(NULL == referenceGeom.get() || DREAM3D::GeometryType::ImageGeometry != referenceGeom->getGeometryType())
+      notifyErrorMessage(getHumanLabel(), "Rectilinear grid geometry required for 'Reference Centroids'", -390);
+    if(NULL == movingGeom.get() || DREAM3D::GeometryType::ImageGeometry != movingGeom->getGeometryType())
+      notifyErrorMessage(getHumanLabel(), "Rectilinear grid geometry required for 'Moving Centroids'", -390);
+
+    dims[0] = 1;
+    if(getUseDiameters())
+    {
+      m_ReferenceDiametersPtr = getDataContainerArray()->getPrereqArrayFromPath<DataArray<float>, AbstractFilter>(this, getReferenceDiametersArrayPath(), dims);
+      if( NULL != m_ReferenceDiametersPtr.lock().get() )
+      { m_ReferenceDiameters = m_ReferenceDiametersPtr.lock()->getPointer(0); }
+      if(getErrorCondition() >= 0) { referenceDataArrayPaths.push_back(getReferenceDiametersArrayPath()); }
+
+      m_MovingDiametersPtr = getDataContainerArray()->getPrereqArrayFromPath<DataArray<float>, AbstractFilter>(this, getMovingDiametersArrayPath(), dims);
+      if( NULL != m_MovingDiametersPtr.lock().get() )
+      { m_MovingDiameters = m_MovingDiametersPtr.lock()->getPointer(0); }
+      if(getErrorCondition() >= 0) { movingDataArrayPaths.push_back(getMovingDiametersArrayPath()); }
+    }
+
+    if(getUseTransformation())
+    {
+      QVector<size_t> transDims(2, 4);//4x4 array
+      m_TransformationPtr = getDataContainerArray()->getPrereqArrayFromPath<DataArray<float>, AbstractFilter>(this, getTransformationArrayPath(), transDims);
+      if( NULL != m_TransformationPtr.lock().get() )
+      { m_Transformation = m_TransformationPtr.lock()->getPointer(0); }
+    }
+    getDataContainerArray()->validateNumberOfTuples<AbstractFilter>(this, referenceDataArrayPaths);
+    getDataContainerArray()->validateNumberOfTuples<AbstractFilter>(this, movingDataArrayPaths);
+    if(getErrorCondition() < 0) return;
+
+    //one entry per feature
+    if(m_ReferenceCentroidsPtr.lock()->getNumberOfTuples() != refCellFeatAttrMat->getNumTuples())
+      notifyErrorMessage(getHumanLabel(), "'Reference Centroids' must have one tuple per reference feature", -1011);
+    if(m_MovingCentroidsPtr.lock()->getNumberOfTuples() != moveCellFeatAttrMat->getNumTuples())
+      notifyErrorMessage(getHumanLabel(), "'Moving Centroids' must have one tuple per moving feature", -1011);
+  }
+  if(getErrorCondition() < 0) return;
+
   //created arrays
   DataArrayPath tempPath;
   tempPath.update(getMovingCellFeatureAttributeMatrixPath().getDataContainerName(), getMovingCellFeatureAttributeMatrixPath().getAttributeMatrixName(), getOverlapArrayName() );
@@ -285,6 +1696,57 @@ void MatchFeatureIds::dataCheck()
   m_MovingUniquePtr = getDataContainerArray()->createNonPrereqArrayFromPath<DataArray<bool>, AbstractFilter, bool>(this, tempPath, 0, dims);
   if( NULL != m_MovingUniquePtr.lock().get() )
   { m_MovingUnique = m_MovingUniquePtr.lock()->getPointer(0); }
+
+  if(getDetectSplitsMerges())
+  {
+    if(getContainmentThreshold() <= 0.0 || getContainmentThreshold() > 1.0)
+    {
+      notifyErrorMessage(getHumanLabel(), "'Minimum Contained Fraction' must be in (0, 1]", -1002);
+      return;
+    }
+
+    tempPath.update(getReferenceCellFeatureAttributeMatrixPath().getDataContainerName(), getReferenceCellFeatureAttributeMatrixPath().getAttributeMatrixName(), getReferenceCorrespondencesArrayName() );
+    m_ReferenceCorrespondences = getDataContainerArray()->createNonPrereqArrayFromPath<NeighborList<int32_t>, AbstractFilter, int32_t>(this, tempPath, 0, dims);
+
+    tempPath.update(getMovingCellFeatureAttributeMatrixPath().getDataContainerName(), getMovingCellFeatureAttributeMatrixPath().getAttributeMatrixName(), getMovingCorrespondencesArrayName() );
+    m_MovingCorrespondences = getDataContainerArray()->createNonPrereqArrayFromPath<NeighborList<int32_t>, AbstractFilter, int32_t>(this, tempPath, 0, dims);
+
+    tempPath.update(getReferenceCellFeatureAttributeMatrixPath().getDataContainerName(), getReferenceCellFeatureAttributeMatrixPath().getAttributeMatrixName(), getReferenceGroupIdsArrayName() );
+    m_ReferenceGroupIdsPtr = getDataContainerArray()->createNonPrereqArrayFromPath<DataArray<int32_t>, AbstractFilter, int32_t>(this, tempPath, 0, dims);
+    if( NULL != m_ReferenceGroupIdsPtr.lock().get() )
+    { m_ReferenceGroupIds = m_ReferenceGroupIdsPtr.lock()->getPointer(0); }
+
+    tempPath.update(getMovingCellFeatureAttributeMatrixPath().getDataContainerName(), getMovingCellFeatureAttributeMatrixPath().getAttributeMatrixName(), getMovingGroupIdsArrayName() );
+    m_MovingGroupIdsPtr = getDataContainerArray()->createNonPrereqArrayFromPath<DataArray<int32_t>, AbstractFilter, int32_t>(this, tempPath, 0, dims);
+    if( NULL != m_MovingGroupIdsPtr.lock().get() )
+    { m_MovingGroupIds = m_MovingGroupIdsPtr.lock()->getPointer(0); }
+  }
+  if(getErrorCondition() < 0) return;
+
+  if(getExportOverlapTable())
+  {
+    //the number of overlapping pairs isn't known until the volumes are compared
+    QVector<size_t> tDims(1, 0);
+    QString dcName = getMovingCellFeatureAttributeMatrixPath().getDataContainerName();
+    DataContainer::Pointer m = getDataContainerArray()->getPrereqDataContainer<AbstractFilter>(this, dcName);
+    if(getErrorCondition() < 0) return;
+    m->createNonPrereqAttributeMatrix<AbstractFilter>(this, getOverlapTableAttributeMatrixName(), tDims, DREAM3D::AttributeMatrixType::Generic);
+    if(getErrorCondition() < 0) return;
+
+    tempPath.update(dcName, getOverlapTableAttributeMatrixName(), DataFusionConstants::ReferenceIds);
+    m_PairReferenceIdsPtr = getDataContainerArray()->createNonPrereqArrayFromPath<DataArray<int32_t>, AbstractFilter, int32_t>(this, tempPath, 0, dims);
+    tempPath.update(dcName, getOverlapTableAttributeMatrixName(), DataFusionConstants::MovingIds);
+    m_PairMovingIdsPtr = getDataContainerArray()->createNonPrereqArrayFromPath<DataArray<int32_t>, AbstractFilter, int32_t>(this, tempPath, 0, dims);
+    tempPath.update(dcName, getOverlapTableAttributeMatrixName(), DataFusionConstants::VoxelCounts);
+    m_PairVoxelCountsPtr = getDataContainerArray()->createNonPrereqArrayFromPath<DataArray<int64_t>, AbstractFilter, int64_t>(this, tempPath, 0, dims);
+    tempPath.update(dcName, getOverlapTableAttributeMatrixName(), DataFusionConstants::SimilarityCoefficient);
+    m_PairMetricPtr = getDataContainerArray()->createNonPrereqArrayFromPath<DataArray<float>, AbstractFilter, float>(this, tempPath, 0, dims);
+
+    tempPath.update(getReferenceCellFeatureAttributeMatrixPath().getDataContainerName(), getReferenceCellFeatureAttributeMatrixPath().getAttributeMatrixName(), getOverlapTableOffsetsArrayName() );
+    m_OverlapTableOffsetsPtr = getDataContainerArray()->createNonPrereqArrayFromPath<DataArray<int64_t>, AbstractFilter, int64_t>(this, tempPath, 0, dims);
+    if( NULL != m_OverlapTableOffsetsPtr.lock().get() )
+    { m_OverlapTableOffsets = m_OverlapTableOffsetsPtr.lock()->getPointer(0); }
+  }
 }
 
 // -----------------------------------------------------------------------------
@@ -312,19 +1774,10 @@ void MatchFeatureIds::execute()
 
   if (getCancel() == true) { return; }
 
-  int64_t totalPoints = m_ReferenceFeatureIdsPtr.lock()->getNumberOfTuples();
-  QuatF* reference_quats = reinterpret_cast<QuatF*>(m_ReferenceQuats);
-  QuatF* moving_quats = reinterpret_cast<QuatF*>(m_MovingQuats);
-
   int maxReferenceId = m_ReferenceUniquePtr.lock()->getNumberOfTuples();
   int maxMovingId = m_MovingUniquePtr.lock()->getNumberOfTuples();
 
-  // create array to hold grain overlaps (ignoring grain 0)
-  std::vector<int> intersections(maxReferenceId * maxMovingId, 0);
-
-  // create arrays to hold grain volumes
-  std::vector<int> referenceVolumes(maxReferenceId, 0);
-  std::vector<int> movingVolumes(maxMovingId, 0);//initially everything but grain 0 unique (no grains have been matched)
+  //initially everything but grain 0 unique (no grains have been matched)
   m_ReferenceUnique[0] = false;
   m_MovingUnique[0] = false;
   m_Overlap[0] = false;
@@ -338,117 +1791,299 @@ void MatchFeatureIds::execute()
     m_Overlap[i] = 0;
   }
 
-  // loop over volume finding intersections and volumes
-  for(int i=0; i<totalPoints; i++)
+#ifdef SIMPLib_USE_PARALLEL_ALGORITHMS
+  tbb::task_scheduler_init init;
+#endif
+  bool doParallel = true;
+
+  // when streaming the feature ids are read from (and later written back to) the file one slab at a time
+  hid_t fileId = -1;
+  H5ScopedFileSentinel sentinel(&fileId, true);
+  H5SlabStream referenceStream, movingStream;
+  std::vector<int32_t> referenceSlab, movingSlab;
+  size_t slabThickness = static_cast<size_t>(m_SlabThickness);
+  size_t totalPoints = 0;
+  if(m_UseStreaming)
   {
-    int referenceId = m_ReferenceFeatureIds[i];
-    int movingId = m_MovingFeatureIds[i];
-    if(referenceId>0 && movingId>0)
+    fileId = H5Fopen(m_StreamingFilePath.toLatin1().data(), H5F_ACC_RDWR, H5P_DEFAULT);
+    if(fileId < 0 || !referenceStream.open(fileId, H5SlabStream::datasetPath(m_ReferenceFeatureIdsArrayPath)) || !movingStream.open(fileId, H5SlabStream::datasetPath(m_MovingFeatureIdsArrayPath)))
     {
-      referenceId--;
-      movingId--;
-      referenceVolumes[referenceId]++;
-      movingVolumes[movingId]++;
-      intersections[movingId*maxReferenceId+referenceId]++;
+      setErrorCondition(-1003);
+      QString ss = QObject::tr("Unable to open the feature ids in '%1' for reading and writing").arg(m_StreamingFilePath);
+      notifyErrorMessage(getHumanLabel(), ss, getErrorCondition());
+      return;
     }
+    slabThickness = std::min(slabThickness, referenceStream.numSlices());
+    referenceSlab.resize(slabThickness * referenceStream.sliceSize());
+    movingSlab.resize(slabThickness * movingStream.sliceSize());
+  }
+  else
+  {
+    totalPoints = m_MovingFeatureIdsPtr.lock()->getNumberOfTuples();
   }
 
-  // compute selected metric for each pair of overlapping grains
-  std::vector<Detail::OverlapPair> featureOverlaps;
-  for(int i=0; i<maxMovingId; i++)
+  // candidate pairs keyed as moving id << 32 | reference id with their voxel overlap (or centroid score) sorted by key
+  std::vector<int64_t> referenceVolumes, movingVolumes;
+  std::vector< std::pair<uint64_t, int64_t> > intersections;
+  std::vector< std::pair<uint64_t, float> > centroidPairs;
+
+  // in memory voxel overlap is counted from run length encoded rows (kept to relabel the moving ids)
+  // volumes that aren't on an image geometry have no rows to split between threads, so they are counted voxel by voxel instead
+  // the reference runs come from the cache of the previous match when one is provided
+  RowRuns encodedReferenceRuns, movingRuns;
+  bool cachedReference = false;
+  bool imageRows = false;
+  size_t udims[3] = { totalPoints, 1, 1 };
+  if(0 == m_CorrespondenceSource && !m_UseStreaming)
+  {
+    notifyStatusMessage(getHumanLabel(), "Encoding feature ids");
+    imageRows = RowRuns::GridDimensions(getDataContainerArray()->getDataContainer(getMovingFeatureIdsArrayPath().getDataContainerName())->getGeometryAs<ImageGeom>(), totalPoints, udims);
+  }
+  if(imageRows)
+  {
+    if(NULL != m_ReferenceCache)
+    {
+      // a cache that doesn't fit the reference volume (e.g. an empty cache for the first match of a series) is filled from the reference ids
+      cachedReference = true;
+      if(m_ReferenceCache->runs.rowLength() != udims[0] || m_ReferenceCache->runs.numRows() != udims[1] * udims[2] || m_ReferenceCache->volumes.size() != static_cast<size_t>(maxReferenceId))
+      {
+        m_ReferenceCache->runs.encode(m_ReferenceFeatureIds, udims[0], udims[1] * udims[2]);
+        m_ReferenceCache->volumes = m_ReferenceCache->runs.volumes(maxReferenceId);
+        m_ReferenceCache->symOps.clear();
+      }
+    }
+    else
+    {
+      encodedReferenceRuns.encode(m_ReferenceFeatureIds, udims[0], udims[1] * udims[2]);
+    }
+    movingRuns.encode(m_MovingFeatureIds, udims[0], udims[1] * udims[2]);
+  }
+  const RowRuns& referenceRuns = cachedReference ? m_ReferenceCache->runs : encodedReferenceRuns;
+  size_t numRows = udims[1] * udims[2];
+
+  notifyStatusMessage(getHumanLabel(), "Finding candidate pairs");
+  if(1 == m_CorrespondenceSource)
+  {
+    centroidPairs = findCentroidPairs(doParallel);
+  }
+  else if(m_UseDilation)
+  {
+    notifyStatusMessage(getHumanLabel(), "Counting overlap");
+    // count overlap of each row against the runs of its neighboring rows
+    Detail::DilatedOverlapCounter counter(referenceRuns, movingRuns, udims[1], udims[2], m_DilationRadius, maxReferenceId, maxMovingId);
+#ifdef SIMPLib_USE_PARALLEL_ALGORITHMS
+    if (doParallel == true)
+    {
+      tbb::parallel_reduce(tbb::blocked_range<size_t>(0, numRows), counter, tbb::auto_partitioner());
+    }
+    else
+#endif
+    {
+      counter.count(0, numRows);
+    }
+    referenceVolumes = counter.referenceVolumes();
+    movingVolumes = counter.movingVolumes();
+    intersections = counter.sortedIntersections();
+  }
+  else if(imageRows)
+  {
+    // only pairs of features with intersecting bounding boxes can overlap, find them before counting so overlaps are accumulated in a flat
+    // array of candidates
+    std::vector< std::atomic<int32_t> > referenceBoxes(6 * maxReferenceId), movingBoxes(6 * maxMovingId);
+    Detail::BoundingBoxFinder finder(referenceRuns, movingRuns, udims[1], referenceBoxes, movingBoxes);
+#ifdef SIMPLib_USE_PARALLEL_ALGORITHMS
+    if (doParallel == true)
+    {
+      tbb::parallel_for(tbb::blocked_range<size_t>(0, numRows), finder, tbb::auto_partitioner());
+    }
+    else
+#endif
+    {
+      finder.find(0, numRows);
+    }
+    Detail::CandidatePairs candidates(Detail::BoundingBoxFinder::Load(referenceBoxes), Detail::BoundingBoxFinder::Load(movingBoxes));
+    notifyStatusMessage(getHumanLabel(), "Counting overlap");
+
+    // compare rows run against run finding intersections (ignoring grain 0), volumes follow from the intersections
+    std::vector< std::atomic<int64_t> > candidateOverlaps(candidates.size());//value initialized to 0
+    std::atomic<int64_t> missedOverlap(0);
+    Detail::CandidateOverlapCounter counter(referenceRuns, movingRuns, candidates, candidateOverlaps.empty() ? NULL : &candidateOverlaps[0], &missedOverlap);
+#ifdef SIMPLib_USE_PARALLEL_ALGORITHMS
+    if (doParallel == true)
+    {
+      tbb::parallel_for(tbb::blocked_range<size_t>(0, numRows), counter, tbb::auto_partitioner());
+    }
+    else
+#endif
+    {
+      counter.count(0, numRows);
+    }
+    if(missedOverlap.load() > 0)
+    {
+      setErrorCondition(-1014);
+      QString ss = QObject::tr("%1 overlapping voxels belong to feature pairs missed by the bounding box search").arg(missedOverlap.load());
+      notifyErrorMessage(getHumanLabel(), ss, getErrorCondition());
+      return;
+    }
+    intersections = Detail::CandidateOverlapCounter::SortedIntersections(candidates, candidateOverlaps);
+    Detail::featureVolumes(intersections, maxReferenceId, maxMovingId, referenceVolumes, movingVolumes);
+  }
+  else
   {
-    int index = i*maxReferenceId;
-    for(int j=0; j<maxReferenceId; j++)
+    notifyStatusMessage(getHumanLabel(), "Counting overlap");
+    // accumulate intersections voxel by voxel (ignoring grain 0) over the whole array, or one slab at a time when streaming
+    // volumes follow from the intersections
+    Detail::OverlapCounter counter(m_ReferenceFeatureIds, m_MovingFeatureIds);
+    size_t numSlabs = m_UseStreaming ? (referenceStream.numSlices() + slabThickness - 1) / slabThickness : 1;
+    for(size_t slab = 0; slab < numSlabs; slab++)
     {
-      int overlap = intersections[index+j];
-      //only consider pairs with finite overlap
-      if(overlap>0)
+      if (getCancel() == true) { return; }
+      if(m_UseStreaming)
       {
-        //if orientation match is required, only accumulate pairs that have matching crystal structures (phase is insufficient since they may have different cell ensemble matricies)
-        if( !m_UseOrientations || (m_UseOrientations && m_ReferenceCrystalStructures[ m_ReferencePhases[j+1] ] == m_MovingCrystalStructures[ m_MovingPhases[i+1] ]) )
+        size_t firstSlice = slab * slabThickness;
+        size_t numSlices = std::min(slabThickness, referenceStream.numSlices() - firstSlice);
+        if(!referenceStream.read(firstSlice, numSlices, &referenceSlab[0]) || !movingStream.read(firstSlice, numSlices, &movingSlab[0]))
         {
-          Detail::OverlapPair overlapPair;
-          overlapPair.referenceId = j+1;
-          overlapPair.movingId = i+1;
+          setErrorCondition(-1007);
+          notifyErrorMessage(getHumanLabel(), "Error reading feature ids from file", getErrorCondition());
+          return;
+        }
+        counter.setIds(&referenceSlab[0], &movingSlab[0]);
+        totalPoints = numSlices * referenceStream.sliceSize();
+      }
 
-          switch(m_Metric)
-          {
-            case 0://jaccard
-            {
-              overlapPair.index = (float)overlap/(movingVolumes[i]+referenceVolumes[j]-overlap);
-            } break;
+#ifdef SIMPLib_USE_PARALLEL_ALGORITHMS
+      if (doParallel == true)
+      {
+        tbb::parallel_reduce(tbb::blocked_range<size_t>(0, totalPoints), counter, tbb::auto_partitioner());
+      }
+      else
+#endif
+      {
+        counter.count(0, totalPoints);
+      }
+    }
+    intersections = counter.sortedIntersections();
+    Detail::featureVolumes(intersections, maxReferenceId, maxMovingId, referenceVolumes, movingVolumes);
+  }
 
-            case 1://dice
-            {
-              overlapPair.index = (float)(2*overlap)/(movingVolumes[i]+referenceVolumes[j]);
-            } break;
+  notifyStatusMessage(getHumanLabel(), "Computing similarity");
+  // compute selected metric for each pair of overlapping grains
+  std::vector<Detail::OverlapPair> featureOverlaps;
+  size_t numCandidates = 1 == m_CorrespondenceSource ? centroidPairs.size() : intersections.size();
+  for(size_t k = 0; k < numCandidates; k++)
+  {
+    uint64_t key = 1 == m_CorrespondenceSource ? centroidPairs[k].first : intersections[k].first;
+    int i = static_cast<int>(key >> 32);//moving id
+    int j = static_cast<int>(key & 0xFFFFFFFF);//reference id
 
-            case 2://cosine
-            {
-              overlapPair.index = (float)overlap/sqrt(movingVolumes[i]*referenceVolumes[j]);
-            } break;
-          }
-          if(overlapPair.index>=m_MetricThreshold) featureOverlaps.push_back(overlapPair);
-        }
-      }
+    //if orientation match is required, only accumulate pairs that have matching crystal structures (phase is insufficient since they may have different cell ensemble matricies)
+    if( !m_UseOrientations || (m_UseOrientations && m_ReferenceCrystalStructures[ m_ReferencePhases[j] ] == m_MovingCrystalStructures[ m_MovingPhases[i] ]) )
+    {
+      Detail::OverlapPair overlapPair;
+      overlapPair.referenceId = j;
+      overlapPair.movingId = i;
+
+      if(1 == m_CorrespondenceSource)
+        overlapPair.index = centroidPairs[k].second;
+      else
+        overlapPair.index = Detail::similarity(m_Metric, intersections[k].second, movingVolumes[i], referenceVolumes[j]);
+      if(overlapPair.index>=m_MetricThreshold) featureOverlaps.push_back(overlapPair);
     }
   }
-  std::sort(featureOverlaps.begin(), featureOverlaps.end());
 
   // create map of current to new moving grain ids
   std::vector<size_t> idMap(maxMovingId, -1);
   idMap[0] = 0;
 
-  // begin assigning grains by overlap until (i) all moving grains have been assigned or (ii) overlapping pairs are exhausted
-  float orientationTolerance = m_OrientationTolerance*SIMPLib::Constants::k_Pi/180.0f;
-  int assignedGrains = 0;
-  while(assignedGrains<maxMovingId && featureOverlaps.size()>0)
+  //pairs that don't satisfy the orientation requirement can never be matched
+  std::vector< std::vector<float> > symOps;
+  if(m_UseOrientations)
   {
-    //get last pair (highest index / most overlap)
-    int referenceId = featureOverlaps.back().referenceId;
-    int movingId = featureOverlaps.back().movingId;
-    bool assign = false;
+    // compute the misorientation of all candidate pairs at once
+    std::vector<float> misorientations(featureOverlaps.size());
+    symOps = (NULL != m_ReferenceCache && !m_ReferenceCache->symOps.empty()) ? m_ReferenceCache->symOps : Detail::MisorientationCalculator::BuildSymOps(m_OrientationOps);
+    Detail::MisorientationCalculator calculator(featureOverlaps, m_ReferenceQuats, m_MovingQuats, m_ReferencePhases, m_ReferenceCrystalStructures, symOps, misorientations.data());
+#ifdef SIMPLib_USE_PARALLEL_ALGORITHMS
+    if (doParallel == true)
+    {
+      tbb::parallel_for(tbb::blocked_range<size_t>(0, featureOverlaps.size()), calculator, tbb::auto_partitioner());
+    }
+    else
+#endif
+    {
+      calculator.compute(0, featureOverlaps.size());
+    }
 
-    //only check for match if both grains are still available
-    if(m_ReferenceUnique[referenceId] && m_MovingUnique[movingId])
+    float orientationTolerance = m_OrientationTolerance*SIMPLib::Constants::k_Pi/180.0f;
+    size_t numAllowed = 0;
+    for(size_t i = 0; i < featureOverlaps.size(); i++)
     {
-      if(m_UseOrientations)
-      {
-        //already checked for same structure during
-        int referencePhase = m_ReferenceCrystalStructures[m_ReferencePhases[referenceId]];
-        int movingPhase = m_MovingCrystalStructures[m_MovingPhases[movingId]];
-        if(referencePhase==movingPhase && referencePhase!=Ebsd::CrystalStructure::UnknownCrystalStructure)
-        {
-          float w, n1, n2, n3;
-          QuatF q1, q2;
-          QuaternionMathF::Copy(reference_quats[referenceId], q1);
-          QuaternionMathF::Copy(moving_quats[movingId], q2);
-          w = m_OrientationOps[referencePhase]->getMisoQuat( q1, q2, n1, n2, n3);
-          if(w<=orientationTolerance)
-          {
-            assign=true;
-          }
-        }
-      }
-      else
-      {
-        assign = true;
-      }
+      if(misorientations[i] <= orientationTolerance)
+        featureOverlaps[numAllowed++] = featureOverlaps[i];
     }
+    featureOverlaps.resize(numAllowed);
+  }
 
-    if(assign)
+  notifyStatusMessage(getHumanLabel(), "Matching features");
+  // split the overlap graph into connected components (reference grain i is node i, moving grain j is node maxReferenceId + j)
+  Detail::UnionFind components(maxReferenceId + maxMovingId);
+  for(size_t i = 0; i < featureOverlaps.size(); i++)
+    components.merge(featureOverlaps[i].referenceId, maxReferenceId + featureOverlaps[i].movingId);
+
+  // group pairs by component (components are numbered in order of first appearance so grouping is deterministic)
+  std::vector<size_t> componentIndex(maxReferenceId + maxMovingId, -1);
+  std::vector<size_t> pairComponent(featureOverlaps.size());
+  std::vector<size_t> componentOffsets(1, 0);
+  for(size_t i = 0; i < featureOverlaps.size(); i++)
+  {
+    size_t root = components.find(featureOverlaps[i].referenceId);
+    if(-1 == componentIndex[root])
     {
-      idMap[movingId] = referenceId;
-      m_ReferenceUnique[referenceId] = false;
-      m_MovingUnique[movingId] = false;
-      m_Overlap[movingId] = featureOverlaps.back().index;
-      assignedGrains++;
+      componentIndex[root] = componentOffsets.size() - 1;
+      componentOffsets.push_back(0);
     }
+    pairComponent[i] = componentIndex[root];
+    componentOffsets[pairComponent[i] + 1]++;
+  }
+  size_t numComponents = componentOffsets.size() - 1;
+  for(size_t i = 0; i < numComponents; i++)
+    componentOffsets[i + 1] += componentOffsets[i];
+  std::vector<Detail::OverlapPair> groupedOverlaps(featureOverlaps.size());
+  {
+    std::vector<size_t> fill(componentOffsets.begin(), componentOffsets.end() - 1);
+    for(size_t i = 0; i < featureOverlaps.size(); i++)
+      groupedOverlaps[fill[pairComponent[i]]++] = featureOverlaps[i];
+  }
+  std::vector<Detail::OverlapPair>().swap(featureOverlaps);
 
-    //remove from list
-    featureOverlaps.pop_back();
+  // the number of matches in a component is limited by the number of grains on its smaller side
+  std::vector<size_t> componentReferences(numComponents, 0), componentMovings(numComponents, 0), componentMaxMatches(numComponents);
+  for(size_t i = 1; i < maxReferenceId; i++)
+  {
+    size_t c = componentIndex[components.find(i)];
+    if(-1 != c) componentReferences[c]++;
+  }
+  for(size_t i = 1; i < maxMovingId; i++)
+  {
+    size_t c = componentIndex[components.find(maxReferenceId + i)];
+    if(-1 != c) componentMovings[c]++;
   }
+  for(size_t i = 0; i < numComponents; i++)
+    componentMaxMatches[i] = std::min(componentReferences[i], componentMovings[i]);
 
+  // match each component independently (greedy matching within a component is identical to the greedy matching of all pairs)
+  Detail::ComponentMatcher matcher(groupedOverlaps, componentOffsets, componentMaxMatches, m_MatchingMethod, &idMap[0], m_ReferenceUnique, m_MovingUnique, m_Overlap);
+#ifdef SIMPLib_USE_PARALLEL_ALGORITHMS
+  if (doParallel == true)
+  {
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, numComponents), matcher, tbb::auto_partitioner());
+  }
+  else
+#endif
+  {
+    matcher.match(0, numComponents);
+  }
 
   //if all the moving grains haven't been assigned append to higher grain ids
   int index = maxReferenceId;
@@ -461,32 +2096,260 @@ void MatchFeatureIds::execute()
     }
   }
 
+  // find one to many / many to one correspondences (lists and group ids in the moving feature matrix are reordered with the other moving arrays)
+  if(m_DetectSplitsMerges)
+  {
+    findCorrespondences(intersections, referenceVolumes, movingVolumes, idMap);
+  }
+
+  // save all overlapping pairs for downstream filters
+  if(m_ExportOverlapTable)
+  {
+    writeOverlapTable(intersections, referenceVolumes, movingVolumes, idMap);
+  }
+
+  notifyStatusMessage(getHumanLabel(), "Renumbering feature ids");
   // modify moving feature ids
-  for(int i=0; i<totalPoints; i++)
+  if(m_UseStreaming)
+  {
+    // relabeled slabs go to a temporary dataset that only replaces the moving ids once every slab is written
+    // unless they are written in place (no extra space in the file, but an error part way through leaves the ids partially renumbered)
+    if(!m_RewriteInPlace && !movingStream.beginRewrite())
+    {
+      setErrorCondition(-1008);
+      QString ss = QObject::tr("Unable to create '%1' to hold the relabeled moving feature ids").arg(movingStream.temporaryPath());
+      notifyErrorMessage(getHumanLabel(), ss, getErrorCondition());
+      return;
+    }
+    for(size_t firstSlice = 0; firstSlice < movingStream.numSlices(); firstSlice += slabThickness)
+    {
+      size_t numSlices = std::min(slabThickness, movingStream.numSlices() - firstSlice);
+      bool ok = movingStream.read(firstSlice, numSlices, &movingSlab[0]);
+      if(ok)
+      {
+        FeatureRelabel::relabel(&movingSlab[0], numSlices * movingStream.sliceSize(), idMap);
+        ok = movingStream.write(firstSlice, numSlices, &movingSlab[0]);
+      }
+      if(!ok)
+      {
+        movingStream.discardRewrite();
+        setErrorCondition(-1008);
+        QString ss = QObject::tr("Error relabeling slices %1 to %2 of the moving feature ids (%3)").arg(firstSlice).arg(firstSlice + numSlices - 1).arg(m_RewriteInPlace ? "earlier slices were already renumbered" : "the feature ids file is unchanged");
+        notifyErrorMessage(getHumanLabel(), ss, getErrorCondition());
+        return;
+      }
+    }
+    if(!m_RewriteInPlace && !movingStream.commitRewrite())
+    {
+      setErrorCondition(-1008);
+      QString ss = QObject::tr("Unable to replace the moving feature ids with the relabeled ids (if the original ids were removed the relabeled ids are in '%1')").arg(movingStream.temporaryPath());
+      notifyErrorMessage(getHumanLabel(), ss, getErrorCondition());
+      return;
+    }
+  }
+  else if(imageRows)
+  {
+    FeatureRelabel::relabel(m_MovingFeatureIds, movingRuns, idMap);
+  }
+  else
   {
-    m_MovingFeatureIds[i]=idMap[m_MovingFeatureIds[i]];
+    FeatureRelabel::relabel(m_MovingFeatureIds, totalPoints, idMap);
   }
 
+  notifyStatusMessage(getHumanLabel(), "Reordering feature data");
   // resize and rearrange moving feature attribute arrays
-  QVector<size_t> tDims(1,index);
   DataContainer::Pointer m = getDataContainerArray()->getDataContainer(getMovingCellFeatureAttributeMatrixPath().getDataContainerName());
   AttributeMatrix::Pointer cellFeatureAttrMat = m->getAttributeMatrix(getMovingCellFeatureAttributeMatrixPath().getAttributeMatrixName());
-  cellFeatureAttrMat->setTupleDimensions(tDims);
+  FeatureRelabel::reorderFeatures(cellFeatureAttrMat, idMap, index);
 
-  QList<QString> featureArrayNames = cellFeatureAttrMat->getAttributeArrayNames();
-  idMap.resize(tDims[0],0);
-  QVector<size_t> newOrder = QVector<size_t>::fromStdVector(idMap);
-  for(QList<QString>::iterator iter = featureArrayNames.begin(); iter != featureArrayNames.end(); ++iter)
+  // the renumbered moving runs are the reference runs of a following match, feature volumes come from the run lengths
+  if(NULL != m_MovingCache)
   {
-    IDataArray::Pointer pOld = cellFeatureAttrMat->getAttributeArray(*iter);
-    IDataArray::Pointer pNew = pOld->reorderCopy(newOrder);
-    cellFeatureAttrMat->removeAttributeArray(*iter);
-    cellFeatureAttrMat->addAttributeArray(pNew->getName(), pNew);
+    m_MovingCache->runs = RowRuns();
+    m_MovingCache->volumes.clear();
+    m_MovingCache->symOps = symOps;
+    if(movingRuns.numRows() > 0)
+    {
+      movingRuns.relabel(idMap);
+      m_MovingCache->volumes = movingRuns.volumes(index);
+      std::swap(m_MovingCache->runs, movingRuns);
+    }
   }
 
   notifyStatusMessage(getHumanLabel(), "Complete");
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+std::vector< std::pair<uint64_t, float> > MatchFeatureIds::findCentroidPairs(bool doParallel)
+{
+  size_t numReference = m_ReferenceCentroidsPtr.lock()->getNumberOfTuples();
+  size_t numMoving = m_MovingCentroidsPtr.lock()->getNumberOfTuples();
+
+  //centroids are relative to the origin of their image geometry
+  float refOrigin[3] = {0.0f, 0.0f, 0.0f};
+  float movOrigin[3] = {0.0f, 0.0f, 0.0f};
+  getDataContainerArray()->getDataContainer(getReferenceCentroidsArrayPath().getDataContainerName())->getGeometryAs<ImageGeom>()->getOrigin(refOrigin);
+  getDataContainerArray()->getDataContainer(getMovingCentroidsArrayPath().getDataContainerName())->getGeometryAs<ImageGeom>()->getOrigin(movOrigin);
+
+  std::vector<float> referencePositions(3 * numReference);
+  for(size_t i = 0; i < numReference; i++)
+  {
+    for(size_t k = 0; k < 3; k++)
+      referencePositions[3 * i + k] = m_ReferenceCentroids[3 * i + k] + refOrigin[k];
+  }
+
+  //moving positions are brought into the reference frame with the (row major) transformation computed by 'Register Point Sets'
+  std::vector<float> movingPositions(3 * numMoving);
+  for(size_t i = 0; i < numMoving; i++)
+  {
+    float x[3];
+    for(size_t k = 0; k < 3; k++)
+      x[k] = m_MovingCentroids[3 * i + k] + movOrigin[k];
+    for(size_t k = 0; k < 3; k++)
+    {
+      if(m_UseTransformation)
+        movingPositions[3 * i + k] = m_Transformation[4 * k] * x[0] + m_Transformation[4 * k + 1] * x[1] + m_Transformation[4 * k + 2] * x[2] + m_Transformation[4 * k + 3];
+      else
+        movingPositions[3 * i + k] = x[k];
+    }
+  }
+
+  //query the neighborhood of each moving feature (each task fills the candidate lists of its own features)
+  KdTree<float> referenceTree(referencePositions.data(), numReference, 3);
+  std::vector< std::vector< std::pair<uint64_t, float> > > candidates(numMoving);
+  Detail::CentroidPairFinder finder(referenceTree, movingPositions.data(), static_cast<float>(m_CentroidTolerance), m_UseDiameters ? m_ReferenceDiameters : NULL, m_UseDiameters ? m_MovingDiameters : NULL, candidates);
+#ifdef SIMPLib_USE_PARALLEL_ALGORITHMS
+  if (doParallel == true)
+  {
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, numMoving), finder, tbb::auto_partitioner());
+  }
+  else
+#endif
+  {
+    finder.find(0, numMoving);
+  }
+
+  //concatenating the lists in moving id order keeps the pairs sorted by key
+  std::vector< std::pair<uint64_t, float> > pairs;
+  for(size_t i = 0; i < numMoving; i++)
+    pairs.insert(pairs.end(), candidates[i].begin(), candidates[i].end());
+  return pairs;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void MatchFeatureIds::findCorrespondences(const std::vector< std::pair<uint64_t, int64_t> >& intersections, const std::vector<int64_t>& referenceVolumes, const std::vector<int64_t>& movingVolumes, const std::vector<size_t>& idMap)
+{
+  size_t maxReferenceId = referenceVolumes.size();
+  size_t maxMovingId = movingVolumes.size();
+
+  // a fragment of a split feature is (mostly) contained in the feature it was split from, keep pairs where the smaller feature is sufficiently contained in the larger one
+  std::vector< std::pair<int, int> > links;//(moving id, reference id), moving major since intersections are sorted
+  for(size_t k = 0; k < intersections.size(); k++)
+  {
+    int i = static_cast<int>(intersections[k].first >> 32);//moving id
+    int j = static_cast<int>(intersections[k].first & 0xFFFFFFFF);//reference id
+    int64_t smaller = std::min(movingVolumes[i], referenceVolumes[j]);
+    if(smaller > 0 && (double)intersections[k].second / smaller >= m_ContainmentThreshold)
+      links.push_back(std::make_pair(i, j));
+  }
+
+  // features connected by links form a group (reference feature j is node j, moving feature i is node maxReferenceId + i)
+  Detail::UnionFind groups(maxReferenceId + maxMovingId);
+  for(size_t k = 0; k < links.size(); k++)
+    groups.merge(links[k].second, maxReferenceId + links[k].first);
+
+  // number groups in order of first appearance, features without any links are in group 0
+  std::fill(m_ReferenceGroupIds, m_ReferenceGroupIds + maxReferenceId, 0);
+  std::fill(m_MovingGroupIds, m_MovingGroupIds + maxMovingId, 0);
+  std::vector<int32_t> groupNumbers(maxReferenceId + maxMovingId, 0);
+  int32_t numGroups = 0;
+  for(size_t k = 0; k < links.size(); k++)
+  {
+    size_t root = groups.find(links[k].second);
+    if(0 == groupNumbers[root]) groupNumbers[root] = ++numGroups;
+    m_ReferenceGroupIds[links[k].second] = groupNumbers[root];
+    m_MovingGroupIds[links[k].first] = groupNumbers[root];
+  }
+
+  // fill lists of corresponding features (reference features list new moving ids)
+  NeighborList<int32_t>::Pointer referenceLists = m_ReferenceCorrespondences.lock();
+  NeighborList<int32_t>::Pointer movingLists = m_MovingCorrespondences.lock();
+  std::vector<NeighborList<int32_t>::SharedVectorType> referenceCorrespondences(maxReferenceId), movingCorrespondences(maxMovingId);
+  for(size_t i = 0; i < maxReferenceId; i++)
+    referenceCorrespondences[i] = NeighborList<int32_t>::SharedVectorType(new std::vector<int32_t>);
+  for(size_t i = 0; i < maxMovingId; i++)
+    movingCorrespondences[i] = NeighborList<int32_t>::SharedVectorType(new std::vector<int32_t>);
+  for(size_t k = 0; k < links.size(); k++)
+  {
+    referenceCorrespondences[links[k].second]->push_back(static_cast<int32_t>(idMap[links[k].first]));
+    movingCorrespondences[links[k].first]->push_back(links[k].second);
+  }
+  for(size_t i = 0; i < maxReferenceId; i++)
+    referenceLists->setList(static_cast<int>(i), referenceCorrespondences[i]);
+  for(size_t i = 0; i < maxMovingId; i++)
+    movingLists->setList(static_cast<int>(i), movingCorrespondences[i]);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void MatchFeatureIds::writeOverlapTable(const std::vector< std::pair<uint64_t, int64_t> >& intersections, const std::vector<int64_t>& referenceVolumes, const std::vector<int64_t>& movingVolumes, const std::vector<size_t>& idMap)
+{
+  size_t maxReferenceId = referenceVolumes.size();
+  size_t numPairs = intersections.size();
+
+  // row offsets for compressed sparse row order (pairs of reference feature j are [offsets[j], offsets[j + 1]) )
+  std::vector<size_t> offsets(maxReferenceId + 1, 0);
+  for(size_t k = 0; k < numPairs; k++)
+    offsets[(intersections[k].first & 0xFFFFFFFF) + 1]++;
+  for(size_t j = 0; j < maxReferenceId; j++)
+    offsets[j + 1] += offsets[j];
+
+  // bucket pairs by reference id then order each row by new moving id
+  std::vector<size_t> order(numPairs);
+  {
+    std::vector<size_t> fill(offsets.begin(), offsets.end() - 1);
+    for(size_t k = 0; k < numPairs; k++)
+      order[fill[intersections[k].first & 0xFFFFFFFF]++] = k;
+  }
+  std::vector<std::pair<size_t, size_t> > row;
+  for(size_t j = 0; j < maxReferenceId; j++)
+  {
+    row.clear();
+    for(size_t k = offsets[j]; k < offsets[j + 1]; k++)
+      row.push_back(std::make_pair(idMap[intersections[order[k]].first >> 32], order[k]));
+    std::sort(row.begin(), row.end());
+    for(size_t k = 0; k < row.size(); k++)
+      order[offsets[j] + k] = row[k].second;
+  }
+
+  // size feature pair matrix and fill arrays
+  DataArrayPath pairPath(getMovingCellFeatureAttributeMatrixPath().getDataContainerName(), getOverlapTableAttributeMatrixName(), "");
+  AttributeMatrix::Pointer pairAttrMat = getDataContainerArray()->getAttributeMatrix(pairPath);
+  QVector<size_t> tDims(1, numPairs);
+  pairAttrMat->resizeAttributeArrays(tDims);
+  m_PairReferenceIds = m_PairReferenceIdsPtr.lock()->getPointer(0);
+  m_PairMovingIds = m_PairMovingIdsPtr.lock()->getPointer(0);
+  m_PairVoxelCounts = m_PairVoxelCountsPtr.lock()->getPointer(0);
+  m_PairMetric = m_PairMetricPtr.lock()->getPointer(0);
+  for(size_t k = 0; k < numPairs; k++)
+  {
+    const std::pair<uint64_t, int64_t>& pair = intersections[order[k]];
+    int i = static_cast<int>(pair.first >> 32);//moving id
+    int j = static_cast<int>(pair.first & 0xFFFFFFFF);//reference id
+    m_PairReferenceIds[k] = j;
+    m_PairMovingIds[k] = static_cast<int32_t>(idMap[i]);
+    m_PairVoxelCounts[k] = pair.second;
+    m_PairMetric[k] = Detail::similarity(m_Metric, pair.second, movingVolumes[i], referenceVolumes[j]);
+  }
+  for(size_t j = 0; j < maxReferenceId; j++)
+    m_OverlapTableOffsets[j] = static_cast<int64_t>(offsets[j]);
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
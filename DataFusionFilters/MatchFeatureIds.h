@@ -23,9 +23,12 @@
 #include "SIMPLib/SIMPLib.h"
 #include "SIMPLib/Common/SIMPLibSetGetMacros.h"
 #include "SIMPLib/Common/AbstractFilter.h"
+#include "SIMPLib/DataArrays/NeighborList.hpp"
 
 #include "OrientationLib/SpaceGroupOps/SpaceGroupOps.h"
 
+#include "DataFusion/DataFusionFilters/util/RowRuns.h"
+
 /**
  * @brief The MatchFeatureIds class. See [Filter documentation](@ref MatchFeatureIds) for details.
  */
@@ -53,6 +56,54 @@ class MatchFeatureIds : public AbstractFilter
     SIMPL_FILTER_PARAMETER(DataArrayPath, MovingFeatureIdsArrayPath)
     Q_PROPERTY(DataArrayPath MovingFeatureIdsArrayPath READ getMovingFeatureIdsArrayPath WRITE setMovingFeatureIdsArrayPath)
 
+    //correspondences from feature positions instead of voxel overlap
+    SIMPL_FILTER_PARAMETER(int, CorrespondenceSource)
+    Q_PROPERTY(int CorrespondenceSource READ getCorrespondenceSource WRITE setCorrespondenceSource)
+
+    SIMPL_FILTER_PARAMETER(DataArrayPath, ReferenceCentroidsArrayPath)
+    Q_PROPERTY(DataArrayPath ReferenceCentroidsArrayPath READ getReferenceCentroidsArrayPath WRITE setReferenceCentroidsArrayPath)
+
+    SIMPL_FILTER_PARAMETER(DataArrayPath, MovingCentroidsArrayPath)
+    Q_PROPERTY(DataArrayPath MovingCentroidsArrayPath READ getMovingCentroidsArrayPath WRITE setMovingCentroidsArrayPath)
+
+    SIMPL_FILTER_PARAMETER(double, CentroidTolerance)
+    Q_PROPERTY(double CentroidTolerance READ getCentroidTolerance WRITE setCentroidTolerance)
+
+    SIMPL_FILTER_PARAMETER(bool, UseDiameters)
+    Q_PROPERTY(bool UseDiameters READ getUseDiameters WRITE setUseDiameters)
+
+    SIMPL_FILTER_PARAMETER(DataArrayPath, ReferenceDiametersArrayPath)
+    Q_PROPERTY(DataArrayPath ReferenceDiametersArrayPath READ getReferenceDiametersArrayPath WRITE setReferenceDiametersArrayPath)
+
+    SIMPL_FILTER_PARAMETER(DataArrayPath, MovingDiametersArrayPath)
+    Q_PROPERTY(DataArrayPath MovingDiametersArrayPath READ getMovingDiametersArrayPath WRITE setMovingDiametersArrayPath)
+
+    SIMPL_FILTER_PARAMETER(bool, UseTransformation)
+    Q_PROPERTY(bool UseTransformation READ getUseTransformation WRITE setUseTransformation)
+
+    SIMPL_FILTER_PARAMETER(DataArrayPath, TransformationArrayPath)
+    Q_PROPERTY(DataArrayPath TransformationArrayPath READ getTransformationArrayPath WRITE setTransformationArrayPath)
+
+    //overlap within a neighborhood
+    SIMPL_FILTER_PARAMETER(bool, UseDilation)
+    Q_PROPERTY(bool UseDilation READ getUseDilation WRITE setUseDilation)
+
+    SIMPL_FILTER_PARAMETER(int, DilationRadius)
+    Q_PROPERTY(int DilationRadius READ getDilationRadius WRITE setDilationRadius)
+
+    //streaming feature ids from file
+    SIMPL_FILTER_PARAMETER(bool, UseStreaming)
+    Q_PROPERTY(bool UseStreaming READ getUseStreaming WRITE setUseStreaming)
+
+    SIMPL_FILTER_PARAMETER(QString, StreamingFilePath)
+    Q_PROPERTY(QString StreamingFilePath READ getStreamingFilePath WRITE setStreamingFilePath)
+
+    SIMPL_FILTER_PARAMETER(int, SlabThickness)
+    Q_PROPERTY(int SlabThickness READ getSlabThickness WRITE setSlabThickness)
+
+    SIMPL_FILTER_PARAMETER(bool, RewriteInPlace)
+    Q_PROPERTY(bool RewriteInPlace READ getRewriteInPlace WRITE setRewriteInPlace)
+
     //orientation matching
     SIMPL_FILTER_PARAMETER(DataArrayPath, ReferenceQuatsArrayPath)
     Q_PROPERTY(DataArrayPath ReferenceQuatsArrayPath READ getReferenceQuatsArrayPath WRITE setReferenceQuatsArrayPath)
@@ -82,6 +133,18 @@ class MatchFeatureIds : public AbstractFilter
     SIMPL_FILTER_PARAMETER(QString, MovingUniqueArrayName)
     Q_PROPERTY(QString MovingUniqueArrayName READ getMovingUniqueArrayName WRITE setMovingUniqueArrayName)
 
+    SIMPL_FILTER_PARAMETER(QString, ReferenceCorrespondencesArrayName)
+    Q_PROPERTY(QString ReferenceCorrespondencesArrayName READ getReferenceCorrespondencesArrayName WRITE setReferenceCorrespondencesArrayName)
+
+    SIMPL_FILTER_PARAMETER(QString, MovingCorrespondencesArrayName)
+    Q_PROPERTY(QString MovingCorrespondencesArrayName READ getMovingCorrespondencesArrayName WRITE setMovingCorrespondencesArrayName)
+
+    SIMPL_FILTER_PARAMETER(QString, ReferenceGroupIdsArrayName)
+    Q_PROPERTY(QString ReferenceGroupIdsArrayName READ getReferenceGroupIdsArrayName WRITE setReferenceGroupIdsArrayName)
+
+    SIMPL_FILTER_PARAMETER(QString, MovingGroupIdsArrayName)
+    Q_PROPERTY(QString MovingGroupIdsArrayName READ getMovingGroupIdsArrayName WRITE setMovingGroupIdsArrayName)
+
     //user paramters
     SIMPL_FILTER_PARAMETER(int, Metric)
     Q_PROPERTY(int Metric READ getMetric WRITE setMetric)
@@ -89,12 +152,30 @@ class MatchFeatureIds : public AbstractFilter
     SIMPL_FILTER_PARAMETER(double, MetricThreshold)
     Q_PROPERTY(double MetricThreshold READ getMetricThreshold WRITE setMetricThreshold)
 
+    SIMPL_FILTER_PARAMETER(int, MatchingMethod)
+    Q_PROPERTY(int MatchingMethod READ getMatchingMethod WRITE setMatchingMethod)
+
     SIMPL_FILTER_PARAMETER(bool, UseOrientations)
     Q_PROPERTY(bool UseOrientations READ getUseOrientations WRITE setUseOrientations)
 
     SIMPL_FILTER_PARAMETER(double, OrientationTolerance)
     Q_PROPERTY(double OrientationTolerance READ getOrientationTolerance WRITE setOrientationTolerance)
 
+    SIMPL_FILTER_PARAMETER(bool, DetectSplitsMerges)
+    Q_PROPERTY(bool DetectSplitsMerges READ getDetectSplitsMerges WRITE setDetectSplitsMerges)
+
+    SIMPL_FILTER_PARAMETER(double, ContainmentThreshold)
+    Q_PROPERTY(double ContainmentThreshold READ getContainmentThreshold WRITE setContainmentThreshold)
+
+    SIMPL_FILTER_PARAMETER(bool, ExportOverlapTable)
+    Q_PROPERTY(bool ExportOverlapTable READ getExportOverlapTable WRITE setExportOverlapTable)
+
+    SIMPL_FILTER_PARAMETER(QString, OverlapTableAttributeMatrixName)
+    Q_PROPERTY(QString OverlapTableAttributeMatrixName READ getOverlapTableAttributeMatrixName WRITE setOverlapTableAttributeMatrixName)
+
+    SIMPL_FILTER_PARAMETER(QString, OverlapTableOffsetsArrayName)
+    Q_PROPERTY(QString OverlapTableOffsetsArrayName READ getOverlapTableOffsetsArrayName WRITE setOverlapTableOffsetsArrayName)
+
 
 
 
@@ -148,6 +229,32 @@ class MatchFeatureIds : public AbstractFilter
     */
     virtual void preflight();
 
+    /**
+     * @brief The StepCache struct holds what one match knows about its renumbered moving volume so a following match that uses that volume as
+     * its reference (e.g. the steps of TrackFeatureIds) doesn't need to encode it again: the run length encoding of the feature ids, the voxel
+     * count of each feature, and the symmetry operators used to compare orientations (empty if orientations weren't compared)
+     */
+    struct StepCache
+    {
+      RowRuns runs;
+      std::vector<int64_t> volumes;
+      std::vector< std::vector<float> > symOps;
+    };
+
+    /**
+     * @brief setReferenceCache Uses cached data for the reference volume instead of encoding the reference feature ids (the cache must describe the
+     * current reference feature ids), a cache that doesn't fit the reference volume is filled from the reference ids. The cache is only used when
+     * overlap is counted in memory
+     * @param cache cache filled by the previous match (or an empty cache to fill) or NULL
+     */
+    void setReferenceCache(StepCache* cache) {m_ReferenceCache = cache;}
+
+    /**
+     * @brief setMovingCache Fills a cache with the renumbered moving volume when execute finishes (left empty unless overlap is counted in memory)
+     * @param cache cache to fill or NULL
+     */
+    void setMovingCache(StepCache* cache) {m_MovingCache = cache;}
+
   signals:
     /**
      * @brief updateFilterParameters Emitted when the Filter requests all the latest Filter parameters
@@ -179,6 +286,31 @@ class MatchFeatureIds : public AbstractFilter
      */
     void dataCheck();
 
+    /**
+     * @brief findCorrespondences Groups features related by splits and merges (pairs where most of the smaller feature lies inside the larger one)
+     * @param intersections overlapping pairs as (moving id << 32 | reference id, voxel count) sorted by key
+     * @param referenceVolumes voxel count of each reference feature
+     * @param movingVolumes voxel count of each moving feature
+     * @param idMap map from current to new moving feature ids
+     */
+    void findCorrespondences(const std::vector< std::pair<uint64_t, int64_t> >& intersections, const std::vector<int64_t>& referenceVolumes, const std::vector<int64_t>& movingVolumes, const std::vector<size_t>& idMap);
+
+    /**
+     * @brief writeOverlapTable Fills the feature pair attribute matrix with all overlapping pairs sorted by reference id then (new) moving id
+     * @param intersections overlapping pairs as (moving id << 32 | reference id, voxel count) sorted by key
+     * @param referenceVolumes voxel count of each reference feature
+     * @param movingVolumes voxel count of each moving feature
+     * @param idMap map from current to new moving feature ids
+     */
+    void writeOverlapTable(const std::vector< std::pair<uint64_t, int64_t> >& intersections, const std::vector<int64_t>& referenceVolumes, const std::vector<int64_t>& movingVolumes, const std::vector<size_t>& idMap);
+
+    /**
+     * @brief findCentroidPairs Finds candidate pairs from feature centroids (every reference feature within the search radius of each moving feature)
+     * @param doParallel true to query the tree with the scheduler initialized by execute
+     * @return candidate pairs scored by distance (and diameter ratio) sorted by moving id then reference id
+     */
+    std::vector< std::pair<uint64_t, float> > findCentroidPairs(bool doParallel);
+
   private:
     QVector<SpaceGroupOps::Pointer> m_OrientationOps;
     DEFINE_DATAARRAY_VARIABLE(float, Overlap)
@@ -192,6 +324,22 @@ class MatchFeatureIds : public AbstractFilter
     DEFINE_DATAARRAY_VARIABLE(int32_t, MovingPhases)
     DEFINE_DATAARRAY_VARIABLE(unsigned int, ReferenceCrystalStructures)
     DEFINE_DATAARRAY_VARIABLE(unsigned int, MovingCrystalStructures)
+    DEFINE_DATAARRAY_VARIABLE(float, ReferenceCentroids)
+    DEFINE_DATAARRAY_VARIABLE(float, MovingCentroids)
+    DEFINE_DATAARRAY_VARIABLE(float, ReferenceDiameters)
+    DEFINE_DATAARRAY_VARIABLE(float, MovingDiameters)
+    DEFINE_DATAARRAY_VARIABLE(float, Transformation)
+    DEFINE_DATAARRAY_VARIABLE(int32_t, ReferenceGroupIds)
+    DEFINE_DATAARRAY_VARIABLE(int32_t, MovingGroupIds)
+    NeighborList<int32_t>::WeakPointer m_ReferenceCorrespondences;
+    NeighborList<int32_t>::WeakPointer m_MovingCorrespondences;
+    DEFINE_DATAARRAY_VARIABLE(int32_t, PairReferenceIds)
+    DEFINE_DATAARRAY_VARIABLE(int32_t, PairMovingIds)
+    DEFINE_DATAARRAY_VARIABLE(int64_t, PairVoxelCounts)
+    DEFINE_DATAARRAY_VARIABLE(float, PairMetric)
+    DEFINE_DATAARRAY_VARIABLE(int64_t, OverlapTableOffsets)
+    StepCache* m_ReferenceCache;
+    StepCache* m_MovingCache;
 
     MatchFeatureIds(const MatchFeatureIds&); // Copy Constructor Not Implemented
     void operator=(const MatchFeatureIds&); // Operator '=' Not Implemented
@@ -204,6 +204,7 @@ void RegisterOrientations::execute()
   QuatF* referenceQuats = reinterpret_cast<QuatF*>(m_ReferenceAvgQuats);
 
   //create list of shared grains
+  notifyStatusMessage(getHumanLabel(), "Finding shared features");
   size_t referenceNumFeatures = m_ReferencePhasesPtr.lock()->getNumberOfTuples();
   size_t movingNumFeatures = m_MovingPhasesPtr.lock()->getNumberOfTuples();
   size_t numFeatures = std::min(referenceNumFeatures, movingNumFeatures);
@@ -245,6 +246,7 @@ void RegisterOrientations::execute()
   }
 
   //loop over matched features determining best rotation from each pair (testing against all other pairs)
+  notifyStatusMessage(getHumanLabel(), "Comparing candidate rotations");
   size_t matchCount = 0;
   double minMisoAngle = getMinMiso() * M_PI / 180.0f;
 
@@ -321,6 +323,7 @@ void RegisterOrientations::execute()
     return;
   }
 
+  notifyStatusMessage(getHumanLabel(), "Rotating moving orientations");
   QuaternionMathF::UnitQuaternion(rotation);//for cubochoric divide by matchCount
   for(int i = 0; i < movingNumFeatures; i++)
   {
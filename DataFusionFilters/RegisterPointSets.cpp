@@ -24,20 +24,588 @@
 #include "SIMPLib/FilterParameters/AbstractFilterParametersWriter.h"
 
 #include "SIMPLib/FilterParameters/BooleanFilterParameter.h"
+#include "SIMPLib/FilterParameters/ChoiceFilterParameter.h"
+#include "SIMPLib/FilterParameters/DoubleFilterParameter.h"
+#include "SIMPLib/FilterParameters/IntFilterParameter.h"
 #include "SIMPLib/FilterParameters/LinkedBooleanFilterParameter.h"
 #include "SIMPLib/FilterParameters/LinkedChoicesFilterParameter.h"
 #include "SIMPLib/FilterParameters/DataArraySelectionFilterParameter.h"
 #include "SIMPLib/FilterParameters/StringFilterParameter.h"
 #include "SIMPLib/FilterParameters/DataContainerSelectionFilterParameter.h"
 
+#ifdef SIMPLib_USE_PARALLEL_ALGORITHMS
+  #include <tbb/parallel_for.h>
+  #include <tbb/parallel_reduce.h>
+  #include <tbb/blocked_range.h>
+  #include <tbb/partitioner.h>
+  #include <tbb/task_scheduler_init.h>
+#endif
+
 #include "DataFusion/DataFusionConstants.h"
+#include "DataFusion/DataFusionFilters/util/KdTree.h"
+#include "DataFusion/DataFusionFilters/util/StepNames.h"
+#include "DataFusion/DataFusionFilters/util/WeightedMoments.h"
 
 // Include the MOC generated file for this class
 #include "moc_RegisterPointSets.cpp"
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <random>
+
 #include <Eigen/Dense>
 #include <Eigen/SVD>
 
+namespace Detail
+{
+// pairs of corresponding points (moving point index, reference point index)
+typedef std::vector< std::pair<size_t, size_t> > PointPairs;
+
+// weighted centroids and (co)variance of paired points (weights are indexed by reference point)
+void computeMoments(const float* moving, const float* reference, const PointPairs& pairs, const float* weights, Eigen::Vector3d& xBar, Eigen::Vector3d& yBar, Eigen::Matrix3d& covariance, Eigen::Matrix3d& variance)
+{
+  WeightedMoments moments = WeightedMoments::Accumulate(moving, reference, pairs, weights);
+  xBar = Eigen::Vector3d(moments.xBar());//moving points centroid
+  yBar = Eigen::Vector3d(moments.yBar());//reference points centroid
+  covariance = Eigen::Map<const Eigen::Matrix<double, 3, 3, Eigen::RowMajor> >(moments.covariance());
+  variance = Eigen::Map<const Eigen::Matrix<double, 3, 3, Eigen::RowMajor> >(moments.variance());
+}
+
+// allowed degrees of freedom (translation is always allowed)
+struct DegreesOfFreedom
+{
+  bool rotation;
+  bool scaling;
+  int scalingType;//0: isotropic, 1: anisotropic
+  bool affine;
+
+  // fewest pairs that determine a transformation
+  size_t minimalPairs() const
+  {
+    if(affine) return 4;
+    if(rotation || scaling) return 3;
+    return 1;
+  }
+};
+
+// least squares transformation of centered moving points onto centered reference points for the allowed degrees of freedom
+// returns false if the variance matrix is singular (full affine only)
+bool solveLinear(const Eigen::Matrix3d& covariance, const Eigen::Matrix3d& variance, const DegreesOfFreedom& dof, Eigen::Matrix3d& transformation)
+{
+  transformation = Eigen::Matrix3d::Identity();
+
+  //shear (requires full affine) and no shear are handled differently
+  if(dof.affine)
+  {
+    bool invertible;
+    Eigen::Matrix3d inverse;
+    variance.computeInverseWithCheck(inverse, invertible);
+    if(invertible)
+      transformation = inverse * covariance;
+    transformation.transposeInPlace();
+    return invertible;
+  }
+
+  if(dof.rotation)
+  {
+    //perform singular value decomposition of covariance matrix
+    Eigen::JacobiSVD<Eigen::Matrix3d> svd(covariance, Eigen::ComputeFullU | Eigen::ComputeFullV);
+
+    //check determinates (det(V) * det(U) == 1 for rotation or -1 for rotation + reflection)
+    //least square rotation matrix is V * I * U^T if det(V) == 1, V * {{1,0,0},{0,1,0},{0,0,-1}} * U^T if == -1
+    Eigen::Matrix3d i = Eigen::Matrix3d::Identity();
+    if(svd.matrixV().determinant() * svd.matrixU().determinant() < 0)
+      i(2, 2) = -1;
+    transformation = svd.matrixV() * i * svd.matrixU().transpose();
+  }
+
+  if(dof.scaling)
+  {
+    Eigen::Matrix3d scale = Eigen::Matrix3d::Identity();
+    Eigen::Matrix3d numerator = transformation * covariance;
+    Eigen::Matrix3d denomenator = transformation * variance * transformation.transpose();
+
+    if(0 == dof.scalingType)//isotropic scaling
+      scale.diagonal().fill( numerator.trace() / denomenator.trace() );
+    else//anisotropic scaling
+      scale.diagonal() = numerator.diagonal().cwiseQuotient(denomenator.diagonal());
+
+    transformation = transformation * scale;
+  }
+  return true;
+}
+
+// distance between each transformed moving point and its paired reference point, along with the sum of squared and largest distance
+class ResidualFinder
+{
+  public:
+    ResidualFinder(const float* moving, const float* reference, const PointPairs& pairs, const Eigen::Matrix3d& transformation, const Eigen::Vector3d& translation, std::vector<double>& residuals) :
+      m_Moving(moving),
+      m_Reference(reference),
+      m_Pairs(pairs),
+      m_Transformation(transformation),
+      m_Translation(translation),
+      m_Residuals(residuals),
+      m_SumSquares(0.0),
+      m_Max(0.0)
+    {}
+
+    void find(size_t start, size_t end)
+    {
+      for(size_t i = start; i < end; i++)
+      {
+        const float* x = m_Moving + 3 * m_Pairs[i].first;
+        const float* y = m_Reference + 3 * m_Pairs[i].second;
+        const double residual2 = (m_Transformation * Eigen::Vector3d(x[0], x[1], x[2]) + m_Translation - Eigen::Vector3d(y[0], y[1], y[2])).squaredNorm();
+        m_Residuals[i] = std::sqrt(residual2);
+        m_SumSquares += residual2;
+        m_Max = std::max(m_Max, m_Residuals[i]);
+      }
+    }
+
+#ifdef SIMPLib_USE_PARALLEL_ALGORITHMS
+    ResidualFinder(ResidualFinder& other, tbb::split) :
+      m_Moving(other.m_Moving),
+      m_Reference(other.m_Reference),
+      m_Pairs(other.m_Pairs),
+      m_Transformation(other.m_Transformation),
+      m_Translation(other.m_Translation),
+      m_Residuals(other.m_Residuals),
+      m_SumSquares(0.0),
+      m_Max(0.0)
+    {}
+
+    void operator()(const tbb::blocked_range<size_t>& r)
+    {
+      find(r.begin(), r.end());
+    }
+
+    void join(const ResidualFinder& other)
+    {
+      m_SumSquares += other.m_SumSquares;
+      m_Max = std::max(m_Max, other.m_Max);
+    }
+#endif
+
+    double sumSquares() const {return m_SumSquares;}
+    double max() const {return m_Max;}
+
+  private:
+    const float* m_Moving;
+    const float* m_Reference;
+    const PointPairs& m_Pairs;
+    Eigen::Matrix3d m_Transformation;
+    Eigen::Vector3d m_Translation;
+    std::vector<double>& m_Residuals;
+    double m_SumSquares;
+    double m_Max;
+};
+
+// M-estimator weight of a residual scaled by the tuning constant (0: Huber, 1: Tukey biweight)
+double robustWeight(int function, double u)
+{
+  if(0 == function)
+    return u <= 1.0 ? 1.0 : 1.0 / u;
+  if(u >= 1.0)
+    return 0.0;
+  double v = 1.0 - u * u;
+  return v * v;
+}
+
+// scores random minimal sets of pairs by the number of pairs the transformation solved from them brings within the inlier distance
+// each hypothesis draws its sample from its own generator so the result doesn't depend on how hypotheses are split between threads
+class HypothesisEvaluator
+{
+  public:
+    HypothesisEvaluator(const float* moving, const float* reference, const PointPairs& pairs, const DegreesOfFreedom& dof, double inlierDistance, size_t firstHypothesis, size_t bestCount, std::vector<size_t>& counts) :
+      m_Moving(moving),
+      m_Reference(reference),
+      m_Pairs(pairs),
+      m_Dof(dof),
+      m_InlierDistance2(inlierDistance * inlierDistance),
+      m_FirstHypothesis(firstHypothesis),
+      m_BestCount(bestCount),
+      m_Counts(counts)
+    {}
+
+    // solves for the transformation of a hypothesis, returns false if the sample is degenerate
+    bool solve(size_t hypothesis, Eigen::Matrix3d& transformation, Eigen::Vector3d& translation) const
+    {
+      //draw distinct pairs
+      const size_t sampleSize = m_Dof.minimalPairs();
+      PointPairs sample(sampleSize);
+      std::vector<size_t> indices(sampleSize);
+      std::mt19937 generator(static_cast<std::mt19937::result_type>(hypothesis));
+      std::uniform_int_distribution<size_t> distribution(0, m_Pairs.size() - 1);
+      for(size_t i = 0; i < sampleSize; i++)
+      {
+        do
+        {
+          indices[i] = distribution(generator);
+        } while(std::find(indices.begin(), indices.begin() + i, indices[i]) != indices.begin() + i);
+        sample[i] = m_Pairs[indices[i]];
+      }
+
+      Eigen::Vector3d xBar, yBar;
+      Eigen::Matrix3d covariance, variance;
+      computeMoments(m_Moving, m_Reference, sample, NULL, xBar, yBar, covariance, variance);
+      if(!solveLinear(covariance, variance, m_Dof, transformation)) return false;
+      translation = yBar - transformation * xBar;
+      return true;
+    }
+
+    void evaluate(size_t start, size_t end) const
+    {
+      const size_t numPairs = m_Pairs.size();
+      Eigen::Matrix3d transformation;
+      Eigen::Vector3d translation;
+      for(size_t h = start; h < end; h++)
+      {
+        m_Counts[h] = 0;
+        if(!solve(m_FirstHypothesis + h, transformation, translation)) continue;
+
+        //stop counting once the hypothesis can't beat the best from earlier batches
+        size_t count = 0;
+        for(size_t i = 0; i < numPairs && count + (numPairs - i) > m_BestCount; i++)
+        {
+          const float* x = m_Moving + 3 * m_Pairs[i].first;
+          const float* y = m_Reference + 3 * m_Pairs[i].second;
+          Eigen::Vector3d residual = transformation * Eigen::Vector3d(x[0], x[1], x[2]) + translation - Eigen::Vector3d(y[0], y[1], y[2]);
+          if(residual.squaredNorm() <= m_InlierDistance2) count++;
+        }
+        m_Counts[h] = count;
+      }
+    }
+
+#ifdef SIMPLib_USE_PARALLEL_ALGORITHMS
+    void operator()(const tbb::blocked_range<size_t>& r) const
+    {
+      evaluate(r.begin(), r.end());
+    }
+#endif
+
+  private:
+    const float* m_Moving;
+    const float* m_Reference;
+    const PointPairs& m_Pairs;
+    DegreesOfFreedom m_Dof;
+    double m_InlierDistance2;
+    size_t m_FirstHypothesis;
+    size_t m_BestCount;
+    std::vector<size_t>& m_Counts;
+};
+
+// layout of the bootstrap uncertainty of a transformation: rms and 95th percentile rotation angle from the fitted rotation (degrees),
+// standard deviation of the rotation vector (degrees), of the scale factors and of the translation, and the number of resamples that couldn't be solved
+const size_t k_UncertaintyComponents = 12;
+
+// splits the linear part of a transformation into a rotation and a symmetric stretch (polar decomposition A = R * S)
+// the scale factors are the diagonal of the stretch, which is exactly the scaling of transformations without shear
+void decompose(const Eigen::Matrix3d& linear, Eigen::Matrix3d& rotation, Eigen::Vector3d& scale)
+{
+  Eigen::JacobiSVD<Eigen::Matrix3d> svd(linear, Eigen::ComputeFullU | Eigen::ComputeFullV);
+  Eigen::Matrix3d i = Eigen::Matrix3d::Identity();
+  if(svd.matrixU().determinant() * svd.matrixV().determinant() < 0)
+    i(2, 2) = -1;
+  rotation = svd.matrixU() * i * svd.matrixV().transpose();
+  scale = (rotation.transpose() * linear).diagonal();
+}
+
+// solves for the transformation of bootstrap resamples of the fitted pairs (drawn with replacement) and decomposes each into
+// a rotation vector (axis * angle of the rotation away from the fitted rotation), scale factors and absolute translation
+// pairs are drawn straight into the moment accumulator so resamples don't allocate, and each resample has its own generator so results don't depend on threading
+// resamples that can't be solved (singular variance or zero scaling denominator) are flagged so they can be left out of the spread
+class BootstrapResampler
+{
+  public:
+    BootstrapResampler(const float* moving, const float* reference, const PointPairs& pairs, const float* weights, const DegreesOfFreedom& dof,
+                       const Eigen::Vector3d& refOrigin, const Eigen::Vector3d& movOrigin, const Eigen::Matrix3d& fitted, std::vector<double>& parameters, std::vector<char>& solved) :
+      m_Moving(moving),
+      m_Reference(reference),
+      m_Pairs(pairs),
+      m_Weights(weights),
+      m_Dof(dof),
+      m_RefOrigin(refOrigin),
+      m_MovOrigin(movOrigin),
+      m_Parameters(parameters),
+      m_Solved(solved)
+    {
+      Eigen::Vector3d scale;
+      decompose(fitted, m_FittedRotation, scale);
+    }
+
+    void resample(size_t start, size_t end) const
+    {
+      const size_t numPairs = m_Pairs.size();
+      Eigen::Matrix3d transformation;
+      Eigen::Matrix3d rotation;
+      Eigen::Vector3d scale;
+      for(size_t r = start; r < end; r++)
+      {
+        std::mt19937 generator(static_cast<std::mt19937::result_type>(r));
+        std::uniform_int_distribution<size_t> distribution(0, numPairs - 1);
+        WeightedMoments moments;
+        for(size_t i = 0; i < numPairs; i++)
+        {
+          const std::pair<size_t, size_t>& pair = m_Pairs[distribution(generator)];
+          moments.add(m_Moving + 3 * pair.first, m_Reference + 3 * pair.second, NULL == m_Weights ? 1.0 : m_Weights[pair.second]);
+        }
+
+        //solve and convert to absolute translation (same as the final fit)
+        Eigen::Vector3d xBar(moments.xBar());
+        Eigen::Vector3d yBar(moments.yBar());
+        Eigen::Matrix3d covariance = Eigen::Map<const Eigen::Matrix<double, 3, 3, Eigen::RowMajor> >(moments.covariance());
+        Eigen::Matrix3d variance = Eigen::Map<const Eigen::Matrix<double, 3, 3, Eigen::RowMajor> >(moments.variance());
+        m_Solved[r] = solveLinear(covariance, variance, m_Dof, transformation) && transformation.allFinite() && 0.0 != transformation.determinant();
+        if(!m_Solved[r]) continue;
+        Eigen::Vector3d translation = yBar - transformation * xBar + m_RefOrigin - transformation * m_MovOrigin;
+
+        //rotation vector, scale factors, translation
+        decompose(transformation, rotation, scale);
+        Eigen::AngleAxisd deviation(rotation * m_FittedRotation.transpose());
+        double* parameters = &m_Parameters[9 * r];
+        Eigen::Map<Eigen::Vector3d>(parameters) = deviation.angle() * deviation.axis();
+        Eigen::Map<Eigen::Vector3d>(parameters + 3) = scale;
+        Eigen::Map<Eigen::Vector3d>(parameters + 6) = translation;
+      }
+    }
+
+#ifdef SIMPLib_USE_PARALLEL_ALGORITHMS
+    void operator()(const tbb::blocked_range<size_t>& r) const
+    {
+      resample(r.begin(), r.end());
+    }
+#endif
+
+  private:
+    const float* m_Moving;
+    const float* m_Reference;
+    const PointPairs& m_Pairs;
+    const float* m_Weights;
+    DegreesOfFreedom m_Dof;
+    Eigen::Vector3d m_RefOrigin;
+    Eigen::Vector3d m_MovOrigin;
+    Eigen::Matrix3d m_FittedRotation;
+    std::vector<double>& m_Parameters;
+    std::vector<char>& m_Solved;
+};
+
+// finds the closest reference point to each transformed moving point
+class ClosestPointFinder
+{
+  public:
+    ClosestPointFinder(const KdTree<float>& tree, const float* moving, const std::vector<size_t>& movingPoints, const Eigen::Matrix3d& transformation, const Eigen::Vector3d& translation,
+                       std::vector<size_t>& closest, std::vector<float>& distance2) :
+      m_Tree(tree),
+      m_Moving(moving),
+      m_MovingPoints(movingPoints),
+      m_Transformation(transformation),
+      m_Translation(translation),
+      m_Closest(closest),
+      m_Distance2(distance2)
+    {}
+
+    void find(size_t start, size_t end) const
+    {
+      std::vector< std::pair<float, size_t> > result;
+      float query[3];
+      for(size_t i = start; i < end; i++)
+      {
+        const float* point = m_Moving + 3 * m_MovingPoints[i];
+        Eigen::Vector3d x = m_Transformation * Eigen::Vector3d(point[0], point[1], point[2]) + m_Translation;
+        for(size_t j = 0; j < 3; j++)
+          query[j] = static_cast<float>(x[j]);
+        m_Tree.kNearest(query, 1, result);
+        m_Closest[i] = result[0].second;
+        m_Distance2[i] = result[0].first;
+      }
+    }
+
+#ifdef SIMPLib_USE_PARALLEL_ALGORITHMS
+    void operator()(const tbb::blocked_range<size_t>& r) const
+    {
+      find(r.begin(), r.end());
+    }
+#endif
+
+  private:
+    const KdTree<float>& m_Tree;
+    const float* m_Moving;
+    const std::vector<size_t>& m_MovingPoints;
+    Eigen::Matrix3d m_Transformation;
+    Eigen::Vector3d m_Translation;
+    std::vector<size_t>& m_Closest;
+    std::vector<float>& m_Distance2;
+};
+
+// finds the reference points with the most similar descriptors to each moving point
+class DescriptorMatcher
+{
+  public:
+    DescriptorMatcher(const KdTree<float>& tree, const float* descriptors, size_t candidates, std::vector<size_t>& matches) :
+      m_Tree(tree),
+      m_Descriptors(descriptors),
+      m_Candidates(candidates),
+      m_Matches(matches)
+    {}
+
+    void match(size_t start, size_t end) const
+    {
+      std::vector< std::pair<float, size_t> > result;
+      const size_t dims = m_Tree.dimensions();
+      for(size_t i = start; i < end; i++)
+      {
+        m_Tree.kNearest(m_Descriptors + dims * i, m_Candidates, result);
+        for(size_t j = 0; j < m_Candidates; j++)
+          m_Matches[m_Candidates * i + j] = j < result.size() ? result[j].second : m_Tree.size();
+      }
+    }
+
+#ifdef SIMPLib_USE_PARALLEL_ALGORITHMS
+    void operator()(const tbb::blocked_range<size_t>& r) const
+    {
+      match(r.begin(), r.end());
+    }
+#endif
+
+  private:
+    const KdTree<float>& m_Tree;
+    const float* m_Descriptors;
+    size_t m_Candidates;
+    std::vector<size_t>& m_Matches;
+};
+
+// orders (votes, candidate) pairs by decreasing votes
+bool moreVotes(const std::pair<size_t, size_t>& a, const std::pair<size_t, size_t>& b)
+{
+  return a.first > b.first;
+}
+
+// counts the spatial neighbors of each moving point with a candidate match at a consistent distance from each of its candidates (distances are preserved by rigid motion)
+class ConsistencyVoter
+{
+  public:
+    ConsistencyVoter(const KdTree<float>& tree, const float* moving, const float* reference, size_t numReference, const std::vector<size_t>& matches, size_t candidates, size_t neighbors, float tolerance, std::vector<size_t>& votes) :
+      m_Tree(tree),
+      m_Moving(moving),
+      m_Reference(reference),
+      m_NumReference(numReference),
+      m_Matches(matches),
+      m_Candidates(candidates),
+      m_Neighbors(neighbors),
+      m_Tolerance(tolerance),
+      m_Votes(votes)
+    {}
+
+    void vote(size_t start, size_t end) const
+    {
+      std::vector< std::pair<float, size_t> > result;
+      for(size_t i = start; i < end; i++)
+      {
+        const float* x = m_Moving + 3 * i;
+        m_Tree.kNearest(x, m_Neighbors + 1, result);//includes the point itself
+        for(size_t j = 0; j < m_Candidates; j++)
+        {
+          const size_t r = m_Matches[m_Candidates * i + j];
+          size_t count = 0;
+          if(r < m_NumReference)
+          {
+            const float* y = m_Reference + 3 * r;
+            for(size_t n = 0; n < result.size(); n++)
+            {
+              const size_t neighbor = result[n].second;
+              if(neighbor == i) continue;
+              const float movingDistance = std::sqrt(result[n].first);
+              for(size_t k = 0; k < m_Candidates; k++)
+              {
+                const size_t r2 = m_Matches[m_Candidates * neighbor + k];
+                if(r2 >= m_NumReference || r2 == r) continue;
+                const float* y2 = m_Reference + 3 * r2;
+                const float referenceDistance = std::sqrt((y[0] - y2[0]) * (y[0] - y2[0]) + (y[1] - y2[1]) * (y[1] - y2[1]) + (y[2] - y2[2]) * (y[2] - y2[2]));
+                if(std::fabs(movingDistance - referenceDistance) <= m_Tolerance)
+                {
+                  ++count;//each neighbor votes at most once
+                  break;
+                }
+              }
+            }
+          }
+          m_Votes[m_Candidates * i + j] = count;
+        }
+      }
+    }
+
+#ifdef SIMPLib_USE_PARALLEL_ALGORITHMS
+    void operator()(const tbb::blocked_range<size_t>& r) const
+    {
+      vote(r.begin(), r.end());
+    }
+#endif
+
+  private:
+    const KdTree<float>& m_Tree;
+    const float* m_Moving;
+    const float* m_Reference;
+    size_t m_NumReference;
+    const std::vector<size_t>& m_Matches;
+    size_t m_Candidates;
+    size_t m_Neighbors;
+    float m_Tolerance;
+    std::vector<size_t>& m_Votes;
+};
+
+// copies a data container into new attribute matrices that share the original arrays (except the skipped ones) so arrays can be created in the copy without modifying the original
+DataContainer::Pointer shallowCopy(DataContainer::Pointer dataContainer, const QString& skippedMatrix, const QStringList& skippedArrays)
+{
+  DataContainer::Pointer copy = DataContainer::New(dataContainer->getName());
+  copy->setGeometry(dataContainer->getGeometry());
+  QList<QString> matrixNames = dataContainer->getAttributeMatrixNames();
+  for(QList<QString>::iterator iter = matrixNames.begin(); iter != matrixNames.end(); ++iter)
+  {
+    if(*iter == skippedMatrix) continue;
+    AttributeMatrix::Pointer matrix = dataContainer->getAttributeMatrix(*iter);
+    AttributeMatrix::Pointer matrixCopy = AttributeMatrix::New(matrix->getTupleDimensions(), matrix->getName(), matrix->getType());
+    QList<QString> arrayNames = matrix->getAttributeArrayNames();
+    for(QList<QString>::iterator arrayIter = arrayNames.begin(); arrayIter != arrayNames.end(); ++arrayIter)
+    {
+      if(!skippedArrays.contains(*arrayIter)) matrixCopy->addAttributeArray(*arrayIter, matrix->getAttributeArray(*arrayIter));
+    }
+    copy->addAttributeMatrix(*iter, matrixCopy);
+  }
+  return copy;
+}
+
+// the same array in another data container
+DataArrayPath inDataContainer(const QString& dataContainer, const DataArrayPath& path)
+{
+  return DataArrayPath(dataContainer, path.getAttributeMatrixName(), path.getDataArrayName());
+}
+
+// registers batch pairs (each filter works on its own data container array)
+class PairRegistrar
+{
+  public:
+    PairRegistrar(const std::vector<RegisterPointSets::Pointer>& filters) : m_Filters(filters) {}
+
+    void registerPairs(size_t start, size_t end) const
+    {
+      for(size_t i = start; i < end; i++)
+        m_Filters[i]->execute();
+    }
+
+#ifdef SIMPLib_USE_PARALLEL_ALGORITHMS
+    void operator()(const tbb::blocked_range<size_t>& r) const
+    {
+      registerPairs(r.begin(), r.end());
+    }
+#endif
+
+  private:
+    const std::vector<RegisterPointSets::Pointer>& m_Filters;
+};
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -47,6 +615,8 @@ RegisterPointSets::RegisterPointSets() :
   m_MovingCentroidsArrayPath(DREAM3D::Defaults::VolumeDataContainerName, DREAM3D::Defaults::CellFeatureAttributeMatrixName, DREAM3D::FeatureData::Centroids),
   m_ReferenceGoodFeaturesArrayPath(DREAM3D::Defaults::VolumeDataContainerName, DREAM3D::Defaults::CellFeatureAttributeMatrixName, DREAM3D::FeatureData::GoodFeatures),
   m_MovingGoodFeaturesArrayPath(DREAM3D::Defaults::VolumeDataContainerName, DREAM3D::Defaults::CellFeatureAttributeMatrixName, DREAM3D::FeatureData::GoodFeatures),
+  m_ReferenceDescriptorsArrayPath(DREAM3D::Defaults::VolumeDataContainerName, DREAM3D::Defaults::CellFeatureAttributeMatrixName, DataFusionConstants::Descriptors),
+  m_MovingDescriptorsArrayPath(DREAM3D::Defaults::VolumeDataContainerName, DREAM3D::Defaults::CellFeatureAttributeMatrixName, DataFusionConstants::Descriptors),
   m_AttributeMatrixName(DataFusionConstants::Transformation),
   m_AllowTranslation(true),
   m_AllowRotation(true),
@@ -55,12 +625,49 @@ RegisterPointSets::RegisterPointSets() :
   m_AllowShearing(false),
   m_UseGoodPoints(true),
   m_UseWeights(true),
+  m_CorrespondenceType(0),
+  m_MaxIterations(50),
+  m_MaxPairDistance(0.0),
+  m_ConvergenceTolerance(1e-6),
+  m_DescriptorCandidates(3),
+  m_VotingNeighbors(10),
+  m_ConsistencyDistance(1.0),
+  m_MinimumVotes(2),
+  m_RobustMethod(0),
+  m_InlierDistance(1.0),
+  m_MaxHypotheses(1000),
+  m_RansacConfidence(0.99),
+  m_WeightFunction(0),
+  m_TuningConstant(0.0),
+  m_RobustIterations(20),
+  m_EstimateUncertainty(false),
+  m_BootstrapResamples(1000),
+  m_BatchRegistration(false),
+  m_DataContainerPrefix("Section"),
+  m_RegistrationPairs(""),
   m_TransformName(DataFusionConstants::Transformation),
+  m_InliersArrayName(DataFusionConstants::Inliers),
+  m_ResidualsArrayName(DataFusionConstants::Residuals),
+  m_RmsResidualArrayName(DataFusionConstants::RmsResidual),
+  m_MedianResidualArrayName(DataFusionConstants::MedianResidual),
+  m_MaxResidualArrayName(DataFusionConstants::MaxResidual),
+  m_ConditionNumberArrayName(DataFusionConstants::ConditionNumber),
+  m_TransformationUncertaintyArrayName(DataFusionConstants::TransformationUncertainty),
   m_ReferenceCentroids(NULL),
   m_MovingCentroids(NULL),
   m_ReferenceGoodFeatures(NULL),
   m_MovingGoodFeatures(NULL),
-  m_Transform(NULL)
+  m_ReferenceDescriptors(NULL),
+  m_MovingDescriptors(NULL),
+  m_Transform(NULL),
+  m_Inliers(NULL),
+  m_Residuals(NULL),
+  m_RmsResidual(NULL),
+  m_MedianResidual(NULL),
+  m_MaxResidual(NULL),
+  m_ConditionNumber(NULL),
+  m_TransformationUncertainty(NULL),
+  m_BatchPair(false)
 {
   setupFilterParameters();
 }
@@ -79,6 +686,91 @@ void RegisterPointSets::setupFilterParameters()
 {
   FilterParameterVector parameters;
 
+  {
+    QVector<QString> choices;
+    choices.push_back("Matching Indices");
+    choices.push_back("Closest Points (ICP)");
+    choices.push_back("Shape Descriptors");
+    QStringList linkedProps;
+    linkedProps << "MaxIterations" << "MaxPairDistance" << "ConvergenceTolerance";
+    linkedProps << "DescriptorCandidates" << "VotingNeighbors" << "ConsistencyDistance" << "MinimumVotes" << "ReferenceDescriptorsArrayPath" << "MovingDescriptorsArrayPath";
+    LinkedChoicesFilterParameter::Pointer parameter = LinkedChoicesFilterParameter::New();
+    parameter->setHumanLabel("Correspondences");
+    parameter->setPropertyName("CorrespondenceType");
+    parameter->setChoices(choices);
+    parameter->setLinkedProperties(linkedProps);
+    parameter->setCategory(FilterParameter::Parameter);
+    parameters.push_back(parameter);
+  }
+  parameters.push_back(IntFilterParameter::New("Maximum Iterations", "MaxIterations", getMaxIterations(), FilterParameter::Parameter));
+  parameters.back()->setGroupIndex(1);
+  parameters.push_back(DoubleFilterParameter::New("Maximum Pair Distance", "MaxPairDistance", getMaxPairDistance(), FilterParameter::Parameter));
+  parameters.back()->setGroupIndex(1);
+  parameters.push_back(DoubleFilterParameter::New("Convergence Tolerance", "ConvergenceTolerance", getConvergenceTolerance(), FilterParameter::Parameter));
+  parameters.back()->setGroupIndex(1);
+  parameters.push_back(IntFilterParameter::New("Descriptor Candidates", "DescriptorCandidates", getDescriptorCandidates(), FilterParameter::Parameter));
+  parameters.back()->setGroupIndex(2);
+  parameters.push_back(IntFilterParameter::New("Voting Neighbors", "VotingNeighbors", getVotingNeighbors(), FilterParameter::Parameter));
+  parameters.back()->setGroupIndex(2);
+  parameters.push_back(DoubleFilterParameter::New("Consistency Distance", "ConsistencyDistance", getConsistencyDistance(), FilterParameter::Parameter));
+  parameters.back()->setGroupIndex(2);
+  parameters.push_back(IntFilterParameter::New("Minimum Votes", "MinimumVotes", getMinimumVotes(), FilterParameter::Parameter));
+  parameters.back()->setGroupIndex(2);
+
+  {
+    QVector<QString> choices;
+    choices.push_back("None");
+    choices.push_back("RANSAC");
+    choices.push_back("M-Estimator (IRLS)");
+    QStringList linkedProps;
+    linkedProps << "InlierDistance" << "MaxHypotheses" << "RansacConfidence" << "InliersArrayName";
+    linkedProps << "WeightFunction" << "TuningConstant" << "RobustIterations";
+    LinkedChoicesFilterParameter::Pointer parameter = LinkedChoicesFilterParameter::New();
+    parameter->setHumanLabel("Robust Estimation");
+    parameter->setPropertyName("RobustMethod");
+    parameter->setChoices(choices);
+    parameter->setLinkedProperties(linkedProps);
+    parameter->setCategory(FilterParameter::Parameter);
+    parameters.push_back(parameter);
+  }
+  parameters.push_back(DoubleFilterParameter::New("Inlier Distance", "InlierDistance", getInlierDistance(), FilterParameter::Parameter));
+  parameters.back()->setGroupIndex(1);
+  parameters.push_back(IntFilterParameter::New("Maximum Hypotheses", "MaxHypotheses", getMaxHypotheses(), FilterParameter::Parameter));
+  parameters.back()->setGroupIndex(1);
+  parameters.push_back(DoubleFilterParameter::New("Confidence", "RansacConfidence", getRansacConfidence(), FilterParameter::Parameter));
+  parameters.back()->setGroupIndex(1);
+  {
+    QVector<QString> choices;
+    choices.push_back("Huber");
+    choices.push_back("Tukey Biweight");
+    ChoiceFilterParameter::Pointer parameter = ChoiceFilterParameter::New();
+    parameter->setHumanLabel("Weight Function");
+    parameter->setPropertyName("WeightFunction");
+    parameter->setChoices(choices);
+    parameter->setCategory(FilterParameter::Parameter);
+    parameter->setGroupIndex(2);
+    parameters.push_back(parameter);
+  }
+  parameters.push_back(DoubleFilterParameter::New("Tuning Constant", "TuningConstant", getTuningConstant(), FilterParameter::Parameter));
+  parameters.back()->setGroupIndex(2);
+  parameters.push_back(IntFilterParameter::New("Maximum Reweighting Iterations", "RobustIterations", getRobustIterations(), FilterParameter::Parameter));
+  parameters.back()->setGroupIndex(2);
+
+  {
+    QStringList linkedProps;
+    linkedProps << "BootstrapResamples" << "TransformationUncertaintyArrayName";
+    parameters.push_back(LinkedBooleanFilterParameter::New("Estimate Uncertainty (Bootstrap)", "EstimateUncertainty", getEstimateUncertainty(), linkedProps, FilterParameter::Parameter));
+  }
+  parameters.push_back(IntFilterParameter::New("Bootstrap Resamples", "BootstrapResamples", getBootstrapResamples(), FilterParameter::Parameter));
+
+  {
+    QStringList linkedProps;
+    linkedProps << "DataContainerPrefix" << "RegistrationPairs";
+    parameters.push_back(LinkedBooleanFilterParameter::New("Batch Registration", "BatchRegistration", getBatchRegistration(), linkedProps, FilterParameter::Parameter));
+  }
+  parameters.push_back(StringFilterParameter::New("Step Data Container Prefix", "DataContainerPrefix", getDataContainerPrefix(), FilterParameter::Parameter));
+  parameters.push_back(StringFilterParameter::New("Registration Pairs (reference,moving;...)", "RegistrationPairs", getRegistrationPairs(), FilterParameter::Parameter));
+
   {
     QStringList linkedProps;
     linkedProps << "ReferenceGoodFeaturesArrayPath" << "MovingGoodFeaturesArrayPath";
@@ -129,10 +821,22 @@ void RegisterPointSets::setupFilterParameters()
   parameters.push_back(DataArraySelectionFilterParameter::New("Reference Good Points", "ReferenceGoodFeaturesArrayPath", getReferenceGoodFeaturesArrayPath(), FilterParameter::RequiredArray, req));
   parameters.push_back(DataArraySelectionFilterParameter::New("Moving Good Points", "MovingGoodFeaturesArrayPath", getMovingGoodFeaturesArrayPath(), FilterParameter::RequiredArray, req));
   parameters.push_back(DataArraySelectionFilterParameter::New("Weights", "WeightsArrayPath", getWeightsArrayPath(), FilterParameter::RequiredArray, req));
+  parameters.push_back(DataArraySelectionFilterParameter::New("Reference Descriptors", "ReferenceDescriptorsArrayPath", getReferenceDescriptorsArrayPath(), FilterParameter::RequiredArray, req));
+  parameters.back()->setGroupIndex(2);
+  parameters.push_back(DataArraySelectionFilterParameter::New("Moving Descriptors", "MovingDescriptorsArrayPath", getMovingDescriptorsArrayPath(), FilterParameter::RequiredArray, req));
+  parameters.back()->setGroupIndex(2);
 
   //created arrays
   parameters.push_back(StringFilterParameter::New("Output Attribute Matrix Name", "AttributeMatrixName", getAttributeMatrixName(), FilterParameter::CreatedArray));
   parameters.push_back(StringFilterParameter::New("Output Array Name", "TransformName", getTransformName(), FilterParameter::CreatedArray, 1));
+  parameters.push_back(StringFilterParameter::New("RMS Residual", "RmsResidualArrayName", getRmsResidualArrayName(), FilterParameter::CreatedArray));
+  parameters.push_back(StringFilterParameter::New("Median Residual", "MedianResidualArrayName", getMedianResidualArrayName(), FilterParameter::CreatedArray));
+  parameters.push_back(StringFilterParameter::New("Maximum Residual", "MaxResidualArrayName", getMaxResidualArrayName(), FilterParameter::CreatedArray));
+  parameters.push_back(StringFilterParameter::New("Condition Number", "ConditionNumberArrayName", getConditionNumberArrayName(), FilterParameter::CreatedArray));
+  parameters.push_back(StringFilterParameter::New("Transformation Uncertainty", "TransformationUncertaintyArrayName", getTransformationUncertaintyArrayName(), FilterParameter::CreatedArray));
+  parameters.push_back(StringFilterParameter::New("Residuals", "ResidualsArrayName", getResidualsArrayName(), FilterParameter::CreatedArray));
+  parameters.push_back(StringFilterParameter::New("Inliers", "InliersArrayName", getInliersArrayName(), FilterParameter::CreatedArray));
+  parameters.back()->setGroupIndex(1);
 
   setFilterParameters(parameters);
 }
@@ -148,6 +852,26 @@ void RegisterPointSets::readFilterParameters(AbstractFilterParametersReader* rea
   setAllowScaling( reader->readValue("AllowScaling", getAllowScaling()));
   setScalingType( reader->readValue("ScalingType", getScalingType()));
   setAllowShearing( reader->readValue("AllowShearing", getAllowShearing()));
+  setCorrespondenceType( reader->readValue("CorrespondenceType", getCorrespondenceType()));
+  setMaxIterations( reader->readValue("MaxIterations", getMaxIterations()));
+  setMaxPairDistance( reader->readValue("MaxPairDistance", getMaxPairDistance()));
+  setConvergenceTolerance( reader->readValue("ConvergenceTolerance", getConvergenceTolerance()));
+  setDescriptorCandidates( reader->readValue("DescriptorCandidates", getDescriptorCandidates()));
+  setVotingNeighbors( reader->readValue("VotingNeighbors", getVotingNeighbors()));
+  setConsistencyDistance( reader->readValue("ConsistencyDistance", getConsistencyDistance()));
+  setMinimumVotes( reader->readValue("MinimumVotes", getMinimumVotes()));
+  setRobustMethod( reader->readValue("RobustMethod", getRobustMethod()));
+  setInlierDistance( reader->readValue("InlierDistance", getInlierDistance()));
+  setMaxHypotheses( reader->readValue("MaxHypotheses", getMaxHypotheses()));
+  setRansacConfidence( reader->readValue("RansacConfidence", getRansacConfidence()));
+  setWeightFunction( reader->readValue("WeightFunction", getWeightFunction()));
+  setTuningConstant( reader->readValue("TuningConstant", getTuningConstant()));
+  setRobustIterations( reader->readValue("RobustIterations", getRobustIterations()));
+  setEstimateUncertainty( reader->readValue("EstimateUncertainty", getEstimateUncertainty()));
+  setBootstrapResamples( reader->readValue("BootstrapResamples", getBootstrapResamples()));
+  setBatchRegistration( reader->readValue("BatchRegistration", getBatchRegistration()));
+  setDataContainerPrefix( reader->readString("DataContainerPrefix", getDataContainerPrefix() ) );
+  setRegistrationPairs( reader->readString("RegistrationPairs", getRegistrationPairs() ) );
   setReferenceCentroidsArrayPath( reader->readDataArrayPath( "ReferenceCentroidsArrayPath", getReferenceCentroidsArrayPath() ) );
   setMovingCentroidsArrayPath( reader->readDataArrayPath( "MovingCentroidsArrayPath", getMovingCentroidsArrayPath() ) );
   setUseGoodPoints( reader->readValue("UseGoodPoints", getUseGoodPoints()));
@@ -155,8 +879,17 @@ void RegisterPointSets::readFilterParameters(AbstractFilterParametersReader* rea
   setMovingGoodFeaturesArrayPath( reader->readDataArrayPath( "MovingGoodFeaturesArrayPath", getMovingGoodFeaturesArrayPath() ) );
   setUseWeights( reader->readValue("UseWeights", getUseWeights()));
   setWeightsArrayPath( reader->readDataArrayPath( "WeightsArrayPath", getWeightsArrayPath() ) );
+  setReferenceDescriptorsArrayPath( reader->readDataArrayPath( "ReferenceDescriptorsArrayPath", getReferenceDescriptorsArrayPath() ) );
+  setMovingDescriptorsArrayPath( reader->readDataArrayPath( "MovingDescriptorsArrayPath", getMovingDescriptorsArrayPath() ) );
   setAttributeMatrixName( reader->readString( "AttributeMatrixName", getAttributeMatrixName() ) );
   setTransformName(reader->readString("TransformName", getTransformName() ) );
+  setInliersArrayName(reader->readString("InliersArrayName", getInliersArrayName() ) );
+  setResidualsArrayName(reader->readString("ResidualsArrayName", getResidualsArrayName() ) );
+  setRmsResidualArrayName(reader->readString("RmsResidualArrayName", getRmsResidualArrayName() ) );
+  setMedianResidualArrayName(reader->readString("MedianResidualArrayName", getMedianResidualArrayName() ) );
+  setMaxResidualArrayName(reader->readString("MaxResidualArrayName", getMaxResidualArrayName() ) );
+  setConditionNumberArrayName(reader->readString("ConditionNumberArrayName", getConditionNumberArrayName() ) );
+  setTransformationUncertaintyArrayName(reader->readString("TransformationUncertaintyArrayName", getTransformationUncertaintyArrayName() ) );
   reader->closeFilterGroup();
 }
 
@@ -172,6 +905,26 @@ int RegisterPointSets::writeFilterParameters(AbstractFilterParametersWriter* wri
   SIMPL_FILTER_WRITE_PARAMETER(AllowScaling)
   SIMPL_FILTER_WRITE_PARAMETER(ScalingType)
   SIMPL_FILTER_WRITE_PARAMETER(AllowShearing)
+  SIMPL_FILTER_WRITE_PARAMETER(CorrespondenceType)
+  SIMPL_FILTER_WRITE_PARAMETER(MaxIterations)
+  SIMPL_FILTER_WRITE_PARAMETER(MaxPairDistance)
+  SIMPL_FILTER_WRITE_PARAMETER(ConvergenceTolerance)
+  SIMPL_FILTER_WRITE_PARAMETER(DescriptorCandidates)
+  SIMPL_FILTER_WRITE_PARAMETER(VotingNeighbors)
+  SIMPL_FILTER_WRITE_PARAMETER(ConsistencyDistance)
+  SIMPL_FILTER_WRITE_PARAMETER(MinimumVotes)
+  SIMPL_FILTER_WRITE_PARAMETER(RobustMethod)
+  SIMPL_FILTER_WRITE_PARAMETER(InlierDistance)
+  SIMPL_FILTER_WRITE_PARAMETER(MaxHypotheses)
+  SIMPL_FILTER_WRITE_PARAMETER(RansacConfidence)
+  SIMPL_FILTER_WRITE_PARAMETER(WeightFunction)
+  SIMPL_FILTER_WRITE_PARAMETER(TuningConstant)
+  SIMPL_FILTER_WRITE_PARAMETER(RobustIterations)
+  SIMPL_FILTER_WRITE_PARAMETER(EstimateUncertainty)
+  SIMPL_FILTER_WRITE_PARAMETER(BootstrapResamples)
+  SIMPL_FILTER_WRITE_PARAMETER(BatchRegistration)
+  SIMPL_FILTER_WRITE_PARAMETER(DataContainerPrefix)
+  SIMPL_FILTER_WRITE_PARAMETER(RegistrationPairs)
   SIMPL_FILTER_WRITE_PARAMETER(ReferenceCentroidsArrayPath)
   SIMPL_FILTER_WRITE_PARAMETER(MovingCentroidsArrayPath)
   SIMPL_FILTER_WRITE_PARAMETER(UseGoodPoints)
@@ -179,12 +932,132 @@ int RegisterPointSets::writeFilterParameters(AbstractFilterParametersWriter* wri
   SIMPL_FILTER_WRITE_PARAMETER(MovingGoodFeaturesArrayPath)
   SIMPL_FILTER_WRITE_PARAMETER(UseWeights)
   SIMPL_FILTER_WRITE_PARAMETER(WeightsArrayPath)
+  SIMPL_FILTER_WRITE_PARAMETER(ReferenceDescriptorsArrayPath)
+  SIMPL_FILTER_WRITE_PARAMETER(MovingDescriptorsArrayPath)
   SIMPL_FILTER_WRITE_PARAMETER(AttributeMatrixName)
   SIMPL_FILTER_WRITE_PARAMETER(TransformName)
+  SIMPL_FILTER_WRITE_PARAMETER(InliersArrayName)
+  SIMPL_FILTER_WRITE_PARAMETER(ResidualsArrayName)
+  SIMPL_FILTER_WRITE_PARAMETER(RmsResidualArrayName)
+  SIMPL_FILTER_WRITE_PARAMETER(MedianResidualArrayName)
+  SIMPL_FILTER_WRITE_PARAMETER(MaxResidualArrayName)
+  SIMPL_FILTER_WRITE_PARAMETER(ConditionNumberArrayName)
+  SIMPL_FILTER_WRITE_PARAMETER(TransformationUncertaintyArrayName)
   writer->closeFilterGroup();
   return ++index; // we want to return the next index that was just written to
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QVector<QString> RegisterPointSets::stepNames()
+{
+  return StepNames::find(getDataContainerArray(), getDataContainerPrefix());
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QVector<QPair<QString, QString> > RegisterPointSets::registrationPairs()
+{
+  QVector<QPair<QString, QString> > pairs;
+  if(getRegistrationPairs().trimmed().isEmpty())
+  {
+    QVector<QString> steps = stepNames();
+    for(int i = 1; i < steps.size(); i++)
+      pairs.push_back(qMakePair(steps[i - 1], steps[i]));
+    return pairs;
+  }
+
+  //"reference,moving" entries separated by semicolons
+  QStringList entries = getRegistrationPairs().split(';');
+  for(int i = 0; i < entries.size(); i++)
+  {
+    if(entries[i].trimmed().isEmpty()) continue;
+    QStringList names = entries[i].split(',');
+    if(2 != names.size())
+    {
+      setErrorCondition(-1009);
+      QString ss = QObject::tr("Registration pair '%1' isn't of the form 'reference,moving'").arg(entries[i].trimmed());
+      notifyErrorMessage(getHumanLabel(), ss, getErrorCondition());
+      return QVector<QPair<QString, QString> >();
+    }
+    pairs.push_back(qMakePair(names[0].trimmed(), names[1].trimmed()));
+  }
+  return pairs;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString RegisterPointSets::pointArrayName(const QString& name, const QString& reference)
+{
+  if(getBatchRegistration() && !getRegistrationPairs().trimmed().isEmpty())
+    return name + "_" + reference;
+  return name;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+RegisterPointSets::Pointer RegisterPointSets::createPairFilter(const QString& reference, const QString& moving)
+{
+  //outputs are created in copies of the steps so pairs can be registered concurrently without modifying shared attribute matrices
+  QStringList outputArrays;
+  outputArrays << getResidualsArrayName() << getInliersArrayName();
+  DataContainerArray::Pointer dca = DataContainerArray::New();
+  dca->addDataContainer(Detail::shallowCopy(getDataContainerArray()->getDataContainer(reference), getAttributeMatrixName(), outputArrays));
+  dca->addDataContainer(Detail::shallowCopy(getDataContainerArray()->getDataContainer(moving), getAttributeMatrixName(), outputArrays));
+
+  RegisterPointSets::Pointer filter = RegisterPointSets::New();
+  filter->setDataContainerArray(dca);
+  filter->setReferenceCentroidsArrayPath(Detail::inDataContainer(reference, getReferenceCentroidsArrayPath()));
+  filter->setMovingCentroidsArrayPath(Detail::inDataContainer(moving, getMovingCentroidsArrayPath()));
+  filter->setReferenceGoodFeaturesArrayPath(Detail::inDataContainer(reference, getReferenceGoodFeaturesArrayPath()));
+  filter->setMovingGoodFeaturesArrayPath(Detail::inDataContainer(moving, getMovingGoodFeaturesArrayPath()));
+  filter->setWeightsArrayPath(Detail::inDataContainer(reference, getWeightsArrayPath()));
+  filter->setReferenceDescriptorsArrayPath(Detail::inDataContainer(reference, getReferenceDescriptorsArrayPath()));
+  filter->setMovingDescriptorsArrayPath(Detail::inDataContainer(moving, getMovingDescriptorsArrayPath()));
+  filter->setAttributeMatrixName(getAttributeMatrixName());
+
+  filter->setAllowTranslation(getAllowTranslation());
+  filter->setAllowRotation(getAllowRotation());
+  filter->setAllowScaling(getAllowScaling());
+  filter->setScalingType(getScalingType());
+  filter->setAllowShearing(getAllowShearing());
+  filter->setUseGoodPoints(getUseGoodPoints());
+  filter->setUseWeights(getUseWeights());
+  filter->setCorrespondenceType(getCorrespondenceType());
+  filter->setMaxIterations(getMaxIterations());
+  filter->setMaxPairDistance(getMaxPairDistance());
+  filter->setConvergenceTolerance(getConvergenceTolerance());
+  filter->setDescriptorCandidates(getDescriptorCandidates());
+  filter->setVotingNeighbors(getVotingNeighbors());
+  filter->setConsistencyDistance(getConsistencyDistance());
+  filter->setMinimumVotes(getMinimumVotes());
+  filter->setRobustMethod(getRobustMethod());
+  filter->setInlierDistance(getInlierDistance());
+  filter->setMaxHypotheses(getMaxHypotheses());
+  filter->setRansacConfidence(getRansacConfidence());
+  filter->setWeightFunction(getWeightFunction());
+  filter->setTuningConstant(getTuningConstant());
+  filter->setRobustIterations(getRobustIterations());
+  filter->setEstimateUncertainty(getEstimateUncertainty());
+  filter->setBootstrapResamples(getBootstrapResamples());
+  filter->setBatchRegistration(false);
+  filter->m_BatchPair = true;
+
+  filter->setTransformName(getTransformName());
+  filter->setInliersArrayName(getInliersArrayName());
+  filter->setResidualsArrayName(getResidualsArrayName());
+  filter->setRmsResidualArrayName(getRmsResidualArrayName());
+  filter->setMedianResidualArrayName(getMedianResidualArrayName());
+  filter->setMaxResidualArrayName(getMaxResidualArrayName());
+  filter->setConditionNumberArrayName(getConditionNumberArrayName());
+  filter->setTransformationUncertaintyArrayName(getTransformationUncertaintyArrayName());
+  return filter;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -237,12 +1110,93 @@ void RegisterPointSets::dataCheck()
     if( NULL != m_WeightsPtr.lock().get() ) m_Weights = m_WeightsPtr.lock()->getPointer(0);
   }
 
+  //descriptors may have any number of components but must match
+  if(2 == getCorrespondenceType())
+  {
+    if(getDescriptorCandidates() < 1 || getVotingNeighbors() < 1 || getConsistencyDistance() <= 0.0 || getMinimumVotes() < 0)
+    {
+      setErrorCondition(-1007);
+      notifyErrorMessage(getHumanLabel(), "Descriptor matching requires at least 1 candidate and voting neighbor, a positive consistency distance, and a non negative number of votes", getErrorCondition());
+      return;
+    }
+    IDataArray::Pointer referenceDescriptors = getDataContainerArray()->getPrereqIDataArrayFromPath<IDataArray, AbstractFilter>(this, getReferenceDescriptorsArrayPath());
+    IDataArray::Pointer movingDescriptors = getDataContainerArray()->getPrereqIDataArrayFromPath<IDataArray, AbstractFilter>(this, getMovingDescriptorsArrayPath());
+    if(getErrorCondition() < 0) return;
+    QVector<size_t> descriptorDims = referenceDescriptors->getComponentDimensions();
+    if(referenceDescriptors->getNumberOfComponents() != movingDescriptors->getNumberOfComponents())
+    {
+      setErrorCondition(-1007);
+      notifyErrorMessage(getHumanLabel(), "Reference and moving descriptors must have the same number of components", getErrorCondition());
+      return;
+    }
+
+    m_ReferenceDescriptorsPtr = getDataContainerArray()->getPrereqArrayFromPath<DataArray<float>, AbstractFilter>(this, getReferenceDescriptorsArrayPath(), descriptorDims);
+    if(getErrorCondition() >= 0) referenceDataArrayPaths.push_back(getReferenceDescriptorsArrayPath());
+    if( NULL != m_ReferenceDescriptorsPtr.lock().get() ) m_ReferenceDescriptors = m_ReferenceDescriptorsPtr.lock()->getPointer(0);
+
+    m_MovingDescriptorsPtr = getDataContainerArray()->getPrereqArrayFromPath<DataArray<float>, AbstractFilter>(this, getMovingDescriptorsArrayPath(), movingDescriptors->getComponentDimensions());
+    if(getErrorCondition() >= 0) movingDataArrayPaths.push_back(getMovingDescriptorsArrayPath());
+    if( NULL != m_MovingDescriptorsPtr.lock().get() ) m_MovingDescriptors = m_MovingDescriptorsPtr.lock()->getPointer(0);
+  }
+
   getDataContainerArray()->validateNumberOfTuples<AbstractFilter>(this, referenceDataArrayPaths);
   getDataContainerArray()->validateNumberOfTuples<AbstractFilter>(this, movingDataArrayPaths);
   if(getErrorCondition() < 0) return;
 
+  //batch registration: each pair (each step to the previous step by default) is registered using the attribute matrix and array names of the selected arrays
+  QVector<QPair<QString, QString> > pairs;
+  if(getBatchRegistration())
+  {
+    pairs = registrationPairs();
+    if(getErrorCondition() < 0) return;
+    if(pairs.empty())
+    {
+      setErrorCondition(-1008);
+      QString ss = QObject::tr("Batch registration requires a registration pair or at least 2 data containers starting with '%1'").arg(getDataContainerPrefix());
+      notifyErrorMessage(getHumanLabel(), ss, getErrorCondition());
+      return;
+    }
+
+    //listed pairs must name 2 different existing data containers and each pair may only be listed once (per point outputs are named by pair)
+    for(int i = 0; i < pairs.size(); i++)
+    {
+      QString ss;
+      if(!getDataContainerArray()->doesDataContainerExist(pairs[i].first))
+        ss = QObject::tr("Registration pair reference '%1' doesn't exist").arg(pairs[i].first);
+      else if(!getDataContainerArray()->doesDataContainerExist(pairs[i].second))
+        ss = QObject::tr("Registration pair moving '%1' doesn't exist").arg(pairs[i].second);
+      else if(pairs[i].first == pairs[i].second)
+        ss = QObject::tr("Registration pair '%1' registers a data container to itself").arg(pairs[i].first);
+      else if(pairs.indexOf(pairs[i]) != i)
+        ss = QObject::tr("Registration pair '%1,%2' is listed more than once").arg(pairs[i].first).arg(pairs[i].second);
+      if(!ss.isEmpty())
+      {
+        setErrorCondition(-1009);
+        notifyErrorMessage(getHumanLabel(), ss, getErrorCondition());
+        return;
+      }
+    }
+
+    //check each pair (execute checks the pairs as they are registered)
+    if(getInPreflight())
+    {
+      for(int i = 0; i < pairs.size(); i++)
+      {
+        RegisterPointSets::Pointer pairFilter = createPairFilter(pairs[i].first, pairs[i].second);
+        pairFilter->preflight();
+        if(pairFilter->getErrorCondition() < 0)
+        {
+          setErrorCondition(pairFilter->getErrorCondition());
+          QString ss = QObject::tr("Unable to register '%1' to '%2'").arg(pairs[i].second).arg(pairs[i].first);
+          notifyErrorMessage(getHumanLabel(), ss, getErrorCondition());
+          return;
+        }
+      }
+    }
+  }
+
   //created arrays
-    QVector<size_t> tDims(1, 1);//1 spot (single transformation)
+  QVector<size_t> tDims(1, getBatchRegistration() ? pairs.size() : 1);//1 spot per transformation (stacked in batch mode)
   DataContainer::Pointer m = getDataContainerArray()->getPrereqDataContainer<AbstractFilter>(this, getReferenceCentroidsArrayPath().getDataContainerName());
   AttributeMatrix::Pointer attrMat = m->createNonPrereqAttributeMatrix<AbstractFilter>(this, getAttributeMatrixName(), tDims, DREAM3D::AttributeMatrixType::MetaData);
 
@@ -252,6 +1206,81 @@ void RegisterPointSets::dataCheck()
   tempPath.update(getReferenceCentroidsArrayPath().getDataContainerName(), getAttributeMatrixName(), getTransformName() );
   m_TransformPtr = getDataContainerArray()->createNonPrereqArrayFromPath<DataArray<float>, AbstractFilter, float>(this, tempPath, 0, transDims);
   if( NULL != m_TransformPtr.lock().get() ) m_Transform = m_TransformPtr.lock()->getPointer(0);
+
+  //create registration quality measures next to the transformation
+  QVector<size_t> statDims(1, 1);
+  tempPath.update(getReferenceCentroidsArrayPath().getDataContainerName(), getAttributeMatrixName(), getRmsResidualArrayName() );
+  m_RmsResidualPtr = getDataContainerArray()->createNonPrereqArrayFromPath<DataArray<float>, AbstractFilter, float>(this, tempPath, 0, statDims);
+  if( NULL != m_RmsResidualPtr.lock().get() ) m_RmsResidual = m_RmsResidualPtr.lock()->getPointer(0);
+
+  tempPath.update(getReferenceCentroidsArrayPath().getDataContainerName(), getAttributeMatrixName(), getMedianResidualArrayName() );
+  m_MedianResidualPtr = getDataContainerArray()->createNonPrereqArrayFromPath<DataArray<float>, AbstractFilter, float>(this, tempPath, 0, statDims);
+  if( NULL != m_MedianResidualPtr.lock().get() ) m_MedianResidual = m_MedianResidualPtr.lock()->getPointer(0);
+
+  tempPath.update(getReferenceCentroidsArrayPath().getDataContainerName(), getAttributeMatrixName(), getMaxResidualArrayName() );
+  m_MaxResidualPtr = getDataContainerArray()->createNonPrereqArrayFromPath<DataArray<float>, AbstractFilter, float>(this, tempPath, 0, statDims);
+  if( NULL != m_MaxResidualPtr.lock().get() ) m_MaxResidual = m_MaxResidualPtr.lock()->getPointer(0);
+
+  tempPath.update(getReferenceCentroidsArrayPath().getDataContainerName(), getAttributeMatrixName(), getConditionNumberArrayName() );
+  m_ConditionNumberPtr = getDataContainerArray()->createNonPrereqArrayFromPath<DataArray<float>, AbstractFilter, float>(this, tempPath, 0, statDims);
+  if( NULL != m_ConditionNumberPtr.lock().get() ) m_ConditionNumber = m_ConditionNumberPtr.lock()->getPointer(0);
+
+  //bootstrap spread of the rotation, scale and translation
+  if(getEstimateUncertainty())
+  {
+    if(getBootstrapResamples() < 2)
+    {
+      setErrorCondition(-1006);
+      notifyErrorMessage(getHumanLabel(), "Uncertainty estimation requires at least 2 bootstrap resamples", getErrorCondition());
+      return;
+    }
+    tempPath.update(getReferenceCentroidsArrayPath().getDataContainerName(), getAttributeMatrixName(), getTransformationUncertaintyArrayName() );
+    QVector<size_t> uncertaintyDims(1, Detail::k_UncertaintyComponents);
+    m_TransformationUncertaintyPtr = getDataContainerArray()->createNonPrereqArrayFromPath<DataArray<float>, AbstractFilter, float>(this, tempPath, 0, uncertaintyDims);
+    if( NULL != m_TransformationUncertaintyPtr.lock().get() ) m_TransformationUncertainty = m_TransformationUncertaintyPtr.lock()->getPointer(0);
+  }
+
+  //residual of each moving point (of the moving step of every pair in batch mode)
+  if(!getBatchRegistration())
+    pairs.push_back(qMakePair(getReferenceCentroidsArrayPath().getDataContainerName(), getMovingCentroidsArrayPath().getDataContainerName()));
+  for(int i = 0; i < pairs.size(); i++)
+  {
+    tempPath.update(pairs[i].second, getMovingCentroidsArrayPath().getAttributeMatrixName(), pointArrayName(getResidualsArrayName(), pairs[i].first) );
+    m_ResidualsPtr = getDataContainerArray()->createNonPrereqArrayFromPath<DataArray<float>, AbstractFilter, float>(this, tempPath, -1, statDims);
+    if( NULL != m_ResidualsPtr.lock().get() ) m_Residuals = m_ResidualsPtr.lock()->getPointer(0);
+  }
+
+  if(0 != getRobustMethod() && 1 == getCorrespondenceType())
+  {
+    setErrorCondition(-1003);
+    notifyErrorMessage(getHumanLabel(), "Robust estimation requires matching indices or shape descriptor correspondences", getErrorCondition());
+    return;
+  }
+
+  if(2 == getRobustMethod() && (getTuningConstant() < 0.0 || getRobustIterations() < 1))
+  {
+    setErrorCondition(-1005);
+    notifyErrorMessage(getHumanLabel(), "M-estimation requires a non negative tuning constant and at least 1 iteration", getErrorCondition());
+    return;
+  }
+
+  //create inlier mask next to the moving points
+  if(1 == getRobustMethod())
+  {
+    if(getInlierDistance() <= 0.0 || getMaxHypotheses() < 1 || getRansacConfidence() <= 0.0 || getRansacConfidence() >= 1.0)
+    {
+      setErrorCondition(-1004);
+      notifyErrorMessage(getHumanLabel(), "RANSAC requires a positive inlier distance and number of hypotheses and a confidence between 0 and 1", getErrorCondition());
+      return;
+    }
+    dims[0] = 1;
+    for(int i = 0; i < pairs.size(); i++)
+    {
+      tempPath.update(pairs[i].second, getMovingCentroidsArrayPath().getAttributeMatrixName(), pointArrayName(getInliersArrayName(), pairs[i].first) );
+      m_InliersPtr = getDataContainerArray()->createNonPrereqArrayFromPath<DataArray<bool>, AbstractFilter, bool>(this, tempPath, false, dims);
+      if( NULL != m_InliersPtr.lock().get() ) m_Inliers = m_InliersPtr.lock()->getPointer(0);
+    }
+  }
 }
 
 // -----------------------------------------------------------------------------
@@ -279,6 +1308,72 @@ void RegisterPointSets::execute()
 
   if (getCancel() == true) { return; }
 
+#ifdef SIMPLib_USE_PARALLEL_ALGORITHMS
+  //pairs of a batch run on the batch's worker threads inside its scheduler instead of starting their own
+  tbb::task_scheduler_init init(tbb::task_scheduler_init::deferred);
+  if(!m_BatchPair) init.initialize();
+  bool doParallel = true;
+#endif
+
+  //batch registration: register every pair concurrently, then stack the results
+  if(getBatchRegistration())
+  {
+    QVector<QPair<QString, QString> > pairs = registrationPairs();
+    std::vector<RegisterPointSets::Pointer> pairFilters;
+    for(int i = 0; i < pairs.size(); i++)
+      pairFilters.push_back(createPairFilter(pairs[i].first, pairs[i].second));
+
+    QString ss = QObject::tr("Registering %1 pairs").arg(pairFilters.size());
+    notifyStatusMessage(getHumanLabel(), ss);
+    Detail::PairRegistrar registrar(pairFilters);
+#ifdef SIMPLib_USE_PARALLEL_ALGORITHMS
+    if (doParallel == true)
+    {
+      tbb::parallel_for(tbb::blocked_range<size_t>(0, pairFilters.size()), registrar, tbb::simple_partitioner());//pairs can take very different times
+    }
+    else
+#endif
+    {
+      registrar.registerPairs(0, pairFilters.size());
+    }
+    if (getCancel() == true) { return; }
+
+    //transformation i maps the moving step of pair i to its reference step
+    QVector<size_t> dims(1, 1);
+    for(size_t i = 0; i < pairFilters.size(); i++)
+    {
+      RegisterPointSets::Pointer pairFilter = pairFilters[i];
+      if(pairFilter->getErrorCondition() < 0)
+      {
+        setErrorCondition(pairFilter->getErrorCondition());
+        ss = QObject::tr("Unable to register '%1' to '%2'").arg(pairs[i].second).arg(pairs[i].first);
+        notifyErrorMessage(getHumanLabel(), ss, getErrorCondition());
+        return;
+      }
+      std::copy(pairFilter->m_Transform, pairFilter->m_Transform + 16, m_Transform + 16 * i);
+      m_RmsResidual[i] = pairFilter->m_RmsResidual[0];
+      m_MedianResidual[i] = pairFilter->m_MedianResidual[0];
+      m_MaxResidual[i] = pairFilter->m_MaxResidual[0];
+      m_ConditionNumber[i] = pairFilter->m_ConditionNumber[0];
+      if(getEstimateUncertainty())
+        std::copy(pairFilter->m_TransformationUncertainty, pairFilter->m_TransformationUncertainty + Detail::k_UncertaintyComponents, m_TransformationUncertainty + Detail::k_UncertaintyComponents * i);
+
+      //per point results belong to the moving step
+      DataArray<float>::Pointer residuals = getDataContainerArray()->getPrereqArrayFromPath<DataArray<float>, AbstractFilter>(this, DataArrayPath(pairs[i].second, getMovingCentroidsArrayPath().getAttributeMatrixName(), pointArrayName(getResidualsArrayName(), pairs[i].first)), dims);
+      if(NULL != residuals.get())
+        std::copy(pairFilter->m_Residuals, pairFilter->m_Residuals + residuals->getNumberOfTuples(), residuals->getPointer(0));
+      if(1 == getRobustMethod())
+      {
+        DataArray<bool>::Pointer inliers = getDataContainerArray()->getPrereqArrayFromPath<DataArray<bool>, AbstractFilter>(this, DataArrayPath(pairs[i].second, getMovingCentroidsArrayPath().getAttributeMatrixName(), pointArrayName(getInliersArrayName(), pairs[i].first)), dims);
+        if(NULL != inliers.get())
+          std::copy(pairFilter->m_Inliers, pairFilter->m_Inliers + inliers->getNumberOfTuples(), inliers->getPointer(0));
+      }
+    }
+
+    notifyStatusMessage(getHumanLabel(), "Complete");
+    return;
+  }
+
   //check degrees of freedom
   if(!getAllowTranslation())
       notifyErrorMessage(getHumanLabel(), "Translation Required", -1);
@@ -290,6 +1385,11 @@ void RegisterPointSets::execute()
     else
       notifyErrorMessage(getHumanLabel(), "Shearing Requires Rotation and Anisotropic Scaling (full affine transformation)", -1);
   }
+  Detail::DegreesOfFreedom dof;
+  dof.rotation = getAllowRotation();
+  dof.scaling = getAllowScaling();
+  dof.scalingType = getScalingType();
+  dof.affine = affine;
 
   //fill transformation with identity matrix by default (in case filter exits early)
   m_Transform[0] = 1;
@@ -312,122 +1412,494 @@ void RegisterPointSets::execute()
   m_Transform[14] = 0;
   m_Transform[15] = 1;
 
-  //create list of matched points
+  //centroids are absolulte but transormation must be w.r.t. origin
+  float refOrigin[3] = {0.0f, 0.0f, 0.0f};
+  float movOrigin[3] = {0.0f, 0.0f, 0.0f};
+
+  getDataContainerArray()->getDataContainer(getReferenceCentroidsArrayPath().getDataContainerName())->getGeometryAs<ImageGeom>()->getOrigin(refOrigin);
+  getDataContainerArray()->getDataContainer(getMovingCentroidsArrayPath().getDataContainerName())->getGeometryAs<ImageGeom>()->getOrigin(movOrigin);
+
+  //create matrix + vector to hold transfomration + translation (default to identiy matrix and no translation)
+  //until the origins are added: reference point = transformation * moving point + translation
+  Eigen::Matrix3d transformation = Eigen::Matrix3d::Identity();
+  Eigen::Vector3d translation = Eigen::Vector3d::Zero();
+  Eigen::Vector3d xBar, yBar;
+  Eigen::Matrix3d covariance = Eigen::Matrix3d::Zero();
+  Eigen::Matrix3d variance = Eigen::Matrix3d::Zero();
+  Detail::PointPairs pairs;//pairs used in the final fit
   size_t referenceNumFeatures = m_ReferenceCentroidsPtr.lock()->getNumberOfTuples();
   size_t movingNumFeatures = m_MovingCentroidsPtr.lock()->getNumberOfTuples();
-  size_t numFeatures = std::min(referenceNumFeatures, movingNumFeatures);
-  std::vector<size_t> sharedFeatures;
-  sharedFeatures.reserve(numFeatures);
+  const float* weights = getUseWeights() ? m_Weights : NULL;
+  const float* fitWeights = weights;//weights used in the final fit (including robust weights)
+  std::vector<float> robustWeights;
 
-  for(size_t i = 0; i < numFeatures; i++)
+  if(1 != getCorrespondenceType())
   {
-    //dont add bad points to list
-    if(getUseGoodPoints())
+    if(0 == getCorrespondenceType())
     {
-      if( !(m_ReferenceGoodFeatures[i] && m_MovingGoodFeatures[i]) )
-        continue;
+      //create list of matched points
+      size_t numFeatures = std::min(referenceNumFeatures, movingNumFeatures);
+      pairs.reserve(numFeatures);
+
+      for(size_t i = 0; i < numFeatures; i++)
+      {
+        //dont add bad points to list
+        if(getUseGoodPoints())
+        {
+          if( !(m_ReferenceGoodFeatures[i] && m_MovingGoodFeatures[i]) )
+            continue;
+        }
+        pairs.push_back(std::make_pair(i, i));
+      }
     }
-    sharedFeatures.push_back(i);
-  }
-  numFeatures = sharedFeatures.size();
+    else
+    {
+      //shape descriptors: pair points with similar descriptors, keeping only candidates that are consistent with the candidates of their neighbors
+      std::vector<size_t> referencePoints, movingPoints;
+      for(size_t i = 0; i < referenceNumFeatures; i++)
+      {
+        if(!getUseGoodPoints() || m_ReferenceGoodFeatures[i]) referencePoints.push_back(i);
+      }
+      for(size_t i = 0; i < movingNumFeatures; i++)
+      {
+        if(!getUseGoodPoints() || m_MovingGoodFeatures[i]) movingPoints.push_back(i);
+      }
+      if(referencePoints.empty() || movingPoints.empty())
+      {
+        setErrorCondition(-1001);
+        notifyErrorMessage(getHumanLabel(), "No points to register", getErrorCondition());
+        return;
+      }
 
-  //create matrix + vector to hold transfomration + translation (default to identiy matrix and no translation)
-  Eigen::Matrix3d transformation = Eigen::Matrix3d::Identity();
-  Eigen::Vector3d translation = Eigen::Vector3d::Zero();
+      //standardize each descriptor component over both point sets so components with large values don't dominate the distance
+      const size_t numComps = m_ReferenceDescriptorsPtr.lock()->getNumberOfComponents();
+      std::vector<double> mean(numComps, 0.0), sumSquares(numComps, 0.0);
+      size_t count = 0;
+      for(size_t i = 0; i < referencePoints.size() + movingPoints.size(); i++)
+      {
+        const float* descriptor = i < referencePoints.size() ? m_ReferenceDescriptors + numComps * referencePoints[i] : m_MovingDescriptors + numComps * movingPoints[i - referencePoints.size()];
+        ++count;
+        for(size_t j = 0; j < numComps; j++)
+        {
+          const double delta = descriptor[j] - mean[j];
+          mean[j] += delta / count;
+          sumSquares[j] += delta * (descriptor[j] - mean[j]);
+        }
+      }
+      std::vector<double> scale(numComps, 1.0);
+      for(size_t j = 0; j < numComps; j++)
+      {
+        if(sumSquares[j] > 0.0)
+          scale[j] = 1.0 / std::sqrt(sumSquares[j] / count);
+      }
+      std::vector<float> referenceDescriptors(numComps * referencePoints.size()), movingDescriptors(numComps * movingPoints.size());
+      for(size_t i = 0; i < referencePoints.size(); i++)
+      {
+        for(size_t j = 0; j < numComps; j++)
+          referenceDescriptors[numComps * i + j] = static_cast<float>((m_ReferenceDescriptors[numComps * referencePoints[i] + j] - mean[j]) * scale[j]);
+      }
+      for(size_t i = 0; i < movingPoints.size(); i++)
+      {
+        for(size_t j = 0; j < numComps; j++)
+          movingDescriptors[numComps * i + j] = static_cast<float>((m_MovingDescriptors[numComps * movingPoints[i] + j] - mean[j]) * scale[j]);
+      }
 
-  //compute center of mass for each point set (computations require both sets centered at origin)
-  Eigen::Vector3d xBar = Eigen::Vector3d::Zero();//moving points centroid
-  Eigen::Vector3d yBar = Eigen::Vector3d::Zero();//reference points centroid
-  float totalW = 0.0f;
-  for(size_t i = 0; i < numFeatures; i++)
-  {
-    size_t index = 3 * sharedFeatures[i];
-    float w = 1.0f;
-    if(getUseWeights())
-      w = m_Weights[sharedFeatures[i]];
-    xBar += w * Eigen::Vector3d(m_MovingCentroids[index + 0], m_MovingCentroids[index + 1], m_MovingCentroids[index + 2]);
-    yBar += w * Eigen::Vector3d(m_ReferenceCentroids[index + 0], m_ReferenceCentroids[index + 1], m_ReferenceCentroids[index + 2]);
-  }
+      //find the most similar reference points for each moving point
+      KdTree<float> descriptorTree(referenceDescriptors.data(), referencePoints.size(), numComps);
+      const size_t candidates = std::min(static_cast<size_t>(getDescriptorCandidates()), referencePoints.size());
+      std::vector<size_t> matches(candidates * movingPoints.size());
+      Detail::DescriptorMatcher matcher(descriptorTree, movingDescriptors.data(), candidates, matches);
+#ifdef SIMPLib_USE_PARALLEL_ALGORITHMS
+      if (doParallel == true)
+      {
+        tbb::parallel_for(tbb::blocked_range<size_t>(0, movingPoints.size()), matcher, tbb::auto_partitioner());
+      }
+      else
+#endif
+      {
+        matcher.match(0, movingPoints.size());
+      }
+      if (getCancel() == true) { return; }
 
-  xBar /= numFeatures;
-  yBar /= numFeatures;
-  if(getUseWeights())
-  {
-    xBar /= totalW;
-    yBar /= totalW;
-  }
+      //vote for candidates whose distances to the candidates of nearby points agree with the distances between the moving points
+      std::vector<float> referencePositions(3 * referencePoints.size()), movingPositions(3 * movingPoints.size());
+      for(size_t i = 0; i < referencePoints.size(); i++)
+        std::copy(m_ReferenceCentroids + 3 * referencePoints[i], m_ReferenceCentroids + 3 * referencePoints[i] + 3, referencePositions.begin() + 3 * i);
+      for(size_t i = 0; i < movingPoints.size(); i++)
+        std::copy(m_MovingCentroids + 3 * movingPoints[i], m_MovingCentroids + 3 * movingPoints[i] + 3, movingPositions.begin() + 3 * i);
+      KdTree<float> spatialTree(movingPositions.data(), movingPoints.size(), 3);
+      std::vector<size_t> votes(matches.size());
+      Detail::ConsistencyVoter voter(spatialTree, movingPositions.data(), referencePositions.data(), referencePoints.size(), matches, candidates, static_cast<size_t>(getVotingNeighbors()), static_cast<float>(getConsistencyDistance()), votes);
+#ifdef SIMPLib_USE_PARALLEL_ALGORITHMS
+      if (doParallel == true)
+      {
+        tbb::parallel_for(tbb::blocked_range<size_t>(0, movingPoints.size()), voter, tbb::auto_partitioner());
+      }
+      else
+#endif
+      {
+        voter.vote(0, movingPoints.size());
+      }
+      if (getCancel() == true) { return; }
 
-  //compute variance and covariance matrices
-  Eigen::Matrix3d covariance = Eigen::Matrix3d::Zero();
-  Eigen::Matrix3d variance = Eigen::Matrix3d::Zero();
-  for(size_t i = 0; i < numFeatures; i++)
-  {
-    size_t index = 3 * sharedFeatures[i];
-    Eigen::Vector3d x(m_MovingCentroids[index + 0], m_MovingCentroids[index + 1], m_MovingCentroids[index + 2]);
-    Eigen::Vector3d y(m_ReferenceCentroids[index + 0], m_ReferenceCentroids[index + 1], m_ReferenceCentroids[index + 2]);
-    x -= xBar;
-    y -= yBar;
-    float w = 1.0f;
-    if(getUseWeights())
-      w = m_Weights[sharedFeatures[i]];
-    covariance += w * Eigen::Matrix3d(x * y.transpose());
-    variance += w * Eigen::Matrix3d(x * x.transpose());
-  }
+      //accept the best supported candidates first so each point is paired at most once
+      std::vector< std::pair<size_t, size_t> > ranked;//(votes, candidate)
+      for(size_t i = 0; i < matches.size(); i++)
+      {
+        if(matches[i] < referencePoints.size() && votes[i] >= static_cast<size_t>(getMinimumVotes()))
+          ranked.push_back(std::make_pair(votes[i], i));
+      }
+      std::stable_sort(ranked.begin(), ranked.end(), Detail::moreVotes);
+      std::vector<bool> movingPaired(movingPoints.size(), false), referencePaired(referencePoints.size(), false);
+      for(size_t i = 0; i < ranked.size(); i++)
+      {
+        const size_t moving = ranked[i].second / candidates;
+        const size_t reference = matches[ranked[i].second];
+        if(movingPaired[moving] || referencePaired[reference]) continue;
+        movingPaired[moving] = true;
+        referencePaired[reference] = true;
+        pairs.push_back(std::make_pair(movingPoints[moving], referencePoints[reference]));
+      }
 
-  //shear (requires full affine) and no shear are handled differently
-  if(affine)
-  {
-    bool invertible;
-    Eigen::Matrix3d inverse;
-    variance.computeInverseWithCheck(inverse, invertible);
-    if(invertible)
-      transformation = inverse * covariance;
-    else
+      QString ss = QObject::tr("%1 of %2 moving points paired by shape descriptors").arg(pairs.size()).arg(movingPoints.size());
+      notifyStatusMessage(getHumanLabel(), ss);
+      if(pairs.empty())
+        notifyWarningMessage(getHumanLabel(), "No consistent descriptor correspondences found, try more candidates or a larger consistency distance", 1);
+    }
+
+    //robust estimation: find the largest set of pairs consistent with a transformation solved from a random minimal sample, then fit to those pairs only
+    if(1 == getRobustMethod())
+    {
+      const size_t sampleSize = dof.minimalPairs();
+      size_t bestCount = 0;
+      size_t bestHypothesis = 0;
+      if(pairs.size() > sampleSize)
+      {
+        //hypotheses are evaluated in batches so the number required for the requested confidence can be updated as better hypotheses are found
+        const size_t batchSize = 256;
+        size_t required = static_cast<size_t>(getMaxHypotheses());
+        std::vector<size_t> counts(batchSize);
+        for(size_t first = 0; first < required; first += batchSize)
+        {
+          if (getCancel() == true) { return; }
+          const size_t batch = std::min(batchSize, required - first);
+          Detail::HypothesisEvaluator evaluator(m_MovingCentroids, m_ReferenceCentroids, pairs, dof, getInlierDistance(), first, bestCount, counts);
+#ifdef SIMPLib_USE_PARALLEL_ALGORITHMS
+          if (doParallel == true)
+          {
+            tbb::parallel_for(tbb::blocked_range<size_t>(0, batch), evaluator, tbb::auto_partitioner());
+          }
+          else
+#endif
+          {
+            evaluator.evaluate(0, batch);
+          }
+
+          for(size_t h = 0; h < batch; h++)
+          {
+            if(counts[h] > bestCount)
+            {
+              bestCount = counts[h];
+              bestHypothesis = first + h;
+            }
+          }
+
+          //probability of drawing an all inlier sample from the best inlier fraction so far
+          const double allInliers = std::pow(static_cast<double>(bestCount) / pairs.size(), static_cast<double>(sampleSize));
+          if(allInliers >= 1.0)
+            required = first + batch;
+          else if(allInliers > 0.0)
+          {
+            //log1p keeps tiny all inlier probabilities from rounding to log(1) = 0, the estimate is clamped before conversion since it can be huge
+            const double estimate = std::ceil(std::log(1.0 - getRansacConfidence()) / std::log1p(-allInliers));
+            const size_t needed = static_cast<size_t>(std::min(estimate, static_cast<double>(getMaxHypotheses())));
+            required = std::min(required, std::max(first + batch, needed));
+          }
+
+          QString ss = QObject::tr("RANSAC: %1 of %2 hypotheses evaluated, %3 inliers").arg(first + batch).arg(required).arg(bestCount);
+          notifyStatusMessage(getHumanLabel(), ss);
+        }
+      }
+
+      if(bestCount < sampleSize)
+      {
+        notifyWarningMessage(getHumanLabel(), "Too few consistent pairs for RANSAC, all pairs were used", 1);
+        for(size_t i = 0; i < pairs.size(); i++)
+          m_Inliers[pairs[i].first] = true;
+      }
+      else
+      {
+        //keep pairs within the inlier distance of the best hypothesis
+        std::vector<size_t> counts;
+        Detail::HypothesisEvaluator evaluator(m_MovingCentroids, m_ReferenceCentroids, pairs, dof, getInlierDistance(), 0, 0, counts);
+        evaluator.solve(bestHypothesis, transformation, translation);
+        const double inlierDistance2 = getInlierDistance() * getInlierDistance();
+        Detail::PointPairs inliers;
+        inliers.reserve(bestCount);
+        for(size_t i = 0; i < pairs.size(); i++)
+        {
+          const float* x = m_MovingCentroids + 3 * pairs[i].first;
+          const float* y = m_ReferenceCentroids + 3 * pairs[i].second;
+          Eigen::Vector3d residual = transformation * Eigen::Vector3d(x[0], x[1], x[2]) + translation - Eigen::Vector3d(y[0], y[1], y[2]);
+          if(residual.squaredNorm() > inlierDistance2) continue;
+          inliers.push_back(pairs[i]);
+          m_Inliers[pairs[i].first] = true;
+        }
+        pairs.swap(inliers);
+      }
+    }
+
+    //iteratively reweighted least squares: down weight pairs by their residual under the previous fit (M-estimator)
+    if(2 == getRobustMethod() && !pairs.empty())
+    {
+      //standard tuning constants give 95% efficiency for normally distributed residuals
+      double tuning = getTuningConstant();
+      if(0.0 == tuning)
+        tuning = 0 == getWeightFunction() ? 1.345 : 4.685;
+      robustWeights.assign(referenceNumFeatures, 0.0f);
+      std::vector<double> residuals(pairs.size()), sorted(pairs.size());
+      std::vector<float> factors(pairs.size(), 1.0f);
+      for(int iteration = 0; iteration < getRobustIterations(); iteration++)
+      {
+        if (getCancel() == true) { return; }
+
+        //the first fit is ordinary least squares
+        Detail::computeMoments(m_MovingCentroids, m_ReferenceCentroids, pairs, fitWeights, xBar, yBar, covariance, variance);
+        Detail::solveLinear(covariance, variance, dof, transformation);
+        translation = yBar - transformation * xBar;
+
+        Detail::ResidualFinder finder(m_MovingCentroids, m_ReferenceCentroids, pairs, transformation, translation, residuals);
+#ifdef SIMPLib_USE_PARALLEL_ALGORITHMS
+        if (doParallel == true)
+        {
+          tbb::parallel_reduce(tbb::blocked_range<size_t>(0, pairs.size()), finder, tbb::auto_partitioner());
+        }
+        else
+#endif
+        {
+          finder.find(0, pairs.size());
+        }
+
+        //robust estimate of the residual scale from the median absolute deviation
+        std::copy(residuals.begin(), residuals.end(), sorted.begin());
+        std::nth_element(sorted.begin(), sorted.begin() + sorted.size() / 2, sorted.end());
+        const double scale = 1.4826 * sorted[sorted.size() / 2];
+        if(0.0 == scale) break;//most pairs already fit exactly
+
+        float maxChange = 0.0f;
+        for(size_t i = 0; i < pairs.size(); i++)
+        {
+          float factor = static_cast<float>(Detail::robustWeight(getWeightFunction(), residuals[i] / (tuning * scale)));
+          maxChange = std::max(maxChange, std::fabs(factor - factors[i]));
+          factors[i] = factor;
+          robustWeights[pairs[i].second] = NULL == weights ? factor : factor * weights[pairs[i].second];
+        }
+        fitWeights = robustWeights.data();
+
+        QString ss = QObject::tr("Reweighting iteration %1: residual scale %2, largest weight change %3").arg(iteration + 1).arg(scale).arg(maxChange);
+        notifyStatusMessage(getHumanLabel(), ss);
+        if(maxChange < 1e-4f) break;
+      }
+    }
+
+    Detail::computeMoments(m_MovingCentroids, m_ReferenceCentroids, pairs, fitWeights, xBar, yBar, covariance, variance);
+    if(!Detail::solveLinear(covariance, variance, dof, transformation))
       notifyWarningMessage(getHumanLabel(), "singular variance matrix", 1);
-    transformation.transposeInPlace();
+    translation = yBar - transformation * xBar;
   }
   else
   {
-    if(getAllowRotation())
+    //iterative closest point: pair each moving point with the closest reference point under the current transformation, then solve for a new transformation
+    std::vector<size_t> referencePoints, movingPoints;
+    for(size_t i = 0; i < referenceNumFeatures; i++)
     {
-      //perform singular value decomposition of covariance matrix
-      Eigen::JacobiSVD<Eigen::Matrix3d> svd(covariance, Eigen::ComputeFullU | Eigen::ComputeFullV);
-
-      //check determinates (det(V) * det(U) == 1 for rotation or -1 for rotation + reflection)
-      //least square rotation matrix is V * I * U^T if det(V) == 1, V * {{1,0,0},{0,1,0},{0,0,-1}} * U^T if == -1
-      Eigen::Matrix3d i = Eigen::Matrix3d::Identity();
-      if(svd.matrixV().determinant() * svd.matrixU().determinant() < 0)
-        i(2, 2) = -1;
-      transformation = svd.matrixV() * i * svd.matrixU().transpose();
+      if(!getUseGoodPoints() || m_ReferenceGoodFeatures[i]) referencePoints.push_back(i);
+    }
+    for(size_t i = 0; i < movingNumFeatures; i++)
+    {
+      if(!getUseGoodPoints() || m_MovingGoodFeatures[i]) movingPoints.push_back(i);
+    }
+    if(referencePoints.empty() || movingPoints.empty())
+    {
+      setErrorCondition(-1001);
+      notifyErrorMessage(getHumanLabel(), "No points to register", getErrorCondition());
+      return;
     }
 
-    if(getAllowScaling())
+    std::vector<float> treePoints(3 * referencePoints.size());
+    for(size_t i = 0; i < referencePoints.size(); i++)
+      std::copy(m_ReferenceCentroids + 3 * referencePoints[i], m_ReferenceCentroids + 3 * referencePoints[i] + 3, treePoints.begin() + 3 * i);
+    KdTree<float> tree(treePoints.data(), referencePoints.size(), 3);
+
+    std::vector<size_t> closest(movingPoints.size());
+    std::vector<float> distance2(movingPoints.size());
+    const float maxDistance2 = getMaxPairDistance() > 0.0 ? static_cast<float>(getMaxPairDistance() * getMaxPairDistance()) : std::numeric_limits<float>::max();
+    double previousError = std::numeric_limits<double>::max();
+    for(int iteration = 0; iteration < getMaxIterations(); iteration++)
     {
-      Eigen::Matrix3d scale = Eigen::Matrix3d::Identity();
-      Eigen::Matrix3d numerator = transformation * covariance;
-      Eigen::Matrix3d denomenator = transformation * variance * transformation.transpose();
+      if (getCancel() == true) { return; }
+
+      Detail::ClosestPointFinder finder(tree, m_MovingCentroids, movingPoints, transformation, translation, closest, distance2);
+#ifdef SIMPLib_USE_PARALLEL_ALGORITHMS
+      if (doParallel == true)
+      {
+        tbb::parallel_for(tbb::blocked_range<size_t>(0, movingPoints.size()), finder, tbb::auto_partitioner());
+      }
+      else
+#endif
+      {
+        finder.find(0, movingPoints.size());
+      }
 
-      if(0 == getScalingType())//isotropic scaling
-        scale.diagonal().fill( numerator.trace() / denomenator.trace() );
-      else//anisotropic scaling
-        scale.diagonal() = numerator.diagonal().cwiseQuotient(denomenator.diagonal());
+      //pairs further apart than the maximum distance are ignored
+      pairs.clear();
+      double error = 0.0;
+      for(size_t i = 0; i < movingPoints.size(); i++)
+      {
+        if(distance2[i] > maxDistance2) continue;
+        pairs.push_back(std::make_pair(movingPoints[i], referencePoints[closest[i]]));
+        error += distance2[i];
+      }
+      if(pairs.empty())
+      {
+        setErrorCondition(-1002);
+        notifyErrorMessage(getHumanLabel(), "No moving points are within the maximum pair distance of a reference point", getErrorCondition());
+        return;
+      }
+      error /= pairs.size();
 
-      transformation = transformation * scale;
+      QString ss = QObject::tr("Iteration %1: %2 pairs, mean squared distance %3").arg(iteration + 1).arg(pairs.size()).arg(error);
+      notifyStatusMessage(getHumanLabel(), ss);
+
+      //stop once the pairs no longer get closer
+      if(previousError - error <= getConvergenceTolerance() * previousError) break;
+      previousError = error;
+
+      Detail::computeMoments(m_MovingCentroids, m_ReferenceCentroids, pairs, weights, xBar, yBar, covariance, variance);
+      if(!Detail::solveLinear(covariance, variance, dof, transformation))
+        notifyWarningMessage(getHumanLabel(), "singular variance matrix", 1);
+      translation = yBar - transformation * xBar;
     }
   }
 
-  //centroids are absolulte but transormation must be w.r.t. origin
-  float refOrigin[3] = {0.0f, 0.0f, 0.0f};
-  float movOrigin[3] = {0.0f, 0.0f, 0.0f};
+  //residual of each pair under the final transformation (-1 for points that aren't part of the fit)
+  std::fill(m_Residuals, m_Residuals + movingNumFeatures, -1.0f);
+  std::vector<double> residuals(pairs.size());
+  Detail::ResidualFinder finder(m_MovingCentroids, m_ReferenceCentroids, pairs, transformation, translation, residuals);
+#ifdef SIMPLib_USE_PARALLEL_ALGORITHMS
+  if (doParallel == true)
+  {
+    tbb::parallel_reduce(tbb::blocked_range<size_t>(0, pairs.size()), finder, tbb::auto_partitioner());
+  }
+  else
+#endif
+  {
+    finder.find(0, pairs.size());
+  }
+  for(size_t i = 0; i < pairs.size(); i++)
+    m_Residuals[pairs[i].first] = static_cast<float>(residuals[i]);
 
-  getDataContainerArray()->getDataContainer(getReferenceCentroidsArrayPath().getDataContainerName())->getGeometryAs<ImageGeom>()->getOrigin(refOrigin);
-  getDataContainerArray()->getDataContainer(getMovingCentroidsArrayPath().getDataContainerName())->getGeometryAs<ImageGeom>()->getOrigin(movOrigin);
+  m_RmsResidual[0] = 0.0f;
+  m_MedianResidual[0] = 0.0f;
+  m_MaxResidual[0] = 0.0f;
+  if(!pairs.empty())
+  {
+    m_RmsResidual[0] = static_cast<float>(std::sqrt(finder.sumSquares() / pairs.size()));
+    m_MaxResidual[0] = static_cast<float>(finder.max());
+    std::vector<double>::iterator middle = residuals.begin() + residuals.size() / 2;
+    std::nth_element(residuals.begin(), middle, residuals.end());
+    m_MedianResidual[0] = static_cast<float>(*middle);
+  }
+
+  //condition number of the (symmetric positive semidefinite) variance matrix: large values mean the points don't constrain all directions
+  Eigen::SelfAdjointEigenSolver<Eigen::Matrix3d> eigenSolver(variance, Eigen::EigenvaluesOnly);
+  const double smallest = eigenSolver.eigenvalues()(0);
+  const double largest = eigenSolver.eigenvalues()(2);
+  m_ConditionNumber[0] = smallest > 0.0 ? static_cast<float>(largest / smallest) : std::numeric_limits<float>::infinity();
+
+  QString ss = QObject::tr("%1 pairs, rms residual %2, maximum residual %3").arg(pairs.size()).arg(m_RmsResidual[0]).arg(m_MaxResidual[0]);
+  notifyStatusMessage(getHumanLabel(), ss);
 
-  yBar += Eigen::Vector3d(refOrigin[0], refOrigin[1], refOrigin[2]);
-  xBar += Eigen::Vector3d(movOrigin[0], movOrigin[1], movOrigin[2]);
+  //spread of the rotation, scale and translation over bootstrap resamples of the fitted pairs
+  if(getEstimateUncertainty())
+  {
+    std::fill(m_TransformationUncertainty, m_TransformationUncertainty + Detail::k_UncertaintyComponents, 0.0f);
+    const size_t numResamples = static_cast<size_t>(getBootstrapResamples());
+    if(pairs.size() < 2 || numResamples < 2)
+    {
+      notifyWarningMessage(getHumanLabel(), "Too few pairs or resamples to estimate uncertainty", 1);
+    }
+    else
+    {
+      notifyStatusMessage(getHumanLabel(), QObject::tr("Solving %1 bootstrap resamples").arg(numResamples));
+      std::vector<double> parameters(9 * numResamples);
+      std::vector<char> solved(numResamples);
+      Detail::BootstrapResampler resampler(m_MovingCentroids, m_ReferenceCentroids, pairs, fitWeights, dof,
+                                           Eigen::Vector3d(refOrigin[0], refOrigin[1], refOrigin[2]), Eigen::Vector3d(movOrigin[0], movOrigin[1], movOrigin[2]), transformation, parameters, solved);
+#ifdef SIMPLib_USE_PARALLEL_ALGORITHMS
+      if (doParallel == true)
+      {
+        tbb::parallel_for(tbb::blocked_range<size_t>(0, numResamples), resampler, tbb::auto_partitioner());
+      }
+      else
+#endif
+      {
+        resampler.resample(0, numResamples);
+      }
+
+      //leave out resamples that couldn't be solved
+      std::vector<size_t> kept;
+      for(size_t r = 0; r < numResamples; r++)
+        if(solved[r]) kept.push_back(r);
+      const size_t numSkipped = numResamples - kept.size();
+      m_TransformationUncertainty[11] = static_cast<float>(numSkipped);
+      if(numSkipped > 0)
+      {
+        QString ss = QObject::tr("%1 of %2 bootstrap resamples were degenerate and were skipped").arg(numSkipped).arg(numResamples);
+        notifyWarningMessage(getHumanLabel(), ss, 1);
+      }
+
+      if(kept.size() < 2)
+      {
+        notifyWarningMessage(getHumanLabel(), "Too few bootstrap resamples could be solved to estimate uncertainty", 1);
+      }
+      else
+      {
+        //rms and 95th percentile of the angle between each resampled rotation and the fitted rotation
+        const double toDegrees = 180.0 / SIMPLib::Constants::k_Pi;
+        std::vector<double> angles(kept.size());
+        double sumSquares = 0.0;
+        for(size_t k = 0; k < kept.size(); k++)
+        {
+          angles[k] = Eigen::Map<const Eigen::Vector3d>(&parameters[9 * kept[k]]).norm();
+          sumSquares += angles[k] * angles[k];
+        }
+        std::vector<double>::iterator percentile = angles.begin() + static_cast<size_t>(std::ceil(0.95 * angles.size())) - 1;
+        std::nth_element(angles.begin(), percentile, angles.end());
+        m_TransformationUncertainty[0] = static_cast<float>(toDegrees * std::sqrt(sumSquares / angles.size()));
+        m_TransformationUncertainty[1] = static_cast<float>(toDegrees * *percentile);
+
+        //sample standard deviation of each rotation vector component, scale factor and translation component
+        for(size_t j = 0; j < 9; j++)
+        {
+          double mean = 0.0;
+          double m2 = 0.0;
+          for(size_t k = 0; k < kept.size(); k++)
+          {
+            const double value = parameters[9 * kept[k] + j];
+            const double delta = value - mean;
+            mean += delta / (k + 1);
+            m2 += delta * (value - mean);
+          }
+          const double stdDev = std::sqrt(m2 / (kept.size() - 1));
+          m_TransformationUncertainty[2 + j] = static_cast<float>(j < 3 ? toDegrees * stdDev : stdDev);
+        }
+      }
+    }
+  }
 
-  //compute translation and fill in transformation
-  translation = yBar - transformation * xBar;
+  //compute translation between absolute positions and fill in transformation
+  translation += Eigen::Vector3d(refOrigin[0], refOrigin[1], refOrigin[2]) - transformation * Eigen::Vector3d(movOrigin[0], movOrigin[1], movOrigin[2]);
 
   m_Transform[0] = transformation(0, 0);
   m_Transform[1] = transformation(0, 1);
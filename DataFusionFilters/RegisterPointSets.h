@@ -20,6 +20,8 @@
 #ifndef _RegisterPointSets_H_
 #define _RegisterPointSets_H_
 
+#include <QtCore/QPair>
+
 #include "SIMPLib/SIMPLib.h"
 #include "SIMPLib/Common/SIMPLibSetGetMacros.h"
 #include "SIMPLib/Common/AbstractFilter.h"
@@ -54,6 +56,12 @@ class RegisterPointSets : public AbstractFilter
     SIMPL_FILTER_PARAMETER(DataArrayPath, WeightsArrayPath)
     Q_PROPERTY(DataArrayPath WeightsArrayPath READ getWeightsArrayPath WRITE setWeightsArrayPath)
 
+    SIMPL_FILTER_PARAMETER(DataArrayPath, ReferenceDescriptorsArrayPath)
+    Q_PROPERTY(DataArrayPath ReferenceDescriptorsArrayPath READ getReferenceDescriptorsArrayPath WRITE setReferenceDescriptorsArrayPath)
+
+    SIMPL_FILTER_PARAMETER(DataArrayPath, MovingDescriptorsArrayPath)
+    Q_PROPERTY(DataArrayPath MovingDescriptorsArrayPath READ getMovingDescriptorsArrayPath WRITE setMovingDescriptorsArrayPath)
+
     SIMPL_FILTER_PARAMETER(QString, AttributeMatrixName)
     Q_PROPERTY(QString AttributeMatrixName READ getAttributeMatrixName WRITE setAttributeMatrixName)
 
@@ -79,10 +87,95 @@ class RegisterPointSets : public AbstractFilter
     SIMPL_INSTANCE_PROPERTY(bool, UseWeights)
     Q_PROPERTY(bool UseWeights READ getUseWeights WRITE setUseWeights)
 
+    //correspondences
+    SIMPL_FILTER_PARAMETER(int, CorrespondenceType)
+    Q_PROPERTY(int CorrespondenceType READ getCorrespondenceType WRITE setCorrespondenceType)
+
+    SIMPL_FILTER_PARAMETER(int, MaxIterations)
+    Q_PROPERTY(int MaxIterations READ getMaxIterations WRITE setMaxIterations)
+
+    SIMPL_FILTER_PARAMETER(double, MaxPairDistance)
+    Q_PROPERTY(double MaxPairDistance READ getMaxPairDistance WRITE setMaxPairDistance)
+
+    SIMPL_FILTER_PARAMETER(double, ConvergenceTolerance)
+    Q_PROPERTY(double ConvergenceTolerance READ getConvergenceTolerance WRITE setConvergenceTolerance)
+
+    SIMPL_FILTER_PARAMETER(int, DescriptorCandidates)
+    Q_PROPERTY(int DescriptorCandidates READ getDescriptorCandidates WRITE setDescriptorCandidates)
+
+    SIMPL_FILTER_PARAMETER(int, VotingNeighbors)
+    Q_PROPERTY(int VotingNeighbors READ getVotingNeighbors WRITE setVotingNeighbors)
+
+    SIMPL_FILTER_PARAMETER(double, ConsistencyDistance)
+    Q_PROPERTY(double ConsistencyDistance READ getConsistencyDistance WRITE setConsistencyDistance)
+
+    SIMPL_FILTER_PARAMETER(int, MinimumVotes)
+    Q_PROPERTY(int MinimumVotes READ getMinimumVotes WRITE setMinimumVotes)
+
+    //robust estimation
+    SIMPL_FILTER_PARAMETER(int, RobustMethod)
+    Q_PROPERTY(int RobustMethod READ getRobustMethod WRITE setRobustMethod)
+
+    SIMPL_FILTER_PARAMETER(double, InlierDistance)
+    Q_PROPERTY(double InlierDistance READ getInlierDistance WRITE setInlierDistance)
+
+    SIMPL_FILTER_PARAMETER(int, MaxHypotheses)
+    Q_PROPERTY(int MaxHypotheses READ getMaxHypotheses WRITE setMaxHypotheses)
+
+    SIMPL_FILTER_PARAMETER(double, RansacConfidence)
+    Q_PROPERTY(double RansacConfidence READ getRansacConfidence WRITE setRansacConfidence)
+
+    SIMPL_FILTER_PARAMETER(int, WeightFunction)
+    Q_PROPERTY(int WeightFunction READ getWeightFunction WRITE setWeightFunction)
+
+    SIMPL_FILTER_PARAMETER(double, TuningConstant)
+    Q_PROPERTY(double TuningConstant READ getTuningConstant WRITE setTuningConstant)
+
+    SIMPL_FILTER_PARAMETER(int, RobustIterations)
+    Q_PROPERTY(int RobustIterations READ getRobustIterations WRITE setRobustIterations)
+
+    //uncertainty
+    SIMPL_FILTER_PARAMETER(bool, EstimateUncertainty)
+    Q_PROPERTY(bool EstimateUncertainty READ getEstimateUncertainty WRITE setEstimateUncertainty)
+
+    SIMPL_FILTER_PARAMETER(int, BootstrapResamples)
+    Q_PROPERTY(int BootstrapResamples READ getBootstrapResamples WRITE setBootstrapResamples)
+
+    //batch registration
+    SIMPL_FILTER_PARAMETER(bool, BatchRegistration)
+    Q_PROPERTY(bool BatchRegistration READ getBatchRegistration WRITE setBatchRegistration)
+
+    SIMPL_FILTER_PARAMETER(QString, DataContainerPrefix)
+    Q_PROPERTY(QString DataContainerPrefix READ getDataContainerPrefix WRITE setDataContainerPrefix)
+
+    SIMPL_FILTER_PARAMETER(QString, RegistrationPairs)
+    Q_PROPERTY(QString RegistrationPairs READ getRegistrationPairs WRITE setRegistrationPairs)
+
     //created arrays
     SIMPL_FILTER_PARAMETER(QString, TransformName)
     Q_PROPERTY(QString TransformName READ getTransformName WRITE setTransformName)
 
+    SIMPL_FILTER_PARAMETER(QString, InliersArrayName)
+    Q_PROPERTY(QString InliersArrayName READ getInliersArrayName WRITE setInliersArrayName)
+
+    SIMPL_FILTER_PARAMETER(QString, ResidualsArrayName)
+    Q_PROPERTY(QString ResidualsArrayName READ getResidualsArrayName WRITE setResidualsArrayName)
+
+    SIMPL_FILTER_PARAMETER(QString, RmsResidualArrayName)
+    Q_PROPERTY(QString RmsResidualArrayName READ getRmsResidualArrayName WRITE setRmsResidualArrayName)
+
+    SIMPL_FILTER_PARAMETER(QString, MedianResidualArrayName)
+    Q_PROPERTY(QString MedianResidualArrayName READ getMedianResidualArrayName WRITE setMedianResidualArrayName)
+
+    SIMPL_FILTER_PARAMETER(QString, MaxResidualArrayName)
+    Q_PROPERTY(QString MaxResidualArrayName READ getMaxResidualArrayName WRITE setMaxResidualArrayName)
+
+    SIMPL_FILTER_PARAMETER(QString, ConditionNumberArrayName)
+    Q_PROPERTY(QString ConditionNumberArrayName READ getConditionNumberArrayName WRITE setConditionNumberArrayName)
+
+    SIMPL_FILTER_PARAMETER(QString, TransformationUncertaintyArrayName)
+    Q_PROPERTY(QString TransformationUncertaintyArrayName READ getTransformationUncertaintyArrayName WRITE setTransformationUncertaintyArrayName)
+
 
     /**
      * @brief getCompiledLibraryName Reimplemented from @see AbstractFilter class
@@ -165,13 +258,50 @@ class RegisterPointSets : public AbstractFilter
      */
     void dataCheck();
 
+    /**
+     * @brief stepNames Names of the data containers registered in batch mode sorted by the number following the prefix
+     */
+    QVector<QString> stepNames();
+
+    /**
+     * @brief registrationPairs (reference, moving) data container names registered in batch mode: the entries of the
+     * registration pair list if one is given, otherwise each step registered to the previous step
+     */
+    QVector<QPair<QString, QString> > registrationPairs();
+
+    /**
+     * @brief pointArrayName Name of a per point output array in the moving data container of a pair (suffixed with the
+     * reference name when an explicit pair list is used, since a step can be the moving step of several pairs)
+     * @param name output array name
+     * @param reference name of the pair's reference data container
+     */
+    QString pointArrayName(const QString& name, const QString& reference);
+
+    /**
+     * @brief createPairFilter Creates a filter that registers one batch pair in private copies of its data containers
+     * @param reference name of the pair's reference data container
+     * @param moving name of the pair's moving data container
+     */
+    RegisterPointSets::Pointer createPairFilter(const QString& reference, const QString& moving);
+
   private:
     DEFINE_DATAARRAY_VARIABLE(float, ReferenceCentroids)
     DEFINE_DATAARRAY_VARIABLE(float, MovingCentroids)
     DEFINE_DATAARRAY_VARIABLE(bool, ReferenceGoodFeatures)
     DEFINE_DATAARRAY_VARIABLE(bool, MovingGoodFeatures)
     DEFINE_DATAARRAY_VARIABLE(float, Weights)
+    DEFINE_DATAARRAY_VARIABLE(float, ReferenceDescriptors)
+    DEFINE_DATAARRAY_VARIABLE(float, MovingDescriptors)
     DEFINE_DATAARRAY_VARIABLE(float, Transform)
+    DEFINE_DATAARRAY_VARIABLE(bool, Inliers)
+    DEFINE_DATAARRAY_VARIABLE(float, Residuals)
+    DEFINE_DATAARRAY_VARIABLE(float, RmsResidual)
+    DEFINE_DATAARRAY_VARIABLE(float, MedianResidual)
+    DEFINE_DATAARRAY_VARIABLE(float, MaxResidual)
+    DEFINE_DATAARRAY_VARIABLE(float, ConditionNumber)
+    DEFINE_DATAARRAY_VARIABLE(float, TransformationUncertainty)
+
+    bool m_BatchPair;//registers one pair of a batch (runs inside the batch's task scheduler)
 
     RegisterPointSets(const RegisterPointSets&); // Copy Constructor Not Implemented
     void operator=(const RegisterPointSets&); // Operator '=' Not Implemented
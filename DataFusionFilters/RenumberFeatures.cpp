@@ -26,6 +26,8 @@
 #include "SIMPLib/FilterParameters/ChoiceFilterParameter.h"
 
 #include "DataFusion/DataFusionConstants.h"
+#include "DataFusion/DataFusionFilters/util/FeatureRelabel.h"
+#include "DataFusion/DataFusionFilters/util/RowRuns.h"
 
 // Include the MOC generated file for this class
 #include "moc_RenumberFeatures.cpp"
@@ -187,6 +189,7 @@ void RenumberFeatures::execute()
   for(size_t i = 0; i < numFeatures; i++)
     fromIds[i] = i;
 
+  notifyStatusMessage(getHumanLabel(), "Sorting features");
   //sort map by scalar array
   QString typeName = p->getTypeAsString();
   if (typeName.compare("int8_t") == 0) {
@@ -222,11 +225,21 @@ void RenumberFeatures::execute()
   for(size_t i = 0; i < numFeatures; i++)
     toIds[fromIds[i]] = i;
 
-  //renumber feature ids
-  int64_t numCells = m_FeatureIdsPtr.lock()->getNumberOfTuples();
-  for(int64_t i = 0; i < numCells; i++)
-    m_FeatureIds[i] = toIds[m_FeatureIds[i]];
+  notifyStatusMessage(getHumanLabel(), "Renumbering feature ids");
+  //renumber feature ids one run at a time (a volume that isn't on an image geometry would be a single row, so it is relabeled voxel by voxel instead)
+  size_t numCells = m_FeatureIdsPtr.lock()->getNumberOfTuples();
+  size_t udims[3] = { numCells, 1, 1 };
+  if(RowRuns::GridDimensions(getDataContainerArray()->getDataContainer(getFeatureIdsArrayPath().getDataContainerName())->getGeometryAs<ImageGeom>(), numCells, udims))
+  {
+    RowRuns runs(m_FeatureIds, udims[0], udims[1] * udims[2]);
+    FeatureRelabel::relabel(m_FeatureIds, runs, toIds);
+  }
+  else
+  {
+    FeatureRelabel::relabel(m_FeatureIds, numCells, toIds);
+  }
 
+  notifyStatusMessage(getHumanLabel(), "Reordering feature data");
   //reorder arrays in feature attribute matrix
   AttributeMatrix::Pointer featureAttrMat = getDataContainerArray()->getDataContainer(getScalarArrayPath().getDataContainerName())->getAttributeMatrix(getScalarArrayPath().getAttributeMatrixName());
   QList<QString> arrayNames = featureAttrMat->getAttributeArrayNames();
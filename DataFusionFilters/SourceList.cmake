@@ -28,11 +28,14 @@ START_FILTER_GROUP(${DataFusion_BINARY_DIR} "${_filterGroupName}" "DataFusion")
 #---------
 # List your public filters here
 set(_PublicFilters
+  FitDisplacementField
   FuseVolumes
+  GenerateVoronoiVolumes
   MatchFeatureIds
   RegisterOrientations
   RegisterPointSets
   RenumberFeatures
+  TrackFeatureIds
 
 )
 
@@ -63,6 +66,16 @@ foreach(f ${_PrivateFilters} )
 endforeach()
 
 
+#---------------------
+# Support files shared by the filters
+ADD_DREAM3D_SUPPORT_HEADER(${DataFusion_SOURCE_DIR} ${_filterGroupName} util/DisplacementGrid.h)
+ADD_DREAM3D_SUPPORT_HEADER(${DataFusion_SOURCE_DIR} ${_filterGroupName} util/FeatureRelabel.h)
+ADD_DREAM3D_SUPPORT_HEADER(${DataFusion_SOURCE_DIR} ${_filterGroupName} util/H5SlabStream.h)
+ADD_DREAM3D_SUPPORT_HEADER(${DataFusion_SOURCE_DIR} ${_filterGroupName} util/KdTree.h)
+ADD_DREAM3D_SUPPORT_HEADER(${DataFusion_SOURCE_DIR} ${_filterGroupName} util/RowRuns.h)
+ADD_DREAM3D_SUPPORT_HEADER(${DataFusion_SOURCE_DIR} ${_filterGroupName} util/StepNames.h)
+ADD_DREAM3D_SUPPORT_HEADER(${DataFusion_SOURCE_DIR} ${_filterGroupName} util/VoronoiGenerator.h)
+ADD_DREAM3D_SUPPORT_HEADER(${DataFusion_SOURCE_DIR} ${_filterGroupName} util/WeightedMoments.h)
 
 #---------------------
 # This macro must come last after we are done adding all the filters and support files.
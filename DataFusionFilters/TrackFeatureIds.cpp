@@ -0,0 +1,416 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ *                                                                             *
+ * Copyright (c) 2015 William Lenthe                                           *
+ *                                                                             *
+ * This program is free software: you can redistribute it and/or modify        *
+ * it under the terms of the GNU Lesser General Public License as published by *
+ * the Free Software Foundation, either version 3 of the License, or           *
+ * (at your option) any later version.                                         *
+ *                                                                             *
+ * This program is distributed in the hope that it will be useful,             *
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of              *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the               *
+ * GNU Lesser General Public License for more details.                         *
+ *                                                                             *
+ * You should have received a copy of the GNU Lesser General Public License    *
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.       *
+ *                                                                             *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+ 
+
+#include "TrackFeatureIds.h"
+
+#include "SIMPLib/Common/Constants.h"
+#include "SIMPLib/FilterParameters/AbstractFilterParametersReader.h"
+#include "SIMPLib/FilterParameters/AbstractFilterParametersWriter.h"
+
+#include "SIMPLib/FilterParameters/ChoiceFilterParameter.h"
+#include "SIMPLib/FilterParameters/DoubleFilterParameter.h"
+#include "SIMPLib/FilterParameters/StringFilterParameter.h"
+#include "SIMPLib/FilterParameters/LinkedBooleanFilterParameter.h"
+
+#include "DataFusion/DataFusionConstants.h"
+#include "DataFusion/DataFusionFilters/util/StepNames.h"
+
+// Include the MOC generated file for this class
+#include "moc_TrackFeatureIds.cpp"
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+TrackFeatureIds::TrackFeatureIds() :
+  AbstractFilter(),
+  m_DataContainerPrefix("Step"),
+  m_CellAttributeMatrixName(DREAM3D::Defaults::CellAttributeMatrixName),
+  m_CellFeatureAttributeMatrixName(DREAM3D::Defaults::CellFeatureAttributeMatrixName),
+  m_CellEnsembleAttributeMatrixName(DREAM3D::Defaults::CellEnsembleAttributeMatrixName),
+  m_FeatureIdsArrayName(DREAM3D::CellData::FeatureIds),
+  m_Metric(1),
+  m_MetricThreshold(0.5),
+  m_MatchingMethod(0),
+  m_UseOrientations(false),
+  m_OrientationTolerance(5.0),
+  m_QuatsArrayName(DREAM3D::FeatureData::AvgQuats),
+  m_PhasesArrayName(DREAM3D::FeatureData::Phases),
+  m_CrystalStructuresArrayName(DREAM3D::EnsembleData::CrystalStructures),
+  m_NewFeaturesArrayName(DataFusionConstants::NewFeatures),
+  m_EndingFeaturesArrayName(DataFusionConstants::EndingFeatures),
+  m_TrackDataContainerName(DataFusionConstants::FeatureTracks),
+  m_TrackAttributeMatrixName(DataFusionConstants::Tracks),
+  m_FirstStepArrayName(DataFusionConstants::FirstStep),
+  m_LastStepArrayName(DataFusionConstants::LastStep),
+  m_StepVolumesArrayName(DataFusionConstants::StepVolumes),
+  m_FirstStep(NULL),
+  m_LastStep(NULL),
+  m_StepVolumes(NULL)
+{
+  setupFilterParameters();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+TrackFeatureIds::~TrackFeatureIds()
+{
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void TrackFeatureIds::setupFilterParameters()
+{
+  FilterParameterVector parameters;
+  parameters.push_back(StringFilterParameter::New("Time Step Data Container Prefix", "DataContainerPrefix", getDataContainerPrefix(), FilterParameter::Parameter));
+  parameters.push_back(StringFilterParameter::New("Cell Attribute Matrix", "CellAttributeMatrixName", getCellAttributeMatrixName(), FilterParameter::RequiredArray));
+  parameters.push_back(StringFilterParameter::New("Cell Feature Attribute Matrix", "CellFeatureAttributeMatrixName", getCellFeatureAttributeMatrixName(), FilterParameter::RequiredArray));
+  parameters.push_back(StringFilterParameter::New("Feature Ids", "FeatureIdsArrayName", getFeatureIdsArrayName(), FilterParameter::RequiredArray));
+
+  {
+    QVector<QString> choices;
+    choices.push_back("Jaccard");
+    choices.push_back("Sorensen-Dice");
+    choices.push_back("Ochiai (cosine)");
+    ChoiceFilterParameter::Pointer parameter = ChoiceFilterParameter::New();
+    parameter->setHumanLabel("Similarity Coefficient");
+    parameter->setPropertyName("Metric");
+    parameter->setChoices(choices);
+    parameter->setCategory(FilterParameter::Parameter);
+    parameters.push_back(parameter);
+  }
+
+  parameters.push_back(DoubleFilterParameter::New("Minimum Metric Value", "MetricThreshold", getMetricThreshold(), FilterParameter::Parameter));
+
+  {
+    QVector<QString> choices;
+    choices.push_back("Greedy");
+    choices.push_back("Optimal");
+    ChoiceFilterParameter::Pointer parameter = ChoiceFilterParameter::New();
+    parameter->setHumanLabel("Matching Method");
+    parameter->setPropertyName("MatchingMethod");
+    parameter->setChoices(choices);
+    parameter->setCategory(FilterParameter::Parameter);
+    parameters.push_back(parameter);
+  }
+
+  QStringList linkedProps;
+  linkedProps<<"OrientationTolerance"<<"QuatsArrayName"<<"PhasesArrayName"<<"CellEnsembleAttributeMatrixName"<<"CrystalStructuresArrayName";
+  parameters.push_back(LinkedBooleanFilterParameter::New("Require Orientation Match", "UseOrientations", getUseOrientations(), linkedProps, FilterParameter::Parameter));
+  parameters.push_back(DoubleFilterParameter::New("Orientation Tolerance Angle (degrees)", "OrientationTolerance", getOrientationTolerance(), FilterParameter::Parameter));
+  parameters.push_back(StringFilterParameter::New("Features Average Quats", "QuatsArrayName", getQuatsArrayName(), FilterParameter::RequiredArray));
+  parameters.push_back(StringFilterParameter::New("Features Phases", "PhasesArrayName", getPhasesArrayName(), FilterParameter::RequiredArray));
+  parameters.push_back(StringFilterParameter::New("Cell Ensemble Attribute Matrix", "CellEnsembleAttributeMatrixName", getCellEnsembleAttributeMatrixName(), FilterParameter::RequiredArray));
+  parameters.push_back(StringFilterParameter::New("Crystal Structures", "CrystalStructuresArrayName", getCrystalStructuresArrayName(), FilterParameter::RequiredArray));
+
+  parameters.push_back(StringFilterParameter::New("New Features", "NewFeaturesArrayName", getNewFeaturesArrayName(), FilterParameter::CreatedArray));
+  parameters.push_back(StringFilterParameter::New("Ending Features", "EndingFeaturesArrayName", getEndingFeaturesArrayName(), FilterParameter::CreatedArray));
+  parameters.push_back(StringFilterParameter::New("Track Data Container", "TrackDataContainerName", getTrackDataContainerName(), FilterParameter::CreatedArray));
+  parameters.push_back(StringFilterParameter::New("Track Attribute Matrix", "TrackAttributeMatrixName", getTrackAttributeMatrixName(), FilterParameter::CreatedArray));
+  parameters.push_back(StringFilterParameter::New("First Step", "FirstStepArrayName", getFirstStepArrayName(), FilterParameter::CreatedArray));
+  parameters.push_back(StringFilterParameter::New("Last Step", "LastStepArrayName", getLastStepArrayName(), FilterParameter::CreatedArray));
+  parameters.push_back(StringFilterParameter::New("Step Volumes", "StepVolumesArrayName", getStepVolumesArrayName(), FilterParameter::CreatedArray));
+  setFilterParameters(parameters);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void TrackFeatureIds::readFilterParameters(AbstractFilterParametersReader* reader, int index)
+{
+  reader->openFilterGroup(this, index);
+  setDataContainerPrefix( reader->readString("DataContainerPrefix", getDataContainerPrefix() ) );
+  setCellAttributeMatrixName( reader->readString("CellAttributeMatrixName", getCellAttributeMatrixName() ) );
+  setCellFeatureAttributeMatrixName( reader->readString("CellFeatureAttributeMatrixName", getCellFeatureAttributeMatrixName() ) );
+  setCellEnsembleAttributeMatrixName( reader->readString("CellEnsembleAttributeMatrixName", getCellEnsembleAttributeMatrixName() ) );
+  setFeatureIdsArrayName( reader->readString("FeatureIdsArrayName", getFeatureIdsArrayName() ) );
+
+  setMetric( reader->readValue("Metric", getMetric()) );
+  setMetricThreshold( reader->readValue("MetricThreshold", getMetricThreshold() ) );
+  setMatchingMethod( reader->readValue("MatchingMethod", getMatchingMethod() ) );
+
+  setUseOrientations(reader->readValue("UseOrientations", getUseOrientations() ) );
+  setOrientationTolerance(reader->readValue("OrientationTolerance", getOrientationTolerance() ) );
+  setQuatsArrayName( reader->readString("QuatsArrayName", getQuatsArrayName() ) );
+  setPhasesArrayName( reader->readString("PhasesArrayName", getPhasesArrayName() ) );
+  setCrystalStructuresArrayName( reader->readString("CrystalStructuresArrayName", getCrystalStructuresArrayName() ) );
+
+  setNewFeaturesArrayName( reader->readString("NewFeaturesArrayName", getNewFeaturesArrayName() ) );
+  setEndingFeaturesArrayName( reader->readString("EndingFeaturesArrayName", getEndingFeaturesArrayName() ) );
+  setTrackDataContainerName( reader->readString("TrackDataContainerName", getTrackDataContainerName() ) );
+  setTrackAttributeMatrixName( reader->readString("TrackAttributeMatrixName", getTrackAttributeMatrixName() ) );
+  setFirstStepArrayName( reader->readString("FirstStepArrayName", getFirstStepArrayName() ) );
+  setLastStepArrayName( reader->readString("LastStepArrayName", getLastStepArrayName() ) );
+  setStepVolumesArrayName( reader->readString("StepVolumesArrayName", getStepVolumesArrayName() ) );
+  reader->closeFilterGroup();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int TrackFeatureIds::writeFilterParameters(AbstractFilterParametersWriter* writer, int index)
+{
+  writer->openFilterGroup(this, index);
+  SIMPL_FILTER_WRITE_PARAMETER(FilterVersion)
+  SIMPL_FILTER_WRITE_PARAMETER(DataContainerPrefix)
+  SIMPL_FILTER_WRITE_PARAMETER(CellAttributeMatrixName)
+  SIMPL_FILTER_WRITE_PARAMETER(CellFeatureAttributeMatrixName)
+  SIMPL_FILTER_WRITE_PARAMETER(CellEnsembleAttributeMatrixName)
+  SIMPL_FILTER_WRITE_PARAMETER(FeatureIdsArrayName)
+
+  SIMPL_FILTER_WRITE_PARAMETER(Metric)
+  SIMPL_FILTER_WRITE_PARAMETER(MetricThreshold)
+  SIMPL_FILTER_WRITE_PARAMETER(MatchingMethod)
+
+  SIMPL_FILTER_WRITE_PARAMETER(UseOrientations)
+  SIMPL_FILTER_WRITE_PARAMETER(OrientationTolerance)
+  SIMPL_FILTER_WRITE_PARAMETER(QuatsArrayName)
+  SIMPL_FILTER_WRITE_PARAMETER(PhasesArrayName)
+  SIMPL_FILTER_WRITE_PARAMETER(CrystalStructuresArrayName)
+
+  SIMPL_FILTER_WRITE_PARAMETER(NewFeaturesArrayName)
+  SIMPL_FILTER_WRITE_PARAMETER(EndingFeaturesArrayName)
+  SIMPL_FILTER_WRITE_PARAMETER(TrackDataContainerName)
+  SIMPL_FILTER_WRITE_PARAMETER(TrackAttributeMatrixName)
+  SIMPL_FILTER_WRITE_PARAMETER(FirstStepArrayName)
+  SIMPL_FILTER_WRITE_PARAMETER(LastStepArrayName)
+  SIMPL_FILTER_WRITE_PARAMETER(StepVolumesArrayName)
+  writer->closeFilterGroup();
+  return ++index; // we want to return the next index that was just written to
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QVector<QString> TrackFeatureIds::stepNames()
+{
+  return StepNames::find(getDataContainerArray(), getDataContainerPrefix(), getTrackDataContainerName());
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+MatchFeatureIds::Pointer TrackFeatureIds::createMatcher(const QString& reference, const QString& moving)
+{
+  MatchFeatureIds::Pointer matcher = MatchFeatureIds::New();
+  matcher->setDataContainerArray(getDataContainerArray());
+  matcher->setReferenceFeatureIdsArrayPath(DataArrayPath(reference, getCellAttributeMatrixName(), getFeatureIdsArrayName()));
+  matcher->setMovingFeatureIdsArrayPath(DataArrayPath(moving, getCellAttributeMatrixName(), getFeatureIdsArrayName()));
+  matcher->setReferenceCellFeatureAttributeMatrixPath(DataArrayPath(reference, getCellFeatureAttributeMatrixName(), ""));
+  matcher->setMovingCellFeatureAttributeMatrixPath(DataArrayPath(moving, getCellFeatureAttributeMatrixName(), ""));
+  matcher->setMetric(getMetric());
+  matcher->setMetricThreshold(getMetricThreshold());
+  matcher->setMatchingMethod(getMatchingMethod());
+
+  //features of the previous step without a match end, features of this step without a match are new
+  matcher->setReferenceUniqueArrayName(getEndingFeaturesArrayName());
+  matcher->setMovingUniqueArrayName(getNewFeaturesArrayName());
+
+  matcher->setUseOrientations(getUseOrientations());
+  matcher->setOrientationTolerance(getOrientationTolerance());
+  matcher->setReferenceQuatsArrayPath(DataArrayPath(reference, getCellFeatureAttributeMatrixName(), getQuatsArrayName()));
+  matcher->setMovingQuatsArrayPath(DataArrayPath(moving, getCellFeatureAttributeMatrixName(), getQuatsArrayName()));
+  matcher->setReferencePhasesArrayPath(DataArrayPath(reference, getCellFeatureAttributeMatrixName(), getPhasesArrayName()));
+  matcher->setMovingPhasesArrayPath(DataArrayPath(moving, getCellFeatureAttributeMatrixName(), getPhasesArrayName()));
+  matcher->setReferenceCrystalStructuresArrayPath(DataArrayPath(reference, getCellEnsembleAttributeMatrixName(), getCrystalStructuresArrayName()));
+  matcher->setMovingCrystalStructuresArrayPath(DataArrayPath(moving, getCellEnsembleAttributeMatrixName(), getCrystalStructuresArrayName()));
+  return matcher;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void TrackFeatureIds::dataCheck()
+{
+  setErrorCondition(0);
+
+  QVector<QString> steps = stepNames();
+  if(steps.size() < 2)
+  {
+    setErrorCondition(-1000);
+    QString ss = QObject::tr("At least 2 data containers starting with '%1' are required").arg(getDataContainerPrefix());
+    notifyErrorMessage(getHumanLabel(), ss, getErrorCondition());
+    return;
+  }
+
+  //required arrays of each step
+  QVector<size_t> dims(1, 1);
+  for(int i = 0; i < steps.size(); i++)
+  {
+    getDataContainerArray()->getPrereqArrayFromPath<DataArray<int32_t>, AbstractFilter>(this, DataArrayPath(steps[i], getCellAttributeMatrixName(), getFeatureIdsArrayName()), dims);
+    getDataContainerArray()->getPrereqAttributeMatrixFromPath<AbstractFilter>(this, DataArrayPath(steps[i], getCellFeatureAttributeMatrixName(), ""), -303);
+  }
+  if(getErrorCondition() < 0) return;
+
+  //created arrays (the number of tracks isn't known until all steps are matched)
+  DataContainer::Pointer m = getDataContainerArray()->createNonPrereqDataContainer<AbstractFilter>(this, getTrackDataContainerName());
+  if(getErrorCondition() < 0) return;
+  QVector<size_t> tDims(1, 0);
+  m->createNonPrereqAttributeMatrix<AbstractFilter>(this, getTrackAttributeMatrixName(), tDims, DREAM3D::AttributeMatrixType::Generic);
+  if(getErrorCondition() < 0) return;
+
+  DataArrayPath tempPath;
+  tempPath.update(getTrackDataContainerName(), getTrackAttributeMatrixName(), getFirstStepArrayName());
+  m_FirstStepPtr = getDataContainerArray()->createNonPrereqArrayFromPath<DataArray<int32_t>, AbstractFilter, int32_t>(this, tempPath, -1, dims);
+  tempPath.update(getTrackDataContainerName(), getTrackAttributeMatrixName(), getLastStepArrayName());
+  m_LastStepPtr = getDataContainerArray()->createNonPrereqArrayFromPath<DataArray<int32_t>, AbstractFilter, int32_t>(this, tempPath, -1, dims);
+  dims[0] = steps.size();
+  tempPath.update(getTrackDataContainerName(), getTrackAttributeMatrixName(), getStepVolumesArrayName());
+  m_StepVolumesPtr = getDataContainerArray()->createNonPrereqArrayFromPath<DataArray<int64_t>, AbstractFilter, int64_t>(this, tempPath, 0, dims);
+  if(getErrorCondition() < 0) return;
+
+  //preflight the matching of each step so arrays it creates are available to later filters (execute runs the matching itself)
+  if(getInPreflight())
+  {
+    for(int i = 1; i < steps.size(); i++)
+    {
+      MatchFeatureIds::Pointer matcher = createMatcher(steps[i - 1], steps[i]);
+      matcher->preflight();
+      if(matcher->getErrorCondition() < 0)
+      {
+        setErrorCondition(matcher->getErrorCondition());
+        QString ss = QObject::tr("Unable to match the features of '%1' to '%2'").arg(steps[i]).arg(steps[i - 1]);
+        notifyErrorMessage(getHumanLabel(), ss, getErrorCondition());
+        return;
+      }
+    }
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void TrackFeatureIds::preflight()
+{
+  // These are the REQUIRED lines of CODE to make sure the filter behaves correctly
+  setInPreflight(true); // Set the fact that we are preflighting.
+  emit preflightAboutToExecute(); // Emit this signal so that other widgets can do one file update
+  emit updateFilterParameters(this); // Emit this signal to have the widgets push their values down to the filter
+  dataCheck(); // Run our DataCheck to make sure everthing is setup correctly
+  emit preflightExecuted(); // We are done preflighting this filter
+  setInPreflight(false); // Inform the system this filter is NOT in preflight mode anymore.
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void TrackFeatureIds::execute()
+{
+  setErrorCondition(0);
+  dataCheck();
+  if(getErrorCondition() < 0) { return; }
+
+  if (getCancel() == true) { return; }
+
+  // each step is matched to the previous step (already renumbered into the global id space) so new features always get ids past every earlier feature
+  // each match hands its renumbered runs, feature volumes, and symmetry operators to the next match, so every step is encoded once and its volumes
+  // come from the run lengths instead of another pass over the voxels (the first match fills the empty cache of the first step)
+  QVector<QString> steps = stepNames();
+  std::vector< std::vector<int64_t> > stepVolumes(steps.size());
+  MatchFeatureIds::StepCache caches[2];
+  for(int i = 1; i < steps.size(); i++)
+  {
+    if (getCancel() == true) { return; }
+
+    QString ss = QObject::tr("Matching '%1' to '%2'").arg(steps[i]).arg(steps[i - 1]);
+    notifyStatusMessage(getHumanLabel(), ss);
+    MatchFeatureIds::StepCache& previous = caches[(i - 1) % 2];
+    MatchFeatureIds::StepCache& current = caches[i % 2];
+    MatchFeatureIds::Pointer matcher = createMatcher(steps[i - 1], steps[i]);
+    matcher->setReferenceCache(&previous);
+    matcher->setMovingCache(&current);
+    matcher->execute();
+    if(matcher->getErrorCondition() < 0)
+    {
+      setErrorCondition(matcher->getErrorCondition());
+      ss = QObject::tr("Unable to match the features of '%1' to '%2'").arg(steps[i]).arg(steps[i - 1]);
+      notifyErrorMessage(getHumanLabel(), ss, getErrorCondition());
+      return;
+    }
+
+    if(1 == i) stepVolumes[0] = previous.volumes;
+    stepVolumes[i] = current.volumes;
+  }
+
+  // the last step's feature attribute matrix spans every global id
+  size_t numTracks = stepVolumes.back().size();
+  QVector<size_t> tDims(1, numTracks);
+  getDataContainerArray()->getDataContainer(getTrackDataContainerName())->getAttributeMatrix(getTrackAttributeMatrixName())->resizeAttributeArrays(tDims);
+  m_FirstStep = m_FirstStepPtr.lock()->getPointer(0);
+  m_LastStep = m_LastStepPtr.lock()->getPointer(0);
+  m_StepVolumes = m_StepVolumesPtr.lock()->getPointer(0);
+
+  size_t numSteps = steps.size();
+  for(size_t j = 0; j < numTracks; j++)
+  {
+    m_FirstStep[j] = -1;
+    m_LastStep[j] = -1;
+    for(size_t i = 0; i < numSteps; i++)
+    {
+      int64_t volume = j < stepVolumes[i].size() ? stepVolumes[i][j] : 0;
+      m_StepVolumes[j * numSteps + i] = volume;
+      if(volume > 0)
+      {
+        if(-1 == m_FirstStep[j]) m_FirstStep[j] = static_cast<int32_t>(i);
+        m_LastStep[j] = static_cast<int32_t>(i);
+      }
+    }
+  }
+
+  notifyStatusMessage(getHumanLabel(), "Complete");
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+AbstractFilter::Pointer TrackFeatureIds::newFilterInstance(bool copyFilterParameters)
+{
+  TrackFeatureIds::Pointer filter = TrackFeatureIds::New();
+  if(true == copyFilterParameters)
+  {
+    copyFilterParameterInstanceVariables(filter.get());
+  }
+  return filter;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+const QString TrackFeatureIds::getCompiledLibraryName()
+{ return DataFusionConstants::DataFusionBaseName; }
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+const QString TrackFeatureIds::getGroupName()
+{ return DREAM3D::FilterGroups::Unsupported; }
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+const QString TrackFeatureIds::getHumanLabel()
+{ return "Track Feature Ids"; }
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+const QString TrackFeatureIds::getSubGroupName()
+{ return "DataFusion"; }
@@ -0,0 +1,208 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ *                                                                             *
+ * Copyright (c) 2015 William Lenthe                                           *
+ *                                                                             *
+ * This program is free software: you can redistribute it and/or modify        *
+ * it under the terms of the GNU Lesser General Public License as published by *
+ * the Free Software Foundation, either version 3 of the License, or           *
+ * (at your option) any later version.                                         *
+ *                                                                             *
+ * This program is distributed in the hope that it will be useful,             *
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of              *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the               *
+ * GNU Lesser General Public License for more details.                         *
+ *                                                                             *
+ * You should have received a copy of the GNU Lesser General Public License    *
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.       *
+ *                                                                             *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+ 
+#ifndef _TrackFeatureIds_H_
+#define _TrackFeatureIds_H_
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/Common/SIMPLibSetGetMacros.h"
+#include "SIMPLib/Common/AbstractFilter.h"
+
+#include "DataFusion/DataFusionFilters/MatchFeatureIds.h"
+
+/**
+ * @brief The TrackFeatureIds class. See [Filter documentation](@ref TrackFeatureIds) for details.
+ */
+class TrackFeatureIds : public AbstractFilter
+{
+  Q_OBJECT /* Need this for Qt's signals and slots mechanism to work */
+
+  public:
+    SIMPL_SHARED_POINTERS(TrackFeatureIds)
+    SIMPL_STATIC_NEW_MACRO(TrackFeatureIds)
+    SIMPL_TYPE_MACRO_SUPER(TrackFeatureIds, AbstractFilter)
+
+    virtual ~TrackFeatureIds();
+
+    //time steps
+    SIMPL_FILTER_PARAMETER(QString, DataContainerPrefix)
+    Q_PROPERTY(QString DataContainerPrefix READ getDataContainerPrefix WRITE setDataContainerPrefix)
+
+    SIMPL_FILTER_PARAMETER(QString, CellAttributeMatrixName)
+    Q_PROPERTY(QString CellAttributeMatrixName READ getCellAttributeMatrixName WRITE setCellAttributeMatrixName)
+
+    SIMPL_FILTER_PARAMETER(QString, CellFeatureAttributeMatrixName)
+    Q_PROPERTY(QString CellFeatureAttributeMatrixName READ getCellFeatureAttributeMatrixName WRITE setCellFeatureAttributeMatrixName)
+
+    SIMPL_FILTER_PARAMETER(QString, CellEnsembleAttributeMatrixName)
+    Q_PROPERTY(QString CellEnsembleAttributeMatrixName READ getCellEnsembleAttributeMatrixName WRITE setCellEnsembleAttributeMatrixName)
+
+    SIMPL_FILTER_PARAMETER(QString, FeatureIdsArrayName)
+    Q_PROPERTY(QString FeatureIdsArrayName READ getFeatureIdsArrayName WRITE setFeatureIdsArrayName)
+
+    //user paramters (forwarded to each matching step)
+    SIMPL_FILTER_PARAMETER(int, Metric)
+    Q_PROPERTY(int Metric READ getMetric WRITE setMetric)
+
+    SIMPL_FILTER_PARAMETER(double, MetricThreshold)
+    Q_PROPERTY(double MetricThreshold READ getMetricThreshold WRITE setMetricThreshold)
+
+    SIMPL_FILTER_PARAMETER(int, MatchingMethod)
+    Q_PROPERTY(int MatchingMethod READ getMatchingMethod WRITE setMatchingMethod)
+
+    SIMPL_FILTER_PARAMETER(bool, UseOrientations)
+    Q_PROPERTY(bool UseOrientations READ getUseOrientations WRITE setUseOrientations)
+
+    SIMPL_FILTER_PARAMETER(double, OrientationTolerance)
+    Q_PROPERTY(double OrientationTolerance READ getOrientationTolerance WRITE setOrientationTolerance)
+
+    SIMPL_FILTER_PARAMETER(QString, QuatsArrayName)
+    Q_PROPERTY(QString QuatsArrayName READ getQuatsArrayName WRITE setQuatsArrayName)
+
+    SIMPL_FILTER_PARAMETER(QString, PhasesArrayName)
+    Q_PROPERTY(QString PhasesArrayName READ getPhasesArrayName WRITE setPhasesArrayName)
+
+    SIMPL_FILTER_PARAMETER(QString, CrystalStructuresArrayName)
+    Q_PROPERTY(QString CrystalStructuresArrayName READ getCrystalStructuresArrayName WRITE setCrystalStructuresArrayName)
+
+    //output array names
+    SIMPL_FILTER_PARAMETER(QString, NewFeaturesArrayName)
+    Q_PROPERTY(QString NewFeaturesArrayName READ getNewFeaturesArrayName WRITE setNewFeaturesArrayName)
+
+    SIMPL_FILTER_PARAMETER(QString, EndingFeaturesArrayName)
+    Q_PROPERTY(QString EndingFeaturesArrayName READ getEndingFeaturesArrayName WRITE setEndingFeaturesArrayName)
+
+    SIMPL_FILTER_PARAMETER(QString, TrackDataContainerName)
+    Q_PROPERTY(QString TrackDataContainerName READ getTrackDataContainerName WRITE setTrackDataContainerName)
+
+    SIMPL_FILTER_PARAMETER(QString, TrackAttributeMatrixName)
+    Q_PROPERTY(QString TrackAttributeMatrixName READ getTrackAttributeMatrixName WRITE setTrackAttributeMatrixName)
+
+    SIMPL_FILTER_PARAMETER(QString, FirstStepArrayName)
+    Q_PROPERTY(QString FirstStepArrayName READ getFirstStepArrayName WRITE setFirstStepArrayName)
+
+    SIMPL_FILTER_PARAMETER(QString, LastStepArrayName)
+    Q_PROPERTY(QString LastStepArrayName READ getLastStepArrayName WRITE setLastStepArrayName)
+
+    SIMPL_FILTER_PARAMETER(QString, StepVolumesArrayName)
+    Q_PROPERTY(QString StepVolumesArrayName READ getStepVolumesArrayName WRITE setStepVolumesArrayName)
+
+    /**
+     * @brief getCompiledLibraryName Reimplemented from @see AbstractFilter class
+     */
+    virtual const QString getCompiledLibraryName();
+
+    /**
+     * @brief newFilterInstance Reimplemented from @see AbstractFilter class
+     */
+    virtual AbstractFilter::Pointer newFilterInstance(bool copyFilterParameters);
+
+    /**
+     * @brief getGroupName Reimplemented from @see AbstractFilter class
+     */
+    virtual const QString getGroupName();
+
+    /**
+     * @brief getSubGroupName Reimplemented from @see AbstractFilter class
+     */
+    virtual const QString getSubGroupName();
+
+    /**
+     * @brief getHumanLabel Reimplemented from @see AbstractFilter class
+     */
+    virtual const QString getHumanLabel();
+
+    /**
+     * @brief setupFilterParameters Reimplemented from @see AbstractFilter class
+     */
+    virtual void setupFilterParameters();
+
+    /**
+     * @brief writeFilterParameters Reimplemented from @see AbstractFilter class
+     */
+    virtual int writeFilterParameters(AbstractFilterParametersWriter* writer, int index);
+
+    /**
+     * @brief readFilterParameters Reimplemented from @see AbstractFilter class
+     */
+    virtual void readFilterParameters(AbstractFilterParametersReader* reader, int index);
+
+   /**
+    * @brief execute Reimplemented from @see AbstractFilter class
+    */
+    virtual void execute();
+
+    /**
+    * @brief preflight Reimplemented from @see AbstractFilter class
+    */
+    virtual void preflight();
+
+  signals:
+    /**
+     * @brief updateFilterParameters Emitted when the Filter requests all the latest Filter parameters
+     * be pushed from a user-facing control (such as a widget)
+     * @param filter Filter instance pointer
+     */
+    void updateFilterParameters(AbstractFilter* filter);
+
+    /**
+     * @brief parametersChanged Emitted when any Filter parameter is changed internally
+     */
+    void parametersChanged();
+
+    /**
+     * @brief preflightAboutToExecute Emitted just before calling dataCheck()
+     */
+    void preflightAboutToExecute();
+
+    /**
+     * @brief preflightExecuted Emitted just after calling dataCheck()
+     */
+    void preflightExecuted();
+
+  protected:
+    TrackFeatureIds();
+
+    /**
+     * @brief dataCheck Checks for the appropriate parameter values and availability of arrays
+     */
+    void dataCheck();
+
+    /**
+     * @brief stepNames Names of the data containers holding the time steps sorted by the number following the prefix
+     */
+    QVector<QString> stepNames();
+
+    /**
+     * @brief createMatcher Creates a MatchFeatureIds filter that renumbers the features of one step to match the previous step
+     * @param reference name of the previous step's data container
+     * @param moving name of the step's data container
+     */
+    MatchFeatureIds::Pointer createMatcher(const QString& reference, const QString& moving);
+
+  private:
+    DEFINE_DATAARRAY_VARIABLE(int32_t, FirstStep)
+    DEFINE_DATAARRAY_VARIABLE(int32_t, LastStep)
+    DEFINE_DATAARRAY_VARIABLE(int64_t, StepVolumes)
+
+    TrackFeatureIds(const TrackFeatureIds&); // Copy Constructor Not Implemented
+    void operator=(const TrackFeatureIds&); // Operator '=' Not Implemented
+};
+
+#endif /* _TrackFeatureIds_H_ */
@@ -0,0 +1,94 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ *                                                                             *
+ * Copyright (c) 2015 William Lenthe                                           *
+ *                                                                             *
+ * This program is free software: you can redistribute it and/or modify        *
+ * it under the terms of the GNU Lesser General Public License as published by *
+ * the Free Software Foundation, either version 3 of the License, or           *
+ * (at your option) any later version.                                         *
+ *                                                                             *
+ * This program is distributed in the hope that it will be useful,             *
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of              *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the               *
+ * GNU Lesser General Public License for more details.                         *
+ *                                                                             *
+ * You should have received a copy of the GNU Lesser General Public License    *
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.       *
+ *                                                                             *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#ifndef _DisplacementGrid_H_
+#define _DisplacementGrid_H_
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+
+/**
+ * @brief The DisplacementGrid class interpolates a displacement field sampled at the cell centers of a coarse image
+ * geometry (3 components per cell, x fastest). Values are interpolated trilinearly between the 8 surrounding cell
+ * centers and held constant beyond the outermost centers, so positions outside the grid take the displacement of
+ * the nearest edge.
+ */
+class DisplacementGrid
+{
+  public:
+    /**
+     * @param displacements 3 * dims[0] * dims[1] * dims[2] displacement values
+     * @param dims number of cells in each direction
+     * @param origin origin of the grid (corner of the first cell)
+     * @param spacing size of each cell
+     */
+    DisplacementGrid(const float* displacements, const size_t dims[3], const float origin[3], const float spacing[3]) :
+      m_Displacements(displacements)
+    {
+      for(size_t i = 0; i < 3; i++)
+      {
+        m_Dims[i] = dims[i];
+        m_Origin[i] = origin[i];
+        m_Spacing[i] = spacing[i];
+      }
+    }
+
+    /**
+     * @brief interpolate Computes the displacement at a position
+     * @param position x, y, z position
+     * @param displacement x, y, z displacement at the position (output)
+     */
+    void interpolate(const float* position, float* displacement) const
+    {
+      size_t lower[3], upper[3];
+      float fraction[3];
+      for(size_t i = 0; i < 3; i++)
+      {
+        //position in units of cells relative to the first cell center, clamped to the outermost centers
+        float u = (position[i] - m_Origin[i]) / m_Spacing[i] - 0.5f;
+        u = std::max(0.0f, std::min(u, static_cast<float>(m_Dims[i] - 1)));
+        lower[i] = std::min(static_cast<size_t>(u), m_Dims[i] - 1);
+        upper[i] = std::min(lower[i] + 1, m_Dims[i] - 1);
+        fraction[i] = u - lower[i];
+      }
+
+      std::fill(displacement, displacement + 3, 0.0f);
+      for(size_t corner = 0; corner < 8; corner++)
+      {
+        const size_t x = (corner & 1) ? upper[0] : lower[0];
+        const size_t y = (corner & 2) ? upper[1] : lower[1];
+        const size_t z = (corner & 4) ? upper[2] : lower[2];
+        const float w = ((corner & 1) ? fraction[0] : 1.0f - fraction[0]) *
+                        ((corner & 2) ? fraction[1] : 1.0f - fraction[1]) *
+                        ((corner & 4) ? fraction[2] : 1.0f - fraction[2]);
+        const float* d = m_Displacements + 3 * ((z * m_Dims[1] + y) * m_Dims[0] + x);
+        for(size_t i = 0; i < 3; i++)
+          displacement[i] += w * d[i];
+      }
+    }
+
+  private:
+    const float* m_Displacements;
+    size_t m_Dims[3];
+    float m_Origin[3];
+    float m_Spacing[3];
+};
+
+#endif /* _DisplacementGrid_H_ */
@@ -0,0 +1,336 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ *                                                                             *
+ * Copyright (c) 2015 William Lenthe                                           *
+ *                                                                             *
+ * This program is free software: you can redistribute it and/or modify        *
+ * it under the terms of the GNU Lesser General Public License as published by *
+ * the Free Software Foundation, either version 3 of the License, or           *
+ * (at your option) any later version.                                         *
+ *                                                                             *
+ * This program is distributed in the hope that it will be useful,             *
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of              *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the               *
+ * GNU Lesser General Public License for more details.                         *
+ *                                                                             *
+ * You should have received a copy of the GNU Lesser General Public License    *
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.       *
+ *                                                                             *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#ifndef _FeatureRelabel_H_
+#define _FeatureRelabel_H_
+
+#include <vector>
+#include <algorithm>
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/DataContainers/AttributeMatrix.h"
+
+#include "DataFusion/DataFusionFilters/util/RowRuns.h"
+
+#ifdef SIMPLib_USE_PARALLEL_ALGORITHMS
+  #include <tbb/parallel_for.h>
+  #include <tbb/blocked_range.h>
+  #include <tbb/partitioner.h>
+#endif
+
+/**
+ * @brief Helpers to renumber features: relabel a feature id array and move feature level data to the new ids.
+ * Id maps are old id -> new id (the same convention as IDataArray::reorderCopy).
+ */
+namespace FeatureRelabel
+{
+  /**
+   * @brief The RelabelImpl class replaces every id with its mapped value (map is stored as int32 so the gather vectorizes)
+   */
+  class RelabelImpl
+  {
+    public:
+      RelabelImpl(int32_t* ids, const int32_t* idMap) : m_Ids(ids), m_IdMap(idMap) {}
+
+      void relabel(size_t start, size_t end) const
+      {
+        int32_t* ids = m_Ids;
+        const int32_t* idMap = m_IdMap;
+        for(size_t i = start; i < end; i++)
+          ids[i] = idMap[ids[i]];
+      }
+
+#ifdef SIMPLib_USE_PARALLEL_ALGORITHMS
+      void operator()(const tbb::blocked_range<size_t>& r) const
+      {
+        relabel(r.begin(), r.end());
+      }
+#endif
+
+    private:
+      int32_t* m_Ids;
+      const int32_t* m_IdMap;
+  };
+
+  /**
+   * @brief relabel Replaces ids[i] with idMap[ids[i]] for all voxels
+   * @param ids feature ids to relabel
+   * @param numPoints number of voxels
+   * @param idMap new id of each old id
+   */
+  inline void relabel(int32_t* ids, size_t numPoints, const std::vector<size_t>& idMap)
+  {
+    std::vector<int32_t> map(idMap.begin(), idMap.end());
+    RelabelImpl impl(ids, map.data());
+#ifdef SIMPLib_USE_PARALLEL_ALGORITHMS
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, numPoints, 16384), impl, tbb::auto_partitioner());
+#else
+    impl.relabel(0, numPoints);
+#endif
+  }
+
+  /**
+   * @brief The RunRelabelImpl class replaces the ids of each run with its mapped value (one map lookup per run instead of per voxel)
+   */
+  class RunRelabelImpl
+  {
+    public:
+      RunRelabelImpl(int32_t* ids, const RowRuns& runs, const int32_t* idMap) : m_Ids(ids), m_Runs(runs), m_IdMap(idMap) {}
+
+      void relabel(size_t start, size_t end) const
+      {
+        const size_t rowLength = m_Runs.rowLength();
+        for(size_t row = start; row < end; row++)
+        {
+          int32_t* ids = m_Ids + row * rowLength;
+          for(const RowRuns::Run* run = m_Runs.rowBegin(row); run != m_Runs.rowEnd(row); ++run)
+            std::fill(ids + run->begin, ids + run->end, m_IdMap[run->id]);
+        }
+      }
+
+#ifdef SIMPLib_USE_PARALLEL_ALGORITHMS
+      void operator()(const tbb::blocked_range<size_t>& r) const
+      {
+        relabel(r.begin(), r.end());
+      }
+#endif
+
+    private:
+      int32_t* m_Ids;
+      const RowRuns& m_Runs;
+      const int32_t* m_IdMap;
+  };
+
+  /**
+   * @brief relabel Replaces ids[i] with idMap[ids[i]] for all voxels using the runs of the ids
+   * @param ids feature ids to relabel (the runs must be an encoding of these ids)
+   * @param runs run length encoding of the ids
+   * @param idMap new id of each old id
+   */
+  inline void relabel(int32_t* ids, const RowRuns& runs, const std::vector<size_t>& idMap)
+  {
+    std::vector<int32_t> map(idMap.begin(), idMap.end());
+    RunRelabelImpl impl(ids, runs, map.data());
+#ifdef SIMPLib_USE_PARALLEL_ALGORITHMS
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, runs.numRows()), impl, tbb::auto_partitioner());
+#else
+    impl.relabel(0, runs.numRows());
+#endif
+  }
+
+  /**
+   * @brief The TuplePermutation class moves tuples of data arrays to new indices in place.
+   * The map may grow the array (new ids that aren't the target of any old id are zero filled). The cycles of the
+   * permutation are found once and then applied to every array, so each array is only read and written once and
+   * no copy of the array is made.
+   */
+  class TuplePermutation
+  {
+    public:
+      /**
+       * @param newIndex new index of each old tuple (must be unique)
+       * @param numTuples number of tuples after the permutation (at least newIndex.size())
+       */
+      TuplePermutation(const std::vector<size_t>& newIndex, size_t numTuples) :
+        m_FullMap(numTuples),
+        m_Holes(numTuples, false)
+      {
+        // targets that no old tuple moves to are holes, fill them with the (new) tuples past the end of the old array
+        std::vector<bool> targeted(numTuples, false);
+        for(size_t i = 0; i < newIndex.size(); i++)
+        {
+          m_FullMap[i] = newIndex[i];
+          targeted[newIndex[i]] = true;
+        }
+        size_t nextHole = 0;
+        for(size_t i = newIndex.size(); i < numTuples; i++)
+        {
+          while(targeted[nextHole]) nextHole++;
+          m_FullMap[i] = nextHole;
+          m_Holes[nextHole] = true;
+          targeted[nextHole] = true;
+        }
+
+        // flatten cycles of length > 1 (each cycle is stored as start index followed by the rest of the cycle)
+        std::vector<bool> visited(numTuples, false);
+        m_CycleOffsets.push_back(0);
+        for(size_t i = 0; i < numTuples; i++)
+        {
+          if(visited[i] || m_FullMap[i] == i) continue;
+          for(size_t j = i; !visited[j]; j = m_FullMap[j])
+          {
+            visited[j] = true;
+            m_Cycles.push_back(j);
+          }
+          m_CycleOffsets.push_back(m_Cycles.size());
+        }
+      }
+
+      /**
+       * @brief apply Permutes the tuples of a typed data array in place
+       * @return false if the array isn't a supported DataArray type (use reorderCopy with fullMap() instead)
+       */
+      bool apply(IDataArray::Pointer array) const
+      {
+        QString typeName = array->getTypeAsString();
+        if (typeName.compare("int8_t") == 0) {
+          return permute<int8_t>(array);
+        } else if (typeName.compare("uint8_t") == 0) {
+          return permute<uint8_t>(array);
+        } else if (typeName.compare("int16_t") == 0) {
+          return permute<int16_t>(array);
+        } else if (typeName.compare("uint16_t") == 0) {
+          return permute<uint16_t>(array);
+        } else if (typeName.compare("int32_t") == 0) {
+          return permute<int32_t>(array);
+        } else if (typeName.compare("uint32_t") == 0) {
+          return permute<uint32_t>(array);
+        } else if (typeName.compare("int64_t") == 0) {
+          return permute<int64_t>(array);
+        } else if (typeName.compare("uint64_t") == 0) {
+          return permute<uint64_t>(array);
+        } else if (typeName.compare("float") == 0) {
+          return permute<float>(array);
+        } else if (typeName.compare("double") == 0) {
+          return permute<double>(array);
+        } else if (typeName.compare("bool") == 0) {
+          return permute<bool>(array);
+        }
+        return false;
+      }
+
+      /**
+       * @brief fullMap new index of every tuple (including the tuples that fill holes) for IDataArray::reorderCopy
+       */
+      QVector<size_t> fullMap() const {return QVector<size_t>::fromStdVector(m_FullMap);}
+
+    private:
+      template<typename T>
+      bool permute(IDataArray::Pointer array) const
+      {
+        //the type string alone doesn't distinguish data arrays from neighbor lists
+        DataArray<T>* typedArray = DataArray<T>::SafePointerDownCast(array.get());
+        if(NULL == typedArray || typedArray->getNumberOfTuples() != m_FullMap.size()) return false;
+        const size_t numComp = typedArray->getNumberOfComponents();
+        T* data = typedArray->getPointer(0);
+
+        // follow each cycle carrying the displaced tuple
+        QVector<T> carry(numComp);
+        for(size_t c = 0; c + 1 < m_CycleOffsets.size(); c++)
+        {
+          size_t start = m_Cycles[m_CycleOffsets[c]];
+          for(size_t k = 0; k < numComp; k++)
+            carry[k] = data[start * numComp + k];
+          for(size_t j = m_FullMap[start]; j != start; j = m_FullMap[j])
+          {
+            for(size_t k = 0; k < numComp; k++)
+              std::swap(carry[k], data[j * numComp + k]);
+          }
+          for(size_t k = 0; k < numComp; k++)
+            data[start * numComp + k] = carry[k];
+        }
+
+        // features without data
+        for(size_t i = 0; i < m_Holes.size(); i++)
+        {
+          if(m_Holes[i])
+          {
+            for(size_t k = 0; k < numComp; k++)
+              data[i * numComp + k] = static_cast<T>(0);
+          }
+        }
+        return true;
+      }
+
+      std::vector<size_t> m_FullMap;
+      std::vector<bool> m_Holes;
+      std::vector<size_t> m_Cycles;
+      std::vector<size_t> m_CycleOffsets;
+  };
+
+  /**
+   * @brief The PermuteArraysImpl class permutes a list of arrays (one array per task)
+   */
+  class PermuteArraysImpl
+  {
+    public:
+      PermuteArraysImpl(const TuplePermutation& permutation, const QVector<IDataArray::Pointer>& arrays, std::vector<char>& permuted) :
+        m_Permutation(permutation),
+        m_Arrays(arrays),
+        m_Permuted(permuted)
+      {}
+
+      void permute(size_t start, size_t end) const
+      {
+        for(size_t i = start; i < end; i++)
+          m_Permuted[i] = m_Permutation.apply(m_Arrays[i]) ? 1 : 0;
+      }
+
+#ifdef SIMPLib_USE_PARALLEL_ALGORITHMS
+      void operator()(const tbb::blocked_range<size_t>& r) const
+      {
+        permute(r.begin(), r.end());
+      }
+#endif
+
+    private:
+      const TuplePermutation& m_Permutation;
+      const QVector<IDataArray::Pointer>& m_Arrays;
+      std::vector<char>& m_Permuted;
+  };
+
+  /**
+   * @brief reorderFeatures Resizes a feature attribute matrix and moves every feature to its new id
+   * (typed arrays are permuted in place in parallel, other arrays fall back to reorderCopy)
+   * @param featureAttrMat feature attribute matrix
+   * @param idMap new id of each old feature (must be unique)
+   * @param numFeatures number of features after renumbering
+   */
+  inline void reorderFeatures(AttributeMatrix::Pointer featureAttrMat, const std::vector<size_t>& idMap, size_t numFeatures)
+  {
+    QVector<size_t> tDims(1, numFeatures);
+    featureAttrMat->setTupleDimensions(tDims);
+
+    QList<QString> featureArrayNames = featureAttrMat->getAttributeArrayNames();
+    QVector<IDataArray::Pointer> arrays;
+    for(QList<QString>::iterator iter = featureArrayNames.begin(); iter != featureArrayNames.end(); ++iter)
+      arrays.push_back(featureAttrMat->getAttributeArray(*iter));
+
+    TuplePermutation permutation(idMap, numFeatures);
+    std::vector<char> permuted(arrays.size(), 0);
+    PermuteArraysImpl impl(permutation, arrays, permuted);
+#ifdef SIMPLib_USE_PARALLEL_ALGORITHMS
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, arrays.size(), 1), impl, tbb::auto_partitioner());
+#else
+    impl.permute(0, arrays.size());
+#endif
+
+    // arrays without direct element access (neighbor lists, strings)
+    for(int i = 0; i < arrays.size(); i++)
+    {
+      if(permuted[i]) continue;
+      IDataArray::Pointer pNew = arrays[i]->reorderCopy(permutation.fullMap());
+      featureAttrMat->removeAttributeArray(arrays[i]->getName());
+      featureAttrMat->addAttributeArray(pNew->getName(), pNew);
+    }
+  }
+}
+
+#endif /* _FeatureRelabel_H_ */
@@ -0,0 +1,228 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ *                                                                             *
+ * Copyright (c) 2015 William Lenthe                                           *
+ *                                                                             *
+ * This program is free software: you can redistribute it and/or modify        *
+ * it under the terms of the GNU Lesser General Public License as published by *
+ * the Free Software Foundation, either version 3 of the License, or           *
+ * (at your option) any later version.                                         *
+ *                                                                             *
+ * This program is distributed in the hope that it will be useful,             *
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of              *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the               *
+ * GNU Lesser General Public License for more details.                         *
+ *                                                                             *
+ * You should have received a copy of the GNU Lesser General Public License    *
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.       *
+ *                                                                             *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#ifndef _H5SlabStream_H_
+#define _H5SlabStream_H_
+
+#include <vector>
+
+#include <hdf5.h>
+
+#include <QtCore/QString>
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/Common/Constants.h"
+#include "SIMPLib/DataContainers/DataArrayPath.h"
+
+/**
+ * @brief The H5SlabStream class reads and writes an int32 cell array of a .dream3d file a slab (range of z slices) at a
+ * time using hyperslab selections so the whole array never needs to be in memory. Cell arrays are stored slowest
+ * dimension first ([z][y][x][component]) so a slab is a contiguous block of the dataset.
+ * Rewriting an array goes through a temporary dataset that only replaces the array once every slab has been written,
+ * so a failure part way through leaves the original values intact. HDF5 doesn't reclaim the space of the replaced array
+ * (the file grows by the size of the array on every rewrite until it is repacked with h5repack), callers that can accept
+ * partially written values should write() slabs directly to the array instead.
+ */
+class H5SlabStream
+{
+  public:
+    H5SlabStream() : m_FileId(-1), m_DatasetId(-1), m_TargetId(-1), m_NumSlices(0), m_SliceSize(0) {}
+    ~H5SlabStream() { close(); }
+
+    /**
+     * @brief datasetPath Path of a data array inside a .dream3d file
+     */
+    static QString datasetPath(const DataArrayPath& path)
+    {
+      return QString("/%1/%2/%3/%4").arg(DREAM3D::StringConstants::DataContainerGroupName).arg(path.getDataContainerName()).arg(path.getAttributeMatrixName()).arg(path.getDataArrayName());
+    }
+
+    /**
+     * @brief open Opens a dataset of an open file
+     * @return false if the dataset doesn't exist, is empty, or isn't stored as 32 bit signed integers (slabs are transferred as raw int32)
+     */
+    bool open(hid_t fileId, const QString& path)
+    {
+      close();
+      if(H5Lexists(fileId, path.toLatin1().data(), H5P_DEFAULT) <= 0) return false;
+      m_DatasetId = H5Dopen(fileId, path.toLatin1().data(), H5P_DEFAULT);
+      if(m_DatasetId < 0) return false;
+      m_FileId = fileId;
+      m_Path = path;
+
+      hid_t type = H5Dget_type(m_DatasetId);
+      bool isInt32 = H5T_INTEGER == H5Tget_class(type) && 4 == H5Tget_size(type) && H5T_SGN_2 == H5Tget_sign(type);
+      H5Tclose(type);
+      if(!isInt32)
+      {
+        close();
+        return false;
+      }
+
+      hid_t space = H5Dget_space(m_DatasetId);
+      int rank = H5Sget_simple_extent_ndims(space);
+      if(rank > 0)
+      {
+        m_Dims.resize(rank);
+        H5Sget_simple_extent_dims(space, &m_Dims[0], NULL);
+      }
+      H5Sclose(space);
+      if(rank <= 0) return false;
+
+      m_NumSlices = m_Dims[0];
+      m_SliceSize = 1;
+      for(int i = 1; i < rank; i++)
+        m_SliceSize *= m_Dims[i];
+      return m_NumSlices * m_SliceSize > 0;
+    }
+
+    void close()
+    {
+      discardRewrite();
+      if(m_DatasetId >= 0) H5Dclose(m_DatasetId);
+      m_DatasetId = -1;
+      m_FileId = -1;
+    }
+
+    const std::vector<hsize_t>& dimensions() const {return m_Dims;}
+    size_t numSlices() const {return m_NumSlices;}
+    size_t sliceSize() const {return m_SliceSize;}
+
+    /**
+     * @brief temporaryPath Path of the dataset that holds a rewrite until it is committed
+     */
+    QString temporaryPath() const {return m_Path + "_Temp";}
+
+    /**
+     * @brief read Reads slices [start, start + count) into buffer (which must hold count * sliceSize() values)
+     */
+    bool read(size_t start, size_t count, int32_t* buffer) {return transfer(m_DatasetId, start, count, buffer, false);}
+
+    /**
+     * @brief write Writes slices [start, start + count) from buffer (to the temporary dataset during a rewrite)
+     */
+    bool write(size_t start, size_t count, int32_t* buffer) {return transfer(m_TargetId >= 0 ? m_TargetId : m_DatasetId, start, count, buffer, true);}
+
+    /**
+     * @brief beginRewrite Creates a temporary dataset (same type, shape, and creation properties as the array) that
+     * receives all writes until commitRewrite() or discardRewrite() is called, reads still come from the array
+     */
+    bool beginRewrite()
+    {
+      if(m_DatasetId < 0 || m_TargetId >= 0) return false;
+      QByteArray temporary = temporaryPath().toLatin1();
+      if(H5Lexists(m_FileId, temporary.data(), H5P_DEFAULT) > 0 && H5Ldelete(m_FileId, temporary.data(), H5P_DEFAULT) < 0) return false;
+      hid_t type = H5Dget_type(m_DatasetId);
+      hid_t space = H5Dget_space(m_DatasetId);
+      hid_t createProperties = H5Dget_create_plist(m_DatasetId);
+      m_TargetId = H5Dcreate(m_FileId, temporary.data(), type, space, H5P_DEFAULT, createProperties, H5P_DEFAULT);
+      H5Pclose(createProperties);
+      H5Sclose(space);
+      H5Tclose(type);
+      return m_TargetId >= 0;
+    }
+
+    /**
+     * @brief commitRewrite Copies the attributes of the array to the temporary dataset and replaces the array with it
+     * @return false if the array couldn't be replaced (the temporary dataset is removed if the array is still intact)
+     */
+    bool commitRewrite()
+    {
+      if(m_TargetId < 0) return false;
+      if(H5Aiterate(m_DatasetId, H5_INDEX_NAME, H5_ITER_INC, NULL, CopyAttribute, &m_TargetId) < 0)
+      {
+        discardRewrite();
+        return false;
+      }
+      H5Dclose(m_TargetId);
+      m_TargetId = -1;
+      H5Dclose(m_DatasetId);
+      m_DatasetId = -1;
+
+      // the array is only unlinked once the temporary dataset is complete, if the move fails the new values stay at temporaryPath()
+      QByteArray path = m_Path.toLatin1();
+      QByteArray temporary = temporaryPath().toLatin1();
+      if(H5Ldelete(m_FileId, path.data(), H5P_DEFAULT) < 0 || H5Lmove(m_FileId, temporary.data(), m_FileId, path.data(), H5P_DEFAULT, H5P_DEFAULT) < 0) return false;
+      m_DatasetId = H5Dopen(m_FileId, path.data(), H5P_DEFAULT);
+      return m_DatasetId >= 0;
+    }
+
+    /**
+     * @brief discardRewrite Removes the temporary dataset of an unfinished rewrite (the array is unchanged)
+     */
+    void discardRewrite()
+    {
+      if(m_TargetId < 0) return;
+      H5Dclose(m_TargetId);
+      m_TargetId = -1;
+      H5Ldelete(m_FileId, temporaryPath().toLatin1().data(), H5P_DEFAULT);
+    }
+
+  private:
+    bool transfer(hid_t datasetId, size_t start, size_t count, int32_t* buffer, bool write)
+    {
+      if(datasetId < 0 || start + count > m_NumSlices) return false;
+      std::vector<hsize_t> offset(m_Dims.size(), 0), extent(m_Dims);
+      offset[0] = start;
+      extent[0] = count;
+
+      hid_t fileSpace = H5Dget_space(datasetId);
+      H5Sselect_hyperslab(fileSpace, H5S_SELECT_SET, &offset[0], NULL, &extent[0], NULL);
+      hid_t memSpace = H5Screate_simple(static_cast<int>(extent.size()), &extent[0], NULL);
+      herr_t err = write ? H5Dwrite(datasetId, H5T_NATIVE_INT32, memSpace, fileSpace, H5P_DEFAULT, buffer) : H5Dread(datasetId, H5T_NATIVE_INT32, memSpace, fileSpace, H5P_DEFAULT, buffer);
+      H5Sclose(memSpace);
+      H5Sclose(fileSpace);
+      return err >= 0;
+    }
+
+    // H5Aiterate callback copying one attribute (DREAM3D array attributes are fixed size) to the dataset pointed to by data
+    static herr_t CopyAttribute(hid_t locationId, const char* name, const H5A_info_t* info, void* data)
+    {
+      hid_t targetId = *static_cast<hid_t*>(data);
+      hid_t sourceAttribute = H5Aopen(locationId, name, H5P_DEFAULT);
+      if(sourceAttribute < 0) return -1;
+      hid_t type = H5Aget_type(sourceAttribute);
+      hid_t space = H5Aget_space(sourceAttribute);
+      std::vector<char> buffer(info->data_size + 1, 0);
+      herr_t err = H5Aread(sourceAttribute, type, &buffer[0]);
+      if(err >= 0)
+      {
+        hid_t targetAttribute = H5Acreate(targetId, name, type, space, H5P_DEFAULT, H5P_DEFAULT);
+        err = targetAttribute < 0 ? -1 : H5Awrite(targetAttribute, type, &buffer[0]);
+        if(targetAttribute >= 0) H5Aclose(targetAttribute);
+      }
+      H5Sclose(space);
+      H5Tclose(type);
+      H5Aclose(sourceAttribute);
+      return err < 0 ? -1 : 0;
+    }
+
+    hid_t m_FileId;
+    hid_t m_DatasetId;
+    hid_t m_TargetId;
+    QString m_Path;
+    std::vector<hsize_t> m_Dims;
+    size_t m_NumSlices;
+    size_t m_SliceSize;
+
+    H5SlabStream(const H5SlabStream&); // Copy Constructor Not Implemented
+    void operator=(const H5SlabStream&); // Operator '=' Not Implemented
+};
+
+#endif /* _H5SlabStream_H_ */
@@ -0,0 +1,237 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ *                                                                             *
+ * Copyright (c) 2015 William Lenthe                                           *
+ *                                                                             *
+ * This program is free software: you can redistribute it and/or modify        *
+ * it under the terms of the GNU Lesser General Public License as published by *
+ * the Free Software Foundation, either version 3 of the License, or           *
+ * (at your option) any later version.                                         *
+ *                                                                             *
+ * This program is distributed in the hope that it will be useful,             *
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of              *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the               *
+ * GNU Lesser General Public License for more details.                         *
+ *                                                                             *
+ * You should have received a copy of the GNU Lesser General Public License    *
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.       *
+ *                                                                             *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#ifndef _KdTree_H_
+#define _KdTree_H_
+
+#include <vector>
+#include <algorithm>
+#include <limits>
+#include <utility>
+
+/**
+ * @brief The KdTree class is a static k-d tree over a set of points with a runtime number of dimensions (3 for
+ * centroids, more for feature descriptors). Points are copied into leaf order so queries touch contiguous memory.
+ * Queries are const and can be made from many threads at once.
+ */
+template<typename T>
+class KdTree
+{
+  public:
+    /**
+     * @param points coordinates of the points (numPoints * dims values)
+     * @param numPoints number of points
+     * @param dims number of dimensions
+     * @param leafSize maximum number of points in a leaf
+     */
+    KdTree(const T* points, size_t numPoints, size_t dims, size_t leafSize = 8) :
+      m_Dims(dims),
+      m_LeafSize(std::max<size_t>(leafSize, 1)),
+      m_Indices(numPoints)
+    {
+      for(size_t i = 0; i < numPoints; i++)
+        m_Indices[i] = i;
+      if(numPoints > 0)
+        build(points, 0, numPoints);
+
+      // store points in tree order
+      m_Points.resize(numPoints * m_Dims);
+      for(size_t i = 0; i < numPoints; i++)
+        std::copy(points + m_Indices[i] * m_Dims, points + (m_Indices[i] + 1) * m_Dims, m_Points.begin() + i * m_Dims);
+    }
+
+    size_t size() const {return m_Indices.size();}
+    size_t dimensions() const {return m_Dims;}
+
+    /**
+     * @brief nearest Finds the closest point to a query
+     * @param query query point (dims values)
+     * @param distance2 squared distance to the closest point
+     * @return index of the closest point (or size() if the tree is empty)
+     */
+    size_t nearest(const T* query, T& distance2) const
+    {
+      std::vector< std::pair<T, size_t> > result;
+      kNearest(query, 1, result);
+      if(result.empty())
+      {
+        distance2 = std::numeric_limits<T>::max();
+        return size();
+      }
+      distance2 = result[0].first;
+      return result[0].second;
+    }
+
+    /**
+     * @brief kNearest Finds the k closest points to a query
+     * @param query query point (dims values)
+     * @param k number of neighbors
+     * @param result (squared distance, index) of the neighbors sorted by distance
+     */
+    void kNearest(const T* query, size_t k, std::vector< std::pair<T, size_t> >& result) const
+    {
+      result.clear();
+      if(m_Nodes.empty() || 0 == k) return;
+      kNearest(0, query, k, result);//result is kept as a max heap while searching
+      std::sort_heap(result.begin(), result.end());
+    }
+
+    /**
+     * @brief radiusSearch Finds all points within a distance of a query
+     * @param query query point (dims values)
+     * @param radius search radius
+     * @param result (squared distance, index) of the points found (unordered)
+     */
+    void radiusSearch(const T* query, T radius, std::vector< std::pair<T, size_t> >& result) const
+    {
+      result.clear();
+      if(m_Nodes.empty()) return;
+      radiusSearch(0, query, radius * radius, result);
+    }
+
+  private:
+    struct Node
+    {
+      size_t begin, end;//range of points (leaf) or all points below node
+      size_t left, right;//child nodes (0 for leaves)
+      size_t splitDim;
+      T splitValue;
+    };
+
+    class DimensionCompare
+    {
+      public:
+        DimensionCompare(const T* points, size_t dims, size_t dim) : m_Points(points), m_Dims(dims), m_Dim(dim) {}
+        bool operator()(size_t i, size_t j) const {return m_Points[i * m_Dims + m_Dim] < m_Points[j * m_Dims + m_Dim];}
+
+      private:
+        const T* m_Points;
+        size_t m_Dims, m_Dim;
+    };
+
+    // recursively splits points at the median of the dimension with the largest extent
+    size_t build(const T* points, size_t begin, size_t end)
+    {
+      size_t nodeIndex = m_Nodes.size();
+      Node node;
+      node.begin = begin;
+      node.end = end;
+      node.left = node.right = 0;
+      node.splitDim = 0;
+      node.splitValue = 0;
+      m_Nodes.push_back(node);
+      if(end - begin <= m_LeafSize) return nodeIndex;
+
+      T maxExtent = -1;
+      for(size_t d = 0; d < m_Dims; d++)
+      {
+        T minVal = std::numeric_limits<T>::max(), maxVal = -std::numeric_limits<T>::max();
+        for(size_t i = begin; i < end; i++)
+        {
+          T value = points[m_Indices[i] * m_Dims + d];
+          minVal = std::min(minVal, value);
+          maxVal = std::max(maxVal, value);
+        }
+        if(maxVal - minVal > maxExtent)
+        {
+          maxExtent = maxVal - minVal;
+          node.splitDim = d;
+        }
+      }
+      if(maxExtent <= 0) return nodeIndex;//all points are identical
+
+      size_t middle = begin + (end - begin) / 2;
+      std::nth_element(m_Indices.begin() + begin, m_Indices.begin() + middle, m_Indices.begin() + end, DimensionCompare(points, m_Dims, node.splitDim));
+      node.splitValue = points[m_Indices[middle] * m_Dims + node.splitDim];
+      node.left = build(points, begin, middle);
+      node.right = build(points, middle, end);
+      m_Nodes[nodeIndex].left = node.left;
+      m_Nodes[nodeIndex].right = node.right;
+      m_Nodes[nodeIndex].splitDim = node.splitDim;
+      m_Nodes[nodeIndex].splitValue = node.splitValue;
+      return nodeIndex;
+    }
+
+    T distance2(const T* query, size_t i) const
+    {
+      const T* point = &m_Points[i * m_Dims];
+      T dist = 0;
+      for(size_t d = 0; d < m_Dims; d++)
+        dist += (query[d] - point[d]) * (query[d] - point[d]);
+      return dist;
+    }
+
+    void kNearest(size_t nodeIndex, const T* query, size_t k, std::vector< std::pair<T, size_t> >& heap) const
+    {
+      const Node& node = m_Nodes[nodeIndex];
+      if(0 == node.left)
+      {
+        for(size_t i = node.begin; i < node.end; i++)
+        {
+          T dist = distance2(query, i);
+          if(heap.size() < k)
+          {
+            heap.push_back(std::make_pair(dist, m_Indices[i]));
+            std::push_heap(heap.begin(), heap.end());
+          }
+          else if(dist < heap.front().first)
+          {
+            std::pop_heap(heap.begin(), heap.end());
+            heap.back() = std::make_pair(dist, m_Indices[i]);
+            std::push_heap(heap.begin(), heap.end());
+          }
+        }
+        return;
+      }
+
+      // search the side containing the query first, then the other side only if it could hold a closer point
+      T delta = query[node.splitDim] - node.splitValue;
+      size_t nearChild = delta < 0 ? node.left : node.right;
+      size_t farChild = delta < 0 ? node.right : node.left;
+      kNearest(nearChild, query, k, heap);
+      if(heap.size() < k || delta * delta < heap.front().first)
+        kNearest(farChild, query, k, heap);
+    }
+
+    void radiusSearch(size_t nodeIndex, const T* query, T radius2, std::vector< std::pair<T, size_t> >& result) const
+    {
+      const Node& node = m_Nodes[nodeIndex];
+      if(0 == node.left)
+      {
+        for(size_t i = node.begin; i < node.end; i++)
+        {
+          T dist = distance2(query, i);
+          if(dist <= radius2) result.push_back(std::make_pair(dist, m_Indices[i]));
+        }
+        return;
+      }
+
+      T delta = query[node.splitDim] - node.splitValue;
+      if(delta < 0 || delta * delta <= radius2) radiusSearch(node.left, query, radius2, result);
+      if(delta >= 0 || delta * delta <= radius2) radiusSearch(node.right, query, radius2, result);
+    }
+
+    size_t m_Dims;
+    size_t m_LeafSize;
+    std::vector<size_t> m_Indices;//original index of each point in tree order
+    std::vector<T> m_Points;//points in tree order
+    std::vector<Node> m_Nodes;
+};
+
+#endif /* _KdTree_H_ */
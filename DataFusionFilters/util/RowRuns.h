@@ -0,0 +1,199 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ *                                                                             *
+ * Copyright (c) 2015 William Lenthe                                           *
+ *                                                                             *
+ * This program is free software: you can redistribute it and/or modify        *
+ * it under the terms of the GNU Lesser General Public License as published by *
+ * the Free Software Foundation, either version 3 of the License, or           *
+ * (at your option) any later version.                                         *
+ *                                                                             *
+ * This program is distributed in the hope that it will be useful,             *
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of              *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the               *
+ * GNU Lesser General Public License for more details.                         *
+ *                                                                             *
+ * You should have received a copy of the GNU Lesser General Public License    *
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.       *
+ *                                                                             *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#ifndef _RowRuns_H_
+#define _RowRuns_H_
+
+#include <algorithm>
+#include <vector>
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/Geometry/ImageGeom.h"
+
+#ifdef SIMPLib_USE_PARALLEL_ALGORITHMS
+  #include <tbb/parallel_for.h>
+  #include <tbb/blocked_range.h>
+  #include <tbb/partitioner.h>
+#endif
+
+/**
+ * @brief The RowRuns class is a run length encoding of the rows (along x) of a feature id volume. Feature ids are dominated
+ * by long runs of the same id, so passes that only need each id once per run (overlap, bounding boxes, relabeling) can work
+ * on runs instead of voxels. Rows are encoded independently (count runs, prefix sum, fill) so both passes run in parallel.
+ * Run bounds are stored relative to their row as int64 so rows of any length can be encoded, a run takes 24 bytes and the
+ * encoding is smaller than the ids once runs average more than 6 voxels.
+ */
+class RowRuns
+{
+  public:
+    struct Run
+    {
+      int64_t begin;
+      int64_t end;
+      int32_t id;
+
+      // ordered by id then position so runs of the same id can be merged
+      const bool operator< (const Run& other) const
+      {
+        if(id != other.id) return id < other.id;
+        return begin < other.begin;
+      }
+    };
+
+    /**
+     * @brief GridDimensions Finds the rows to encode a cell array with
+     * @param image geometry of the cells (may be NULL)
+     * @param numCells number of cells
+     * @param dims filled with the image dimensions if they match the number of cells, otherwise every cell is put in a single row
+     * @return true if the dimensions come from the image, a single row can only be processed serially so callers should use per voxel
+     * passes that split the cells instead of encoding runs when this is false
+     */
+    static bool GridDimensions(ImageGeom::Pointer image, size_t numCells, size_t dims[3])
+    {
+      dims[0] = numCells;
+      dims[1] = 1;
+      dims[2] = 1;
+      if(NULL == image.get()) return false;
+      size_t imageDims[3] = { 0, 0, 0 };
+      image->getDimensions(imageDims);
+      if(imageDims[0] * imageDims[1] * imageDims[2] != numCells) return false;
+      std::copy(imageDims, imageDims + 3, dims);
+      return true;
+    }
+
+    RowRuns() :
+      m_RowLength(0),
+      m_Offsets(1, 0)
+    {}
+
+    /**
+     * @param ids feature ids (rowLength * numRows values)
+     * @param rowLength number of voxels in each row
+     * @param numRows number of rows
+     */
+    RowRuns(const int32_t* ids, size_t rowLength, size_t numRows)
+    {
+      encode(ids, rowLength, numRows);
+    }
+
+    /**
+     * @brief encode Replaces the runs with the runs of a new volume
+     */
+    void encode(const int32_t* ids, size_t rowLength, size_t numRows)
+    {
+      m_RowLength = rowLength;
+      m_Offsets.assign(numRows + 1, 0);
+      EncodeImpl counter(ids, this, false);
+#ifdef SIMPLib_USE_PARALLEL_ALGORITHMS
+      tbb::parallel_for(tbb::blocked_range<size_t>(0, numRows), counter, tbb::auto_partitioner());
+#else
+      counter.encode(0, numRows);
+#endif
+      for(size_t i = 0; i < numRows; i++)
+        m_Offsets[i + 1] += m_Offsets[i];
+      m_Runs.resize(m_Offsets[numRows]);
+
+      EncodeImpl writer(ids, this, true);
+#ifdef SIMPLib_USE_PARALLEL_ALGORITHMS
+      tbb::parallel_for(tbb::blocked_range<size_t>(0, numRows), writer, tbb::auto_partitioner());
+#else
+      writer.encode(0, numRows);
+#endif
+    }
+
+    /**
+     * @brief relabel Replaces the id of every run (ids must be renumbered one to one so runs stay maximal)
+     * @param idMap map from current to new ids
+     */
+    void relabel(const std::vector<size_t>& idMap)
+    {
+      for(size_t i = 0; i < m_Runs.size(); i++)
+        m_Runs[i].id = static_cast<int32_t>(idMap[m_Runs[i].id]);
+    }
+
+    /**
+     * @brief volumes Counts the voxels of each feature from the run lengths (feature 0 isn't counted)
+     * @param numIds one more than the largest id
+     */
+    std::vector<int64_t> volumes(size_t numIds) const
+    {
+      std::vector<int64_t> counts(numIds, 0);
+      for(size_t i = 0; i < m_Runs.size(); i++)
+        if(m_Runs[i].id > 0 && static_cast<size_t>(m_Runs[i].id) < numIds) counts[m_Runs[i].id] += m_Runs[i].end - m_Runs[i].begin;
+      return counts;
+    }
+
+    size_t rowLength() const {return m_RowLength;}
+    size_t numRows() const {return m_Offsets.size() - 1;}
+    size_t numRuns() const {return m_Runs.size();}
+    const Run* rowBegin(size_t row) const {return m_Runs.data() + m_Offsets[row];}
+    const Run* rowEnd(size_t row) const {return m_Runs.data() + m_Offsets[row + 1];}
+
+  private:
+    // counts the runs of each row (first pass) or writes them at the row's offset (second pass)
+    class EncodeImpl
+    {
+      public:
+        EncodeImpl(const int32_t* ids, RowRuns* owner, bool write) : m_Ids(ids), m_Owner(owner), m_Write(write) {}
+
+        void encode(size_t start, size_t end) const
+        {
+          const size_t rowLength = m_Owner->m_RowLength;
+          for(size_t row = start; row < end; row++)
+          {
+            const int32_t* ids = m_Ids + row * rowLength;
+            Run* runs = m_Write ? &m_Owner->m_Runs[0] + m_Owner->m_Offsets[row] : NULL;
+            size_t numRuns = 0;
+            size_t x = 0;
+            while(x < rowLength)
+            {
+              size_t runEnd = x + 1;
+              while(runEnd < rowLength && ids[runEnd] == ids[x]) runEnd++;
+              if(m_Write)
+              {
+                runs[numRuns].id = ids[x];
+                runs[numRuns].begin = static_cast<int64_t>(x);
+                runs[numRuns].end = static_cast<int64_t>(runEnd);
+              }
+              numRuns++;
+              x = runEnd;
+            }
+            if(!m_Write) m_Owner->m_Offsets[row + 1] = numRuns;
+          }
+        }
+
+#ifdef SIMPLib_USE_PARALLEL_ALGORITHMS
+        void operator()(const tbb::blocked_range<size_t>& r) const
+        {
+          encode(r.begin(), r.end());
+        }
+#endif
+
+      private:
+        const int32_t* m_Ids;
+        RowRuns* m_Owner;
+        bool m_Write;
+    };
+
+    size_t m_RowLength;
+    std::vector<size_t> m_Offsets;
+    std::vector<Run> m_Runs;
+};
+
+#endif /* _RowRuns_H_ */
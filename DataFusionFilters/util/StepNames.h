@@ -0,0 +1,90 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ *                                                                             *
+ * Copyright (c) 2015 William Lenthe                                           *
+ *                                                                             *
+ * This program is free software: you can redistribute it and/or modify        *
+ * it under the terms of the GNU Lesser General Public License as published by *
+ * the Free Software Foundation, either version 3 of the License, or           *
+ * (at your option) any later version.                                         *
+ *                                                                             *
+ * This program is distributed in the hope that it will be useful,             *
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of              *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the               *
+ * GNU Lesser General Public License for more details.                         *
+ *                                                                             *
+ * You should have received a copy of the GNU Lesser General Public License    *
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.       *
+ *                                                                             *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+#ifndef _StepNames_H_
+#define _StepNames_H_
+
+#include <vector>
+#include <algorithm>
+
+#include <QtCore/QString>
+#include <QtCore/QVector>
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/DataContainers/DataContainerArray.h"
+
+/**
+ * @brief Helpers to find the data containers making up a series (time steps, sections, tiles) from a common name prefix.
+ * Steps are ordered by the number following the prefix (Step2 before Step10) so the order doesn't depend on the order
+ * the data containers were created or read in.
+ */
+namespace StepNames
+{
+  /**
+   * @brief The Step struct holds a step name and the number parsed from the text following the prefix
+   */
+  struct Step
+  {
+    QString name;
+    qlonglong number;
+    bool numeric;
+  };
+
+  /**
+   * @brief StepLess orders numbered steps by number, then steps without a number, breaking ties by name
+   */
+  struct StepLess
+  {
+    bool operator()(const Step& a, const Step& b) const
+    {
+      if(a.numeric != b.numeric) return a.numeric;
+      if(a.numeric && a.number != b.number) return a.number < b.number;
+      return a.name < b.name;
+    }
+  };
+
+  /**
+   * @brief find Names of the data containers starting with a prefix, sorted by the number following the prefix
+   * @param dca data container array to search
+   * @param prefix common prefix of the step names
+   * @param exclude name to skip even if it starts with the prefix (e.g. an output data container)
+   * @return sorted step names
+   */
+  inline QVector<QString> find(DataContainerArray::Pointer dca, const QString& prefix, const QString& exclude = QString())
+  {
+    std::vector<Step> steps;
+    QList<QString> dcNames = dca->getDataContainerNames();
+    for(QList<QString>::iterator iter = dcNames.begin(); iter != dcNames.end(); ++iter)
+    {
+      if(!iter->startsWith(prefix) || (!exclude.isEmpty() && *iter == exclude)) continue;
+      Step step;
+      step.name = *iter;
+      step.number = iter->mid(prefix.size()).trimmed().toLongLong(&step.numeric);
+      steps.push_back(step);
+    }
+    std::sort(steps.begin(), steps.end(), StepLess());
+
+    QVector<QString> names;
+    names.reserve(static_cast<int>(steps.size()));
+    for(size_t i = 0; i < steps.size(); i++)
+      names.push_back(steps[i].name);
+    return names;
+  }
+}
+
+#endif /* _StepNames_H_ */
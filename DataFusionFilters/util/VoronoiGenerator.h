@@ -0,0 +1,269 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ *                                                                             *
+ * Copyright (c) 2015 William Lenthe                                           *
+ *                                                                             *
+ * This program is free software: you can redistribute it and/or modify        *
+ * it under the terms of the GNU Lesser General Public License as published by *
+ * the Free Software Foundation, either version 3 of the License, or           *
+ * (at your option) any later version.                                         *
+ *                                                                             *
+ * This program is distributed in the hope that it will be useful,             *
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of              *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the               *
+ * GNU Lesser General Public License for more details.                         *
+ *                                                                             *
+ * You should have received a copy of the GNU Lesser General Public License    *
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.       *
+ *                                                                             *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#ifndef _VoronoiGenerator_H_
+#define _VoronoiGenerator_H_
+
+#include <vector>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "SIMPLib/SIMPLib.h"
+
+#ifdef SIMPLib_USE_PARALLEL_ALGORITHMS
+  #include <tbb/parallel_for.h>
+  #include <tbb/blocked_range.h>
+  #include <tbb/partitioner.h>
+#endif
+
+/**
+ * @brief The VoronoiGenerator class labels every voxel of a grid (voxel centers at integer coordinates) with the nearest
+ * of a set of seed points, producing a Voronoi tessellation microstructure.
+ * Each row (along x) is labeled independently: the squared distance from the row to a seed is a parabola in x, so the
+ * nearest seed of every voxel in the row is the lower envelope of the parabolas of the seeds near the row (found in
+ * linear time). Seeds are binned in columns over (y, z) and only the columns around the row are considered; the window
+ * is widened for the rare rows where a seed outside it could still be closer. The work per row is proportional to the
+ * row length plus the number of nearby seeds instead of the row length times the number of seeds.
+ */
+class VoronoiGenerator
+{
+  public:
+    /**
+     * @param seeds seed coordinates (3 values per seed, may lie outside the grid), voxels of seed i are labeled i + 1
+     * @param numSeeds number of seeds
+     * @param dims grid dimensions
+     */
+    VoronoiGenerator(const float* seeds, size_t numSeeds, const size_t dims[3]) :
+      m_Seeds(seeds, seeds + 3 * numSeeds)
+    {
+      std::copy(dims, dims + 3, m_Dims);
+
+      // columns about as wide as the mean seed spacing hold ~row length / spacing seeds each
+      double volume = static_cast<double>(m_Dims[0]) * m_Dims[1] * m_Dims[2];
+      m_BinWidth = numSeeds > 0 ? std::max(1.0, std::cbrt(volume / numSeeds)) : 1.0;
+      m_Bins[0] = std::max<size_t>(1, static_cast<size_t>(std::ceil(m_Dims[1] / m_BinWidth)));
+      m_Bins[1] = std::max<size_t>(1, static_cast<size_t>(std::ceil(m_Dims[2] / m_BinWidth)));
+
+      // seeds outside the grid go in the closest column (they're only ever further from rows outside the window)
+      std::vector<size_t> seedBin(numSeeds);
+      m_BinOffsets.assign(m_Bins[0] * m_Bins[1] + 1, 0);
+      for(size_t i = 0; i < numSeeds; i++)
+      {
+        seedBin[i] = bin(m_Seeds[3 * i + 1], 0) + m_Bins[0] * bin(m_Seeds[3 * i + 2], 1);
+        m_BinOffsets[seedBin[i] + 1]++;
+      }
+      for(size_t i = 1; i < m_BinOffsets.size(); i++)
+        m_BinOffsets[i] += m_BinOffsets[i - 1];
+
+      // seeds of each column sorted by x so the seeds of a window can be merged instead of sorted
+      std::vector<size_t> next(m_BinOffsets.begin(), m_BinOffsets.end() - 1);
+      m_BinSeeds.resize(numSeeds);
+      for(size_t i = 0; i < numSeeds; i++)
+        m_BinSeeds[next[seedBin[i]]++] = i;
+      for(size_t b = 0; b + 1 < m_BinOffsets.size(); b++)
+        std::sort(m_BinSeeds.begin() + m_BinOffsets[b], m_BinSeeds.begin() + m_BinOffsets[b + 1], SeedCompare(m_Seeds));
+    }
+
+    size_t numSeeds() const {return m_Seeds.size() / 3;}
+
+    /**
+     * @brief label Labels every voxel with the (1 based) index of its nearest seed (0 if there are no seeds)
+     * @param ids output labels (dims[0] * dims[1] * dims[2] values, x fastest)
+     */
+    void label(int32_t* ids) const
+    {
+      LabelImpl impl(this, ids);
+#ifdef SIMPLib_USE_PARALLEL_ALGORITHMS
+      tbb::parallel_for(tbb::blocked_range<size_t>(0, m_Dims[1] * m_Dims[2]), impl, tbb::auto_partitioner());
+#else
+      impl.label(0, m_Dims[1] * m_Dims[2]);
+#endif
+    }
+
+  private:
+    // candidate seed of a row: seed index, x coordinate, and squared distance from the row
+    struct Candidate
+    {
+      size_t index;
+      double x;
+      double offset2;
+    };
+
+    class SeedCompare
+    {
+      public:
+        SeedCompare(const std::vector<float>& seeds) : m_Seeds(seeds) {}
+        bool operator()(size_t i, size_t j) const
+        {
+          if(m_Seeds[3 * i] != m_Seeds[3 * j]) return m_Seeds[3 * i] < m_Seeds[3 * j];
+          return i < j;
+        }
+
+      private:
+        const std::vector<float>& m_Seeds;
+    };
+
+    static bool CandidateCompare(const Candidate& a, const Candidate& b)
+    {
+      if(a.x != b.x) return a.x < b.x;
+      return a.index < b.index;
+    }
+
+    size_t bin(float coordinate, size_t axis) const
+    {
+      if(coordinate <= 0) return 0;
+      return std::min(static_cast<size_t>(coordinate / m_BinWidth), m_Bins[axis] - 1);
+    }
+
+    class LabelImpl
+    {
+      public:
+        LabelImpl(const VoronoiGenerator* generator, int32_t* ids) : m_Generator(generator), m_Ids(ids) {}
+
+        void label(size_t start, size_t end) const
+        {
+          const VoronoiGenerator& g = *m_Generator;
+          const size_t dimX = g.m_Dims[0];
+          std::vector<Candidate> candidates, column, merged;
+          std::vector<size_t> envelope;
+          std::vector<double> boundaries;
+          for(size_t row = start; row < end; row++)
+          {
+            int32_t* ids = m_Ids + row * dimX;
+            if(g.m_Seeds.empty())
+            {
+              std::fill(ids, ids + dimX, 0);
+              continue;
+            }
+            const double y = static_cast<double>(row % g.m_Dims[1]);
+            const double z = static_cast<double>(row / g.m_Dims[1]);
+            const int64_t by = static_cast<int64_t>(g.bin(static_cast<float>(y), 0));
+            const int64_t bz = static_cast<int64_t>(g.bin(static_cast<float>(z), 1));
+            const int64_t binsY = static_cast<int64_t>(g.m_Bins[0]);
+            const int64_t binsZ = static_cast<int64_t>(g.m_Bins[1]);
+            for(int64_t k = 1; ; k++)
+            {
+              int64_t y0 = std::max<int64_t>(by - k, 0), y1 = std::min<int64_t>(by + k, binsY - 1);
+              int64_t z0 = std::max<int64_t>(bz - k, 0), z1 = std::min<int64_t>(bz + k, binsZ - 1);
+
+              // distance from the row to the closest seed outside the window (sides at the edge of the grid hold every seed beyond them)
+              double margin = std::numeric_limits<double>::infinity();
+              if(y0 > 0) margin = std::min(margin, y - y0 * g.m_BinWidth);
+              if(y1 < binsY - 1) margin = std::min(margin, (y1 + 1) * g.m_BinWidth - y);
+              if(z0 > 0) margin = std::min(margin, z - z0 * g.m_BinWidth);
+              if(z1 < binsZ - 1) margin = std::min(margin, (z1 + 1) * g.m_BinWidth - z);
+              const double margin2 = margin * margin;
+
+              // gather the seeds of the window sorted by x, seeds further than the margin from the row can only be nearest if the window is too small
+              candidates.clear();
+              for(int64_t j = z0; j <= z1; j++)
+              {
+                for(int64_t i = y0; i <= y1; i++)
+                {
+                  size_t b = static_cast<size_t>(i + binsY * j);
+                  column.clear();
+                  for(size_t s = g.m_BinOffsets[b]; s < g.m_BinOffsets[b + 1]; s++)
+                  {
+                    const float* seed = &g.m_Seeds[3 * g.m_BinSeeds[s]];
+                    Candidate candidate;
+                    candidate.index = g.m_BinSeeds[s];
+                    candidate.x = seed[0];
+                    candidate.offset2 = (seed[1] - y) * (seed[1] - y) + (seed[2] - z) * (seed[2] - z);
+                    if(candidate.offset2 <= margin2) column.push_back(candidate);
+                  }
+                  merged.resize(candidates.size() + column.size());
+                  std::merge(candidates.begin(), candidates.end(), column.begin(), column.end(), merged.begin(), CandidateCompare);
+                  candidates.swap(merged);
+                }
+              }
+
+              // done once every voxel is closer to its nearest seed than to any seed outside the window
+              if(fill(candidates, envelope, boundaries, ids, dimX) <= margin2) break;
+            }
+          }
+        }
+
+#ifdef SIMPLib_USE_PARALLEL_ALGORITHMS
+        void operator()(const tbb::blocked_range<size_t>& r) const
+        {
+          label(r.begin(), r.end());
+        }
+#endif
+
+      private:
+        // labels a row from the lower envelope of the candidate parabolas, returns the largest squared distance to a nearest seed
+        static double fill(const std::vector<Candidate>& candidates, std::vector<size_t>& envelope, std::vector<double>& boundaries, int32_t* ids, size_t dimX)
+        {
+          if(candidates.empty()) return std::numeric_limits<double>::infinity();
+          envelope.clear();
+          boundaries.clear();
+          boundaries.push_back(-std::numeric_limits<double>::infinity());
+          for(size_t q = 0; q < candidates.size(); q++)
+          {
+            const Candidate& c = candidates[q];
+            if(!envelope.empty() && candidates[envelope.back()].x == c.x)
+            {
+              // of two seeds with the same x only the one closer to the row can be nearest
+              if(candidates[envelope.back()].offset2 <= c.offset2) continue;
+              envelope.pop_back();
+              boundaries.pop_back();
+              if(envelope.empty()) boundaries.push_back(-std::numeric_limits<double>::infinity());
+            }
+            while(!envelope.empty())
+            {
+              const Candidate& v = candidates[envelope.back()];
+              double s = ((c.offset2 + c.x * c.x) - (v.offset2 + v.x * v.x)) / (2 * (c.x - v.x));
+              if(s > boundaries.back())
+              {
+                boundaries.push_back(s);
+                break;
+              }
+              envelope.pop_back();
+              boundaries.pop_back();
+            }
+            envelope.push_back(q);
+          }
+          boundaries.push_back(std::numeric_limits<double>::infinity());
+
+          double farthest = 0;
+          size_t k = 0;
+          for(size_t x = 0; x < dimX; x++)
+          {
+            while(boundaries[k + 1] < x) k++;
+            const Candidate& v = candidates[envelope[k]];
+            ids[x] = static_cast<int32_t>(v.index + 1);
+            farthest = std::max(farthest, (x - v.x) * (x - v.x) + v.offset2);
+          }
+          return farthest;
+        }
+
+        const VoronoiGenerator* m_Generator;
+        int32_t* m_Ids;
+    };
+
+    std::vector<float> m_Seeds;
+    size_t m_Dims[3];
+    double m_BinWidth;
+    size_t m_Bins[2];
+    std::vector<size_t> m_BinOffsets;
+    std::vector<size_t> m_BinSeeds;
+};
+
+#endif /* _VoronoiGenerator_H_ */
@@ -0,0 +1,210 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ *                                                                             *
+ * Copyright (c) 2015 William Lenthe                                           *
+ *                                                                             *
+ * This program is free software: you can redistribute it and/or modify        *
+ * it under the terms of the GNU Lesser General Public License as published by *
+ * the Free Software Foundation, either version 3 of the License, or           *
+ * (at your option) any later version.                                         *
+ *                                                                             *
+ * This program is distributed in the hope that it will be useful,             *
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of              *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the               *
+ * GNU Lesser General Public License for more details.                         *
+ *                                                                             *
+ * You should have received a copy of the GNU Lesser General Public License    *
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.       *
+ *                                                                             *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#ifndef _WeightedMoments_H_
+#define _WeightedMoments_H_
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#include "SIMPLib/SIMPLib.h"
+
+#ifdef SIMPLib_USE_PARALLEL_ALGORITHMS
+  #include <tbb/parallel_reduce.h>
+  #include <tbb/blocked_range.h>
+  #include <tbb/partitioner.h>
+#endif
+
+/**
+ * @brief The WeightedMoments class holds the weighted centroids of two paired point sets (x and y) along with the cross
+ * covariance sum(w * (x - xBar) * (y - yBar)^T) and variance sum(w * (x - xBar) * (x - xBar)^T) about the centroids (not
+ * divided by the total weight). Pairs are added one at a time with West's weighted update of Welford's algorithm and partial
+ * results are merged with Chan's formula, so the moments are found in a single pass in double precision without the
+ * cancellation of accumulating raw sums of squares. Matrices are stored row major.
+ */
+class WeightedMoments
+{
+  public:
+    WeightedMoments() :
+      m_TotalWeight(0.0)
+    {
+      for(size_t i = 0; i < 3; i++)
+        m_XBar[i] = m_YBar[i] = 0.0;
+      for(size_t i = 0; i < 9; i++)
+        m_Covariance[i] = m_Variance[i] = 0.0;
+    }
+
+    /**
+     * @brief add Adds a pair of points (pairs with non positive weight are skipped)
+     */
+    void add(const float* x, const float* y, double w)
+    {
+      if(w <= 0.0) return;
+      m_TotalWeight += w;
+      const double r = w / m_TotalWeight;
+      double dx[3], dy[3];
+      for(size_t i = 0; i < 3; i++)
+      {
+        dx[i] = x[i] - m_XBar[i];
+        dy[i] = y[i] - m_YBar[i];
+        m_XBar[i] += r * dx[i];
+        m_YBar[i] += r * dy[i];
+      }
+
+      //deviation from the old centroid times deviation from the new centroid
+      for(size_t i = 0; i < 3; i++)
+      {
+        for(size_t j = 0; j < 3; j++)
+        {
+          m_Covariance[3 * i + j] += w * dx[i] * (y[j] - m_YBar[j]);
+          m_Variance[3 * i + j] += w * dx[i] * (x[j] - m_XBar[j]);
+        }
+      }
+    }
+
+    /**
+     * @brief merge Combines the moments of another (disjoint) set of pairs
+     */
+    void merge(const WeightedMoments& other)
+    {
+      if(other.m_TotalWeight <= 0.0) return;
+      if(m_TotalWeight <= 0.0)
+      {
+        *this = other;
+        return;
+      }
+      const double totalWeight = m_TotalWeight + other.m_TotalWeight;
+      const double f = m_TotalWeight * other.m_TotalWeight / totalWeight;
+      const double r = other.m_TotalWeight / totalWeight;
+      double dx[3], dy[3];
+      for(size_t i = 0; i < 3; i++)
+      {
+        dx[i] = other.m_XBar[i] - m_XBar[i];
+        dy[i] = other.m_YBar[i] - m_YBar[i];
+      }
+      for(size_t i = 0; i < 3; i++)
+      {
+        for(size_t j = 0; j < 3; j++)
+        {
+          m_Covariance[3 * i + j] += other.m_Covariance[3 * i + j] + f * dx[i] * dy[j];
+          m_Variance[3 * i + j] += other.m_Variance[3 * i + j] + f * dx[i] * dx[j];
+        }
+      }
+      for(size_t i = 0; i < 3; i++)
+      {
+        m_XBar[i] += r * dx[i];
+        m_YBar[i] += r * dy[i];
+      }
+      m_TotalWeight = totalWeight;
+    }
+
+    /**
+     * @brief Accumulate Computes the moments of paired points (in parallel for large numbers of pairs)
+     * @param x first point set (3 values per point)
+     * @param y second point set (3 values per point)
+     * @param pairs indices of paired points (x index, y index)
+     * @param weights weight of each pair indexed by the y point (NULL for equal weights)
+     */
+    static WeightedMoments Accumulate(const float* x, const float* y, const std::vector< std::pair<size_t, size_t> >& pairs, const float* weights);
+
+    double totalWeight() const {return m_TotalWeight;}
+    const double* xBar() const {return m_XBar;}
+    const double* yBar() const {return m_YBar;}
+    const double* covariance() const {return m_Covariance;}
+    const double* variance() const {return m_Variance;}
+
+  private:
+    // splitting small sets of pairs (e.g. minimal samples) costs more than summing them
+    static const size_t k_ParallelPairs = 4096;
+
+    class AccumulateImpl;
+
+    double m_TotalWeight;
+    double m_XBar[3];
+    double m_YBar[3];
+    double m_Covariance[9];
+    double m_Variance[9];
+};
+
+// accumulates the moments of a range of pairs
+class WeightedMoments::AccumulateImpl
+{
+  public:
+    AccumulateImpl(const float* x, const float* y, const std::vector< std::pair<size_t, size_t> >& pairs, const float* weights) :
+      m_X(x),
+      m_Y(y),
+      m_Pairs(pairs),
+      m_Weights(weights)
+    {}
+
+    void accumulate(size_t start, size_t end)
+    {
+      for(size_t i = start; i < end; i++)
+      {
+        const size_t j = m_Pairs[i].second;
+        m_Moments.add(m_X + 3 * m_Pairs[i].first, m_Y + 3 * j, NULL == m_Weights ? 1.0 : m_Weights[j]);
+      }
+    }
+
+#ifdef SIMPLib_USE_PARALLEL_ALGORITHMS
+    AccumulateImpl(AccumulateImpl& other, tbb::split) :
+      m_X(other.m_X),
+      m_Y(other.m_Y),
+      m_Pairs(other.m_Pairs),
+      m_Weights(other.m_Weights)
+    {}
+
+    void operator()(const tbb::blocked_range<size_t>& r)
+    {
+      accumulate(r.begin(), r.end());
+    }
+
+    void join(const AccumulateImpl& other)
+    {
+      m_Moments.merge(other.m_Moments);
+    }
+#endif
+
+    const WeightedMoments& moments() const {return m_Moments;}
+
+  private:
+    const float* m_X;
+    const float* m_Y;
+    const std::vector< std::pair<size_t, size_t> >& m_Pairs;
+    const float* m_Weights;
+    WeightedMoments m_Moments;
+};
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+inline WeightedMoments WeightedMoments::Accumulate(const float* x, const float* y, const std::vector< std::pair<size_t, size_t> >& pairs, const float* weights)
+{
+  AccumulateImpl accumulator(x, y, pairs, weights);
+#ifdef SIMPLib_USE_PARALLEL_ALGORITHMS
+  if(pairs.size() > k_ParallelPairs)
+    tbb::parallel_reduce(tbb::blocked_range<size_t>(0, pairs.size(), k_ParallelPairs), accumulator, tbb::auto_partitioner());
+  else
+#endif
+    accumulator.accumulate(0, pairs.size());
+  return accumulator.moments();
+}
+
+#endif /* _WeightedMoments_H_ */
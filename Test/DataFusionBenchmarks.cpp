@@ -0,0 +1,649 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ *                                                                             *
+ * Copyright (c) 2015 William Lenthe                                           *
+ *                                                                             *
+ * This program is free software: you can redistribute it and/or modify        *
+ * it under the terms of the GNU Lesser General Public License as published by *
+ * the Free Software Foundation, either version 3 of the License, or           *
+ * (at your option) any later version.                                         *
+ *                                                                             *
+ * This program is distributed in the hope that it will be useful,             *
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of              *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the               *
+ * GNU Lesser General Public License for more details.                         *
+ *                                                                             *
+ * You should have received a copy of the GNU Lesser General Public License    *
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.       *
+ *                                                                             *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#include <QtCore/QCoreApplication>
+#include <QtCore/QCommandLineParser>
+#include <QtCore/QDateTime>
+#include <QtCore/QElapsedTimer>
+#include <QtCore/QFile>
+#include <QtCore/QJsonArray>
+#include <QtCore/QJsonDocument>
+#include <QtCore/QJsonObject>
+#include <QtCore/QTextStream>
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/Common/Constants.h"
+#include "SIMPLib/Common/SIMPLibSetGetMacros.h"
+#include "SIMPLib/Common/FilterManager.h"
+#include "SIMPLib/Common/FilterFactory.hpp"
+#include "SIMPLib/Common/Observer.h"
+#include "SIMPLib/Common/PipelineMessage.h"
+#include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/DataContainers/DataContainerArray.h"
+#include "SIMPLib/Geometry/ImageGeom.h"
+#include "SIMPLib/Plugin/SIMPLibPluginLoader.h"
+#include "SIMPLib/Utilities/QMetaObjectUtilities.h"
+
+#include "OrientationLib/SpaceGroupOps/SpaceGroupOps.h"
+
+#ifdef SIMPLib_USE_PARALLEL_ALGORITHMS
+  #include <tbb/parallel_for.h>
+  #include <tbb/blocked_range.h>
+  #include <tbb/partitioner.h>
+  #include <tbb/task_scheduler_init.h>
+#endif
+
+/*
+ * Times the DataFusion filters on synthetic volumes at configurable scales and writes the results as JSON, e.g.
+ *   DataFusionBenchmarks --sizes 64,256 --features 1000,100000 --filter MatchFeatureIds --output results.json
+ * The defaults cover 64^3 to 1024^3 voxels and 10^3 to 10^6 features (the largest volumes need tens of GB of memory).
+ * Each filter's execute is split into phases at its status messages, so a regression can be traced to a phase.
+ */
+
+namespace Synthetic
+{
+// sorted segment boundaries splitting [0, length) into count segments of random length (first is 0, last is length)
+std::vector<size_t> randomCuts(size_t length, size_t count, std::mt19937& generator)
+{
+  std::vector<size_t> cuts(1, 0);
+  std::uniform_int_distribution<size_t> distribution(1, length - 1);
+  std::vector<size_t> interior;
+  while(interior.size() + 1 < count)
+  {
+    interior.push_back(distribution(generator));
+    std::sort(interior.begin(), interior.end());
+    interior.erase(std::unique(interior.begin(), interior.end()), interior.end());
+  }
+  cuts.insert(cuts.end(), interior.begin(), interior.end());
+  cuts.push_back(length);
+  return cuts;
+}
+
+// moves each interior boundary by up to jitter voxels while keeping segments non empty
+std::vector<size_t> jitterCuts(const std::vector<size_t>& cuts, int jitter, std::mt19937& generator)
+{
+  std::vector<size_t> jittered(cuts);
+  std::uniform_int_distribution<int> distribution(-jitter, jitter);
+  for(size_t i = 1; i + 1 < cuts.size(); i++)
+  {
+    int64_t cut = static_cast<int64_t>(cuts[i]) + distribution(generator);
+    cut = std::max<int64_t>(cut, jittered[i - 1] + 1);
+    cut = std::min<int64_t>(cut, cuts[i + 1] - 1);
+    jittered[i] = static_cast<size_t>(std::max<int64_t>(cut, jittered[i - 1] + 1));
+  }
+  return jittered;
+}
+
+// segment index of every coordinate along an axis
+std::vector<int32_t> segmentLookup(const std::vector<size_t>& cuts)
+{
+  std::vector<int32_t> lookup(cuts.back());
+  for(size_t i = 0; i + 1 < cuts.size(); i++)
+    std::fill(lookup.begin() + cuts[i], lookup.begin() + cuts[i + 1], static_cast<int32_t>(i));
+  return lookup;
+}
+
+// fills feature ids of a brick microstructure (features are the cells of a grid with random spacing) one z slice at a time
+class BrickFiller
+{
+  public:
+    BrickFiller(int32_t* ids, size_t dim, const std::vector<int32_t> lookups[3], size_t count, const std::vector<int32_t>& idMap) :
+      m_Ids(ids),
+      m_Dim(dim),
+      m_Lookups(lookups),
+      m_Count(count),
+      m_IdMap(idMap)
+    {}
+
+    void fill(size_t start, size_t end) const
+    {
+      for(size_t z = start; z < end; z++)
+      {
+        for(size_t y = 0; y < m_Dim; y++)
+        {
+          int32_t* row = m_Ids + (z * m_Dim + y) * m_Dim;
+          size_t cell = (m_Lookups[2][z] * m_Count + m_Lookups[1][y]) * m_Count;
+          for(size_t x = 0; x < m_Dim; x++)
+            row[x] = m_IdMap[cell + m_Lookups[0][x]];
+        }
+      }
+    }
+
+#ifdef SIMPLib_USE_PARALLEL_ALGORITHMS
+    void operator()(const tbb::blocked_range<size_t>& r) const
+    {
+      fill(r.begin(), r.end());
+    }
+#endif
+
+  private:
+    int32_t* m_Ids;
+    size_t m_Dim;
+    const std::vector<int32_t>* m_Lookups;
+    size_t m_Count;
+    const std::vector<int32_t>& m_IdMap;
+};
+
+// random orientations (uniformly distributed unit quaternions) of every cell of the grid
+std::vector<float> randomQuats(size_t numFeatures, std::mt19937& generator)
+{
+  std::vector<float> quats(4 * numFeatures);
+  std::normal_distribution<float> distribution(0.0f, 1.0f);
+  for(size_t i = 0; i < numFeatures; i++)
+  {
+    float* q = &quats[4 * i];
+    float norm = 0.0f;
+    for(size_t j = 0; j < 4; j++)
+    {
+      q[j] = distribution(generator);
+      norm += q[j] * q[j];
+    }
+    norm = std::sqrt(norm);
+    for(size_t j = 0; j < 4; j++)
+      q[j] /= norm;
+  }
+  return quats;
+}
+
+// adds a data container holding a brick microstructure (feature ids, centroids, sizes, orientations, and a single cubic phase)
+void addVolume(DataContainerArray::Pointer dca, const QString& name, size_t dim, const std::vector<size_t> cuts[3], const std::vector<int32_t>& idMap, const std::vector<float>& quats)
+{
+  const size_t count = cuts[0].size() - 1;
+  const size_t numFeatures = count * count * count;
+
+  QVector<size_t> tDims(3, dim);
+  QVector<size_t> cDims(1, 1);
+  AttributeMatrix::Pointer cellAm = AttributeMatrix::New(tDims, DREAM3D::Defaults::CellAttributeMatrixName, DREAM3D::AttributeMatrixType::Cell);
+  DataArray<int32_t>::Pointer featureIds = DataArray<int32_t>::CreateArray(tDims, cDims, DREAM3D::CellData::FeatureIds);
+  std::vector<int32_t> lookups[3] = { segmentLookup(cuts[0]), segmentLookup(cuts[1]), segmentLookup(cuts[2]) };
+  BrickFiller filler(featureIds->getPointer(0), dim, lookups, count, idMap);
+#ifdef SIMPLib_USE_PARALLEL_ALGORITHMS
+  tbb::parallel_for(tbb::blocked_range<size_t>(0, dim), filler, tbb::auto_partitioner());
+#else
+  filler.fill(0, dim);
+#endif
+  cellAm->addAttributeArray(featureIds->getName(), featureIds);
+
+  tDims.resize(1);
+  tDims[0] = numFeatures + 1;
+  AttributeMatrix::Pointer featureAm = AttributeMatrix::New(tDims, DREAM3D::Defaults::CellFeatureAttributeMatrixName, DREAM3D::AttributeMatrixType::CellFeature);
+  DataArray<int32_t>::Pointer numCells = DataArray<int32_t>::CreateArray(tDims, cDims, DREAM3D::FeatureData::NumCells);
+  DataArray<float>::Pointer diameters = DataArray<float>::CreateArray(tDims, cDims, DREAM3D::FeatureData::EquivalentDiameters);
+  DataArray<int32_t>::Pointer phases = DataArray<int32_t>::CreateArray(tDims, cDims, DREAM3D::FeatureData::Phases);
+  cDims[0] = 3;
+  DataArray<float>::Pointer centroids = DataArray<float>::CreateArray(tDims, cDims, DREAM3D::FeatureData::Centroids);
+  cDims[0] = 4;
+  DataArray<float>::Pointer avgQuats = DataArray<float>::CreateArray(tDims, cDims, DREAM3D::FeatureData::AvgQuats);
+  numCells->initializeWithZeros();
+  diameters->initializeWithZeros();
+  phases->initializeWithValue(1);
+  phases->setValue(0, 0);
+  centroids->initializeWithZeros();
+  avgQuats->initializeWithZeros();
+  for(size_t k = 0; k < count; k++)
+  {
+    for(size_t j = 0; j < count; j++)
+    {
+      for(size_t i = 0; i < count; i++)
+      {
+        size_t cell = (k * count + j) * count + i;
+        int32_t id = idMap[cell];
+        size_t extents[3] = { cuts[0][i + 1] - cuts[0][i], cuts[1][j + 1] - cuts[1][j], cuts[2][k + 1] - cuts[2][k] };
+        numCells->setValue(id, static_cast<int32_t>(extents[0] * extents[1] * extents[2]));
+        diameters->setValue(id, std::pow(6.0f * extents[0] * extents[1] * extents[2] / static_cast<float>(SIMPLib::Constants::k_Pi), 1.0f / 3.0f));
+        centroids->setComponent(id, 0, 0.5f * (cuts[0][i] + cuts[0][i + 1]));
+        centroids->setComponent(id, 1, 0.5f * (cuts[1][j] + cuts[1][j + 1]));
+        centroids->setComponent(id, 2, 0.5f * (cuts[2][k] + cuts[2][k + 1]));
+        for(int c = 0; c < 4; c++)
+          avgQuats->setComponent(id, c, quats[4 * cell + c]);
+      }
+    }
+  }
+  featureAm->addAttributeArray(numCells->getName(), numCells);
+  featureAm->addAttributeArray(diameters->getName(), diameters);
+  featureAm->addAttributeArray(centroids->getName(), centroids);
+  featureAm->addAttributeArray(phases->getName(), phases);
+  featureAm->addAttributeArray(avgQuats->getName(), avgQuats);
+
+  tDims[0] = 2;
+  cDims[0] = 1;
+  AttributeMatrix::Pointer ensembleAm = AttributeMatrix::New(tDims, DREAM3D::Defaults::CellEnsembleAttributeMatrixName, DREAM3D::AttributeMatrixType::CellEnsemble);
+  DataArray<unsigned int>::Pointer crystalStructures = DataArray<unsigned int>::CreateArray(tDims, cDims, DREAM3D::EnsembleData::CrystalStructures);
+  crystalStructures->setValue(0, Ebsd::CrystalStructure::UnknownCrystalStructure);
+  crystalStructures->setValue(1, Ebsd::CrystalStructure::Cubic_High);
+  ensembleAm->addAttributeArray(crystalStructures->getName(), crystalStructures);
+
+  size_t dims[3] = { dim, dim, dim };
+  ImageGeom::Pointer image = ImageGeom::CreateGeometry(DREAM3D::Geometry::ImageGeometry);
+  image->setDimensions(dims);
+  DataContainer::Pointer dc = DataContainer::New(name);
+  dc->setGeometry(image);
+  dc->addAttributeMatrix(cellAm->getName(), cellAm);
+  dc->addAttributeMatrix(featureAm->getName(), featureAm);
+  dc->addAttributeMatrix(ensembleAm->getName(), ensembleAm);
+  dca->addDataContainer(dc);
+}
+
+/**
+ * @brief createDataContainerArray Creates a reference volume (the first name) and moving volumes (the remaining names) with
+ * the same features whose boundaries are moved by up to jitter voxels. Moving feature ids are shuffled unless they should
+ * correspond to the reference ids.
+ */
+DataContainerArray::Pointer createDataContainerArray(const QStringList& names, size_t dim, size_t count, int jitter, bool shuffle, unsigned int seed)
+{
+  DataContainerArray::Pointer dca = DataContainerArray::New();
+  if(names.isEmpty()) return dca;
+
+  std::mt19937 generator(seed);
+  std::vector<size_t> referenceCuts[3];
+  for(size_t i = 0; i < 3; i++)
+    referenceCuts[i] = randomCuts(dim, count, generator);
+
+  const size_t numFeatures = count * count * count;
+  std::vector<int32_t> referenceMap(numFeatures);
+  for(size_t i = 0; i < numFeatures; i++)
+    referenceMap[i] = static_cast<int32_t>(i + 1);
+  std::vector<float> quats = randomQuats(numFeatures, generator);
+  addVolume(dca, names[0], dim, referenceCuts, referenceMap, quats);
+
+  for(int n = 1; n < names.size(); n++)
+  {
+    std::vector<size_t> movingCuts[3];
+    for(size_t i = 0; i < 3; i++)
+      movingCuts[i] = jitterCuts(referenceCuts[i], jitter, generator);
+    std::vector<int32_t> movingMap(referenceMap);
+    if(shuffle) std::shuffle(movingMap.begin(), movingMap.end(), generator);
+    addVolume(dca, names[n], dim, movingCuts, movingMap, quats);
+  }
+  return dca;
+}
+}
+
+/**
+ * @brief The PhaseTimer class splits the execution of a filter into phases at each status message the filter sends (a
+ * phase is named by the message that starts it)
+ */
+class PhaseTimer : public Observer
+{
+  public:
+    PhaseTimer() : Observer() {}
+    virtual ~PhaseTimer() {}
+
+    void start()
+    {
+      m_Names.clear();
+      m_Seconds.clear();
+      m_Current = "Data Check";
+      m_Timer.start();
+      m_Last = 0;
+    }
+
+    void stop()
+    {
+      lap("");
+    }
+
+    virtual void processPipelineMessage(const PipelineMessage& pm)
+    {
+      if(PipelineMessage::StatusMessage == pm.getType()) lap(pm.getText());
+    }
+
+    QJsonArray phases() const
+    {
+      QJsonArray phases;
+      for(int i = 0; i < m_Names.size(); i++)
+      {
+        QJsonObject phase;
+        phase["name"] = m_Names[i];
+        phase["seconds"] = m_Seconds[i];
+        phases.append(phase);
+      }
+      return phases;
+    }
+
+  private:
+    void lap(const QString& next)
+    {
+      qint64 now = m_Timer.nsecsElapsed();
+      m_Names.push_back(m_Current);
+      m_Seconds.push_back(static_cast<double>(now - m_Last) * 1.0e-9);
+      m_Last = now;
+      m_Current = next;
+    }
+
+    QElapsedTimer m_Timer;
+    qint64 m_Last;
+    QString m_Current;
+    QVector<QString> m_Names;
+    QVector<double> m_Seconds;
+};
+
+/**
+ * @brief The BenchmarkCase struct is a filter with the properties that differ from its defaults and the synthetic volumes it runs on
+ */
+struct BenchmarkCase
+{
+  BenchmarkCase() : shuffle(true), maxFeatures(0) {volumes << "Reference" << "Moving";}
+
+  QString name;
+  QString filterName;
+  bool shuffle;//false if moving ids should already correspond to reference ids
+  QStringList volumes;//names of the synthetic volumes (the first is the reference), empty for filters that create their own
+  size_t maxFeatures;//larger problems are skipped (0 for no limit)
+  QList< QPair<QString, QVariant> > properties;
+
+  void set(const QString& property, const QVariant& value) {properties.push_back(qMakePair(property, value));}
+};
+
+QList<BenchmarkCase> benchmarkCases(size_t dim, size_t numFeatures, float meanSize)
+{
+  QList<BenchmarkCase> cases;
+  DataArrayPath referenceIds("Reference", DREAM3D::Defaults::CellAttributeMatrixName, DREAM3D::CellData::FeatureIds);
+  DataArrayPath movingIds("Moving", DREAM3D::Defaults::CellAttributeMatrixName, DREAM3D::CellData::FeatureIds);
+  DataArrayPath referenceFeatures("Reference", DREAM3D::Defaults::CellFeatureAttributeMatrixName, "");
+  DataArrayPath movingFeatures("Moving", DREAM3D::Defaults::CellFeatureAttributeMatrixName, "");
+  DataArrayPath referenceCentroids("Reference", DREAM3D::Defaults::CellFeatureAttributeMatrixName, DREAM3D::FeatureData::Centroids);
+  DataArrayPath movingCentroids("Moving", DREAM3D::Defaults::CellFeatureAttributeMatrixName, DREAM3D::FeatureData::Centroids);
+  DataArrayPath referenceCells("Reference", DREAM3D::Defaults::CellAttributeMatrixName, "");
+  DataArrayPath movingCells("Moving", DREAM3D::Defaults::CellAttributeMatrixName, "");
+  DataArrayPath referenceEnsembles("Reference", DREAM3D::Defaults::CellEnsembleAttributeMatrixName, DREAM3D::EnsembleData::CrystalStructures);
+  DataArrayPath movingEnsembles("Moving", DREAM3D::Defaults::CellEnsembleAttributeMatrixName, DREAM3D::EnsembleData::CrystalStructures);
+
+  BenchmarkCase match;
+  match.filterName = "MatchFeatureIds";
+  match.shuffle = true;
+  match.set("ReferenceFeatureIdsArrayPath", QVariant::fromValue(referenceIds));
+  match.set("MovingFeatureIdsArrayPath", QVariant::fromValue(movingIds));
+  match.set("ReferenceCellFeatureAttributeMatrixPath", QVariant::fromValue(referenceFeatures));
+  match.set("MovingCellFeatureAttributeMatrixPath", QVariant::fromValue(movingFeatures));
+  match.set("UseOrientations", false);
+  match.set("Metric", 1);
+  match.set("MetricThreshold", 0.5);
+
+  BenchmarkCase greedy(match);
+  greedy.name = "Greedy";
+  greedy.set("MatchingMethod", 0);
+  cases.push_back(greedy);
+
+  BenchmarkCase optimal(match);
+  optimal.name = "Optimal";
+  optimal.set("MatchingMethod", 1);
+  cases.push_back(optimal);
+
+  BenchmarkCase neighborhood(greedy);
+  neighborhood.name = "Neighborhood";
+  neighborhood.set("UseDilation", true);
+  neighborhood.set("DilationRadius", 1);
+  cases.push_back(neighborhood);
+
+  BenchmarkCase centroids(greedy);
+  centroids.name = "Centroids";
+  centroids.set("CorrespondenceSource", 1);
+  centroids.set("ReferenceCentroidsArrayPath", QVariant::fromValue(referenceCentroids));
+  centroids.set("MovingCentroidsArrayPath", QVariant::fromValue(movingCentroids));
+  centroids.set("CentroidTolerance", 0.5 * meanSize);
+  cases.push_back(centroids);
+
+  BenchmarkCase renumber;
+  renumber.name = "Volume";
+  renumber.filterName = "RenumberFeatures";
+  renumber.shuffle = true;
+  renumber.set("FeatureIdsArrayPath", QVariant::fromValue(movingIds));
+  renumber.set("ScalarArrayPath", QVariant::fromValue(DataArrayPath("Moving", DREAM3D::Defaults::CellFeatureAttributeMatrixName, DREAM3D::FeatureData::NumCells)));
+  cases.push_back(renumber);
+
+  BenchmarkCase registration;
+  registration.name = "Rigid";
+  registration.filterName = "RegisterPointSets";
+  registration.shuffle = false;
+  registration.set("ReferenceCentroidsArrayPath", QVariant::fromValue(referenceCentroids));
+  registration.set("MovingCentroidsArrayPath", QVariant::fromValue(movingCentroids));
+  registration.set("UseGoodPoints", false);
+  registration.set("UseWeights", false);
+  cases.push_back(registration);
+
+  BenchmarkCase fuse;
+  fuse.name = "Affine";
+  fuse.filterName = "FuseVolumes";
+  fuse.shuffle = false;
+  fuse.set("ReferenceVolume", QVariant::fromValue(referenceCells));
+  fuse.set("MovingVolume", QVariant::fromValue(movingCells));
+  fuse.set("TransformationType", 1);
+  cases.push_back(fuse);
+
+  // every shared feature is compared against every other, so large problems are skipped
+  BenchmarkCase orientations;
+  orientations.name = "Cubic";
+  orientations.filterName = "RegisterOrientations";
+  orientations.shuffle = false;
+  orientations.maxFeatures = 10000;
+  orientations.set("ReferenceAvgQuatsArrayPath", QVariant::fromValue(DataArrayPath("Reference", DREAM3D::Defaults::CellFeatureAttributeMatrixName, DREAM3D::FeatureData::AvgQuats)));
+  orientations.set("MovingAvgQuatsArrayPath", QVariant::fromValue(DataArrayPath("Moving", DREAM3D::Defaults::CellFeatureAttributeMatrixName, DREAM3D::FeatureData::AvgQuats)));
+  orientations.set("ReferencePhasesArrayPath", QVariant::fromValue(DataArrayPath("Reference", DREAM3D::Defaults::CellFeatureAttributeMatrixName, DREAM3D::FeatureData::Phases)));
+  orientations.set("MovingPhasesArrayPath", QVariant::fromValue(DataArrayPath("Moving", DREAM3D::Defaults::CellFeatureAttributeMatrixName, DREAM3D::FeatureData::Phases)));
+  orientations.set("ReferenceCrystalStructuresArrayPath", QVariant::fromValue(referenceEnsembles));
+  orientations.set("MovingCrystalStructuresArrayPath", QVariant::fromValue(movingEnsembles));
+  orientations.set("UseGoodFeatures", false);
+  cases.push_back(orientations);
+
+  BenchmarkCase track;
+  track.name = "Series";
+  track.filterName = "TrackFeatureIds";
+  track.volumes.clear();
+  track.volumes << "Step0" << "Step1" << "Step2" << "Step3";
+  track.set("DataContainerPrefix", QString("Step"));
+  cases.push_back(track);
+
+  BenchmarkCase field;
+  field.name = "Centroids";
+  field.filterName = "FitDisplacementField";
+  field.shuffle = false;
+  field.set("ReferenceCentroidsArrayPath", QVariant::fromValue(referenceCentroids));
+  field.set("MovingCentroidsArrayPath", QVariant::fromValue(movingCentroids));
+  field.set("UseGoodPoints", false);
+  field.set("UseTransformation", false);
+  field.set("SupportRadius", 3.0 * meanSize);
+  FloatVec3_t spacing;
+  spacing.x = spacing.y = spacing.z = meanSize;
+  field.set("GridSpacing", QVariant::fromValue(spacing));
+  cases.push_back(field);
+
+  BenchmarkCase voronoi;
+  voronoi.name = "Voronoi";
+  voronoi.filterName = "GenerateVoronoiVolumes";
+  voronoi.volumes.clear();
+  IntVec3_t dims;
+  dims.x = dims.y = dims.z = static_cast<int>(dim);
+  voronoi.set("Dimensions", QVariant::fromValue(dims));
+  voronoi.set("NumberOfFeatures", static_cast<int>(numFeatures));
+  voronoi.set("PositionNoise", 0.1 * meanSize);
+  voronoi.set("SplitFraction", 0.05);
+  voronoi.set("MergeFraction", 0.05);
+  cases.push_back(voronoi);
+
+  return cases;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QList<size_t> parseList(const QString& text)
+{
+  QList<size_t> values;
+  QStringList items = text.split(",", QString::SkipEmptyParts);
+  for(int i = 0; i < items.size(); i++)
+  {
+    bool ok = false;
+    size_t value = items[i].trimmed().toULongLong(&ok);
+    if(ok && value > 0) values.push_back(value);
+  }
+  return values;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int main(int argc, char** argv)
+{
+  QCoreApplication app(argc, argv);
+  QCoreApplication::setOrganizationName("");
+  QCoreApplication::setOrganizationDomain("");
+  QCoreApplication::setApplicationName("DataFusionBenchmarks");
+
+  QCommandLineParser parser;
+  parser.setApplicationDescription("Times the DataFusion filters on synthetic volumes");
+  parser.addHelpOption();
+  QCommandLineOption sizesOption("sizes", "Comma separated edge lengths of the cubic volumes.", "sizes", "64,256,1024");
+  QCommandLineOption featuresOption("features", "Comma separated (approximate) numbers of features.", "features", "1000,10000,100000,1000000");
+  QCommandLineOption jitterOption("jitter", "Maximum displacement of moving feature boundaries in voxels.", "voxels", "2");
+  QCommandLineOption repeatOption("repeat", "Number of times each case is run.", "count", "1");
+  QCommandLineOption seedOption("seed", "Random seed for the synthetic volumes.", "seed", "5489");
+  QCommandLineOption threadsOption("threads", "Number of threads (0 for automatic).", "threads", "0");
+  QCommandLineOption filterOption("filter", "Only run cases of this filter.", "filter", "");
+  QCommandLineOption outputOption("output", "JSON output file (standard output if empty).", "file", "");
+  parser.addOption(sizesOption);
+  parser.addOption(featuresOption);
+  parser.addOption(jitterOption);
+  parser.addOption(repeatOption);
+  parser.addOption(seedOption);
+  parser.addOption(threadsOption);
+  parser.addOption(filterOption);
+  parser.addOption(outputOption);
+  parser.process(app);
+
+  QList<size_t> sizes = parseList(parser.value(sizesOption));
+  QList<size_t> features = parseList(parser.value(featuresOption));
+  int jitter = parser.value(jitterOption).toInt();
+  int repeat = std::max(1, parser.value(repeatOption).toInt());
+  unsigned int seed = parser.value(seedOption).toUInt();
+  int threads = parser.value(threadsOption).toInt();
+  QString filterName = parser.value(filterOption);
+
+#ifdef SIMPLib_USE_PARALLEL_ALGORITHMS
+  tbb::task_scheduler_init init(threads > 0 ? threads : tbb::task_scheduler_init::automatic);
+  if(threads <= 0) threads = tbb::task_scheduler_init::default_num_threads();
+#else
+  threads = 1;
+#endif
+
+  // Register all the filters including trying to load those from Plugins
+  FilterManager* fm = FilterManager::Instance();
+  SIMPLibPluginLoader::LoadPluginFilters(fm);
+  QMetaObjectUtilities::RegisterMetaTypes();
+
+  QJsonArray runs;
+  QTextStream err(stderr);
+  for(int s = 0; s < sizes.size(); s++)
+  {
+    for(int f = 0; f < features.size(); f++)
+    {
+      // features are the cells of a count^3 grid (at least 2 voxels wide on average)
+      size_t count = std::max<size_t>(1, static_cast<size_t>(std::round(std::cbrt(static_cast<double>(features[f])))));
+      if(2 * count > sizes[s])
+      {
+        err << "skipping " << features[f] << " features in a " << sizes[s] << "^3 volume\n";
+        continue;
+      }
+      QList<BenchmarkCase> cases = benchmarkCases(sizes[s], count * count * count, static_cast<float>(sizes[s]) / count);
+
+      for(int c = 0; c < cases.size(); c++)
+      {
+        if(!filterName.isEmpty() && cases[c].filterName != filterName) continue;
+        if(cases[c].maxFeatures > 0 && count * count * count > cases[c].maxFeatures) continue;
+        IFilterFactory::Pointer filterFactory = fm->getFactoryForFilter(cases[c].filterName);
+        if(NULL == filterFactory.get())
+        {
+          err << "filter " << cases[c].filterName << " isn't available\n";
+          continue;
+        }
+
+        for(int r = 0; r < repeat; r++)
+        {
+          err << cases[c].filterName << " (" << cases[c].name << "): " << sizes[s] << "^3 voxels, " << count * count * count << " features\n";
+          err.flush();
+
+          // filters modify their inputs so every run gets new volumes
+          QElapsedTimer timer;
+          timer.start();
+          DataContainerArray::Pointer dca = Synthetic::createDataContainerArray(cases[c].volumes, sizes[s], count, jitter, cases[c].shuffle, seed);
+          double generateSeconds = static_cast<double>(timer.nsecsElapsed()) * 1.0e-9;
+
+          AbstractFilter::Pointer filter = filterFactory->create();
+          filter->setDataContainerArray(dca);
+          for(int p = 0; p < cases[c].properties.size(); p++)
+          {
+            if(!filter->setProperty(cases[c].properties[p].first.toLatin1().data(), cases[c].properties[p].second))
+              err << "unable to set " << cases[c].properties[p].first << "\n";
+          }
+
+          PhaseTimer phaseTimer;
+          QObject::connect(filter.get(), SIGNAL(filterGeneratedMessage(const PipelineMessage&)), &phaseTimer, SLOT(processPipelineMessage(const PipelineMessage&)));
+          timer.restart();
+          phaseTimer.start();
+          filter->execute();
+          phaseTimer.stop();
+          double executeSeconds = static_cast<double>(timer.nsecsElapsed()) * 1.0e-9;
+
+          QJsonObject run;
+          run["filter"] = cases[c].filterName;
+          run["case"] = cases[c].name;
+          run["dimension"] = static_cast<double>(sizes[s]);
+          run["voxels"] = static_cast<double>(sizes[s] * sizes[s] * sizes[s]);
+          run["features"] = static_cast<double>(count * count * count);
+          run["repetition"] = r;
+          run["errorCondition"] = filter->getErrorCondition();
+          run["generateSeconds"] = generateSeconds;
+          run["executeSeconds"] = executeSeconds;
+          run["phases"] = phaseTimer.phases();
+          runs.append(run);
+        }
+      }
+    }
+  }
+
+  QJsonObject results;
+  results["date"] = QDateTime::currentDateTime().toString(Qt::ISODate);
+  results["threads"] = threads;
+  results["seed"] = static_cast<double>(seed);
+  results["jitter"] = jitter;
+  results["runs"] = runs;
+  QByteArray json = QJsonDocument(results).toJson();
+
+  QString outputPath = parser.value(outputOption);
+  if(outputPath.isEmpty())
+  {
+    QTextStream out(stdout);
+    out << json;
+  }
+  else
+  {
+    QFile file(outputPath);
+    if(!file.open(QIODevice::WriteOnly))
+    {
+      err << "unable to write " << outputPath << "\n";
+      return EXIT_FAILURE;
+    }
+    file.write(json);
+  }
+  return EXIT_SUCCESS;
+}
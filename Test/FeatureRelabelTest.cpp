@@ -0,0 +1,151 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ *                                                                             *
+ * Copyright (c) 2015 William Lenthe                                           *
+ *                                                                             *
+ * This program is free software: you can redistribute it and/or modify        *
+ * it under the terms of the GNU Lesser General Public License as published by *
+ * the Free Software Foundation, either version 3 of the License, or           *
+ * (at your option) any later version.                                         *
+ *                                                                             *
+ * This program is distributed in the hope that it will be useful,             *
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of              *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the               *
+ * GNU Lesser General Public License for more details.                         *
+ *                                                                             *
+ * You should have received a copy of the GNU Lesser General Public License    *
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.       *
+ *                                                                             *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#include <QtCore/QCoreApplication>
+
+#include <vector>
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/Common/SIMPLibSetGetMacros.h"
+#include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/DataArrays/NeighborList.hpp"
+#include "SIMPLib/DataContainers/AttributeMatrix.h"
+#include "SIMPLib/Utilities/UnitTestSupport.hpp"
+
+#include "DataFusion/DataFusionFilters/util/FeatureRelabel.h"
+
+#include "DataFusionTestFileLocations.h"
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int ReorderFeaturesTest()
+{
+  //5 features renumbered to 7 (new ids 4 and 6 aren't the target of any old feature), the map has a cycle 1 -> 3 -> 5 and a swap 2 <-> 4
+  const size_t numOld = 5;
+  const size_t numNew = 7;
+  size_t map[] = {0, 3, 4, 5, 2};
+  std::vector<size_t> idMap(map, map + numOld);
+
+  //create feature data: a multi component array, a bool array (permuted in place), and a neighbor list (reordered by copy)
+  QVector<size_t> tDims(1, numOld);
+  QVector<size_t> cDims(1, 3);
+  AttributeMatrix::Pointer featAm = AttributeMatrix::New(tDims, DREAM3D::Defaults::CellFeatureAttributeMatrixName, DREAM3D::AttributeMatrixType::CellFeature);
+  DataArray<float>::Pointer centroids = DataArray<float>::CreateArray(tDims, cDims, "Centroids");
+  cDims[0] = 1;
+  DataArray<bool>::Pointer active = DataArray<bool>::CreateArray(tDims, cDims, "Active");
+  NeighborList<int32_t>::Pointer neighbors = NeighborList<int32_t>::CreateArray(numOld, "Neighbors");
+  for(size_t i = 0; i < numOld; i++) {
+    for(size_t k = 0; k < 3; k++) {
+      centroids->setComponent(i, k, static_cast<float>(10 * i + k));
+    }
+    active->setValue(i, 1 == i % 2);
+    NeighborList<int32_t>::SharedVectorType list(new std::vector<int32_t>);
+    for(size_t j = 0; j < i; j++) {
+      list->push_back(static_cast<int32_t>(10 * i + j));
+    }
+    neighbors->setList(static_cast<int>(i), list);
+  }
+  featAm->addAttributeArray(centroids->getName(), centroids);
+  featAm->addAttributeArray(active->getName(), active);
+  featAm->addAttributeArray(neighbors->getName(), neighbors);
+
+  FeatureRelabel::reorderFeatures(featAm, idMap, numNew);
+  DREAM3D_REQUIRE_EQUAL(featAm->getNumTuples(), numNew)
+
+  DataArray<float>* pCentroids = DataArray<float>::SafePointerDownCast(featAm->getAttributeArray("Centroids").get());
+  DataArray<bool>* pActive = DataArray<bool>::SafePointerDownCast(featAm->getAttributeArray("Active").get());
+  NeighborList<int32_t>* pNeighbors = NeighborList<int32_t>::SafePointerDownCast(featAm->getAttributeArray("Neighbors").get());
+  DREAM3D_REQUIRE_VALID_POINTER(pCentroids)
+  DREAM3D_REQUIRE_VALID_POINTER(pActive)
+  DREAM3D_REQUIRE_VALID_POINTER(pNeighbors)
+  DREAM3D_REQUIRE_EQUAL(pCentroids->getNumberOfTuples(), numNew)
+  DREAM3D_REQUIRE_EQUAL(pActive->getNumberOfTuples(), numNew)
+  DREAM3D_REQUIRE_EQUAL(pNeighbors->getNumberOfTuples(), numNew)
+
+  //every old feature moved to its new id
+  for(size_t i = 0; i < numOld; i++) {
+    size_t j = idMap[i];
+    for(size_t k = 0; k < 3; k++) {
+      DREAM3D_REQUIRE_EQUAL(pCentroids->getComponent(j, k), static_cast<float>(10 * i + k))
+    }
+    DREAM3D_REQUIRE_EQUAL(pActive->getValue(j), 1 == i % 2)
+    DREAM3D_REQUIRE_EQUAL(pNeighbors->getListSize(static_cast<int>(j)), static_cast<int>(i))
+    for(size_t n = 0; n < i; n++) {
+      DREAM3D_REQUIRE_EQUAL(pNeighbors->getList(static_cast<int>(j))->at(n), static_cast<int32_t>(10 * i + n))
+    }
+  }
+
+  //new ids without an old feature are empty
+  size_t holes[] = {1, 6};
+  for(size_t h = 0; h < 2; h++) {
+    for(size_t k = 0; k < 3; k++) {
+      DREAM3D_REQUIRE_EQUAL(pCentroids->getComponent(holes[h], k), 0.0f)
+    }
+    DREAM3D_REQUIRE_EQUAL(pActive->getValue(holes[h]), false)
+    DREAM3D_REQUIRE_EQUAL(pNeighbors->getListSize(static_cast<int>(holes[h])), 0)
+  }
+
+  return EXIT_SUCCESS;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int RelabelTest()
+{
+  //relabeling from runs and voxel by voxel gives the same ids
+  const size_t rowLength = 6;
+  const size_t numRows = 3;
+  int32_t ids[] = {1, 1, 2, 2, 2, 0, 3, 3, 3, 3, 1, 1, 0, 2, 2, 3, 3, 3};
+  size_t map[] = {0, 2, 3, 1};
+  std::vector<size_t> idMap(map, map + 4);
+
+  std::vector<int32_t> flatIds(ids, ids + rowLength * numRows);
+  std::vector<int32_t> runIds(flatIds);
+  RowRuns runs;
+  runs.encode(&runIds[0], rowLength, numRows);
+  FeatureRelabel::relabel(&flatIds[0], flatIds.size(), idMap);
+  FeatureRelabel::relabel(&runIds[0], runs, idMap);
+  for(size_t i = 0; i < flatIds.size(); i++) {
+    DREAM3D_REQUIRE_EQUAL(flatIds[i], static_cast<int32_t>(idMap[ids[i]]))
+    DREAM3D_REQUIRE_EQUAL(runIds[i], flatIds[i])
+  }
+
+  return EXIT_SUCCESS;
+}
+
+// -----------------------------------------------------------------------------
+//  Use test framework
+// -----------------------------------------------------------------------------
+int main(int argc, char** argv)
+{
+  // Instantiate the QCoreApplication that we need to get the current path and load plugins.
+  QCoreApplication app(argc, argv);
+  QCoreApplication::setOrganizationName("");
+  QCoreApplication::setOrganizationDomain("");
+  QCoreApplication::setApplicationName("FeatureRelabelTest");
+
+  int err = EXIT_SUCCESS;
+  DREAM3D_REGISTER_TEST( ReorderFeaturesTest() )
+  DREAM3D_REGISTER_TEST( RelabelTest() )
+
+  PRINT_TEST_SUMMARY();
+  return err;
+}
@@ -0,0 +1,267 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ *                                                                             *
+ * Copyright (c) 2015 William Lenthe                                           *
+ *                                                                             *
+ * This program is free software: you can redistribute it and/or modify        *
+ * it under the terms of the GNU Lesser General Public License as published by *
+ * the Free Software Foundation, either version 3 of the License, or           *
+ * (at your option) any later version.                                         *
+ *                                                                             *
+ * This program is distributed in the hope that it will be useful,             *
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of              *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the               *
+ * GNU Lesser General Public License for more details.                         *
+ *                                                                             *
+ * You should have received a copy of the GNU Lesser General Public License    *
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.       *
+ *                                                                             *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#include <QtCore/QCoreApplication>
+#include <QtCore/QFile>
+
+#include <cmath>
+#include <random>
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/Common/SIMPLibSetGetMacros.h"
+#include "SIMPLib/Common/Constants.h"
+#include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/Common/FilterPipeline.h"
+#include "SIMPLib/Common/FilterManager.h"
+#include "SIMPLib/Common/FilterFactory.hpp"
+#include "SIMPLib/Plugin/ISIMPLibPlugin.h"
+#include "SIMPLib/Plugin/SIMPLibPluginLoader.h"
+#include "SIMPLib/Utilities/UnitTestSupport.hpp"
+#include "SIMPLib/Utilities/QMetaObjectUtilities.h"
+
+#include "DataFusionTestFileLocations.h"
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int TestFilterAvailability()
+{
+  // Now instantiate the FitDisplacementField Filter from the FilterManager
+  QString filtName = "FitDisplacementField";
+  FilterManager* fm = FilterManager::Instance();
+  IFilterFactory::Pointer filterFactory = fm->getFactoryForFilter(filtName);
+  if (NULL == filterFactory.get())
+  {
+    std::stringstream ss;
+    ss << "The FitDisplacementFieldTest Requires the use of the " << filtName.toStdString() << " filter which is found in the DataFusion Plugin";
+    DREAM3D_TEST_THROW_EXCEPTION(ss.str())
+  }
+  return 0;
+}
+
+// -----------------------------------------------------------------------------
+// smooth non-rigid distortion (moving -> reference) of a 100^3 volume
+// -----------------------------------------------------------------------------
+void distortion(const float* position, float* displacement)
+{
+  const float k = static_cast<float>(SIMPLib::Constants::k_Pi / 100.0);
+  displacement[0] = 2.0f * std::sin(position[1] * k);
+  displacement[1] = 1.5f * std::cos(position[2] * k);
+  displacement[2] = std::sin(2.0f * position[0] * k);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int FitDisplacementFieldTest()
+{
+  //test procedure:
+  //-scatter control points through a 100^3 reference volume
+  //-moving points are the reference points with a smooth distortion and a translation removed (moving volume has a different origin)
+  //-fit the residual of the translation on a 10^3 grid and compare to the distortion away from the edges (where there are control points on all sides)
+  static const size_t numPoints = 2000;
+  const float translation[3] = {5.0f, -3.0f, 2.0f};
+  float movingOrigin[3] = {2.0f, 3.0f, 4.0f};
+
+  QVector<size_t> tDims(1, numPoints);
+  QVector<size_t> cDims(1, 3);
+  DataArray<float>::Pointer pReferencePoints = DataArray<float>::CreateArray(tDims, cDims, "Centroids");
+  DataArray<float>::Pointer pMovingPoints = DataArray<float>::CreateArray(tDims, cDims, "Centroids");
+  float* refPoints = pReferencePoints->getPointer(0);
+  float* movPoints = pMovingPoints->getPointer(0);
+  std::mt19937 generator(5489);
+  std::uniform_real_distribution<float> distribution(0.0f, 100.0f);
+  for(size_t i = 0; i < numPoints; i++)
+  {
+    float* p = refPoints + 3 * i;
+    for(size_t j = 0; j < 3; j++)
+      p[j] = distribution(generator);
+    float d[3];
+    distortion(p, d);
+    for(size_t j = 0; j < 3; j++)
+      movPoints[3 * i + j] = p[j] - d[j] - translation[j] - movingOrigin[j];
+  }
+
+  //moving -> reference transformation (pure translation)
+  QVector<size_t> transDims(2, 4);
+  DataArray<float>::Pointer pTransformation = DataArray<float>::CreateArray(QVector<size_t>(1, 1), transDims, "Transformation");
+  float* transformation = pTransformation->getPointer(0);
+  std::fill(transformation, transformation + 16, 0.0f);
+  for(size_t i = 0; i < 4; i++)
+    transformation[5 * i] = 1.0f;
+  for(size_t i = 0; i < 3; i++)
+    transformation[4 * i + 3] = translation[i];
+
+  //create + fill data containers
+  size_t volumeDims[3] = {100, 100, 100};
+  float resolution[3] = {1.0f, 1.0f, 1.0f};
+  float referenceOrigin[3] = {0.0f, 0.0f, 0.0f};
+
+  AttributeMatrix::Pointer refAm = AttributeMatrix::New(tDims, DREAM3D::Defaults::CellFeatureAttributeMatrixName, DREAM3D::AttributeMatrixType::CellFeature);
+  refAm->addAttributeArray(pReferencePoints->getName(), pReferencePoints);
+  AttributeMatrix::Pointer transAm = AttributeMatrix::New(QVector<size_t>(1, 1), "Transformation", DREAM3D::AttributeMatrixType::MetaData);
+  transAm->addAttributeArray(pTransformation->getName(), pTransformation);
+  ImageGeom::Pointer refImage = ImageGeom::CreateGeometry(DREAM3D::Geometry::ImageGeometry);
+  refImage->setDimensions(volumeDims);
+  refImage->setResolution(resolution);
+  refImage->setOrigin(referenceOrigin);
+  DataContainer::Pointer refDC = DataContainer::New("Reference");
+  refDC->setGeometry(refImage);
+  refDC->addAttributeMatrix(refAm->getName(), refAm);
+  refDC->addAttributeMatrix(transAm->getName(), transAm);
+
+  AttributeMatrix::Pointer movAm = AttributeMatrix::New(tDims, DREAM3D::Defaults::CellFeatureAttributeMatrixName, DREAM3D::AttributeMatrixType::CellFeature);
+  movAm->addAttributeArray(pMovingPoints->getName(), pMovingPoints);
+  ImageGeom::Pointer movImage = ImageGeom::CreateGeometry(DREAM3D::Geometry::ImageGeometry);
+  movImage->setDimensions(volumeDims);
+  movImage->setResolution(resolution);
+  movImage->setOrigin(movingOrigin);
+  DataContainer::Pointer movDC = DataContainer::New("Moving");
+  movDC->setGeometry(movImage);
+  movDC->addAttributeMatrix(movAm->getName(), movAm);
+
+  DataContainerArray::Pointer dca = DataContainerArray::New();
+  dca->addDataContainer(refDC);
+  dca->addDataContainer(movDC);
+
+  //create fit displacement field filter and execute
+  QString filtName = "FitDisplacementField";
+  FilterManager* fm = FilterManager::Instance();
+  IFilterFactory::Pointer filterFactory = fm->getFactoryForFilter(filtName);
+  if(NULL != filterFactory.get())
+  {
+    //create filter and set parameters
+    AbstractFilter::Pointer filter = filterFactory->create();
+    filter->setDataContainerArray(dca);
+
+    QVariant var;
+    bool propWasSet;
+    DataArrayPath path;
+
+    var.setValue(false);
+    propWasSet = filter->setProperty("UseGoodPoints", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    var.setValue(true);
+    propWasSet = filter->setProperty("UseTransformation", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    var.setValue(30.0);
+    propWasSet = filter->setProperty("SupportRadius", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    var.setValue(0.01);
+    propWasSet = filter->setProperty("Regularization", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    FloatVec3_t spacing;
+    spacing.x = 10.0f;
+    spacing.y = 10.0f;
+    spacing.z = 10.0f;
+    var.setValue(spacing);
+    propWasSet = filter->setProperty("GridSpacing", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    path.update(refDC->getName(), refAm->getName(), pReferencePoints->getName());
+    var.setValue(path);
+    propWasSet = filter->setProperty("ReferenceCentroidsArrayPath", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    path.update(movDC->getName(), movAm->getName(), pMovingPoints->getName());
+    var.setValue(path);
+    propWasSet = filter->setProperty("MovingCentroidsArrayPath", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    path.update(refDC->getName(), transAm->getName(), pTransformation->getName());
+    var.setValue(path);
+    propWasSet = filter->setProperty("TransformationArrayPath", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    //execute filter and check output
+    filter->execute();
+    DREAM3D_REQUIRED(filter->getErrorCondition(), >= , 0);
+
+    DataContainer::Pointer fieldDC = dca->getDataContainer("DisplacementField");
+    DREAM3D_REQUIRE_VALID_POINTER(fieldDC.get())
+    size_t gridDims[3] = {0, 0, 0};
+    fieldDC->getGeometryAs<ImageGeom>()->getDimensions(gridDims);
+    for(size_t i = 0; i < 3; i++)
+      DREAM3D_REQUIRE_EQUAL(gridDims[i], 10)
+
+    IDataArray::Pointer iDisplacements = fieldDC->getAttributeMatrix(DREAM3D::Defaults::CellAttributeMatrixName)->getAttributeArray("Displacements");
+    DataArray<float>* pDisplacements = DataArray<float>::SafePointerDownCast(iDisplacements.get());
+    DREAM3D_REQUIRE_VALID_POINTER(pDisplacements)
+    float* displacements = pDisplacements->getPointer(0);
+
+    //compare cell centers at least a support radius from the edges of the volume
+    for(size_t z = 3; z < 7; z++) {
+      for(size_t y = 3; y < 7; y++) {
+        for(size_t x = 3; x < 7; x++) {
+          const float center[3] = {10.0f * x + 5.0f, 10.0f * y + 5.0f, 10.0f * z + 5.0f};
+          float expected[3];
+          distortion(center, expected);
+          const float* d = displacements + 3 * ((z * 10 + y) * 10 + x);
+          for(size_t j = 0; j < 3; j++)
+            DREAM3D_REQUIRED(std::fabs(d[j] - expected[j]), <, 0.2f)
+        }
+      }
+    }
+  }
+  else
+  {
+    QString ss = QObject::tr("FitDisplacementFieldTest Error creating filter '%1'. Filter was not created/executed. Please notify the developers.").arg(filtName);
+    DREAM3D_TEST_THROW_EXCEPTION(ss.toStdString())
+  }
+
+  return EXIT_SUCCESS;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void loadFilterPlugins()
+{
+  // Register all the filters including trying to load those from Plugins
+  FilterManager* fm = FilterManager::Instance();
+  SIMPLibPluginLoader::LoadPluginFilters(fm);
+
+  // Send progress messages from PipelineBuilder to this object for display
+  QMetaObjectUtilities::RegisterMetaTypes();
+}
+
+// -----------------------------------------------------------------------------
+//  Use test framework
+// -----------------------------------------------------------------------------
+int main(int argc, char** argv)
+{
+  // Instantiate the QCoreApplication that we need to get the current path and load plugins.
+  QCoreApplication app(argc, argv);
+  QCoreApplication::setOrganizationName("");
+  QCoreApplication::setOrganizationDomain("");
+  QCoreApplication::setApplicationName("FitDisplacementFieldTest");
+
+  int err = EXIT_SUCCESS;
+  DREAM3D_REGISTER_TEST( loadFilterPlugins() );
+  DREAM3D_REGISTER_TEST( TestFilterAvailability() );
+
+  DREAM3D_REGISTER_TEST( FitDisplacementFieldTest() )
+
+  PRINT_TEST_SUMMARY();
+  return err;
+}
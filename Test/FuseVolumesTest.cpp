@@ -225,6 +225,179 @@ int FuseVolumesTestTest()
   return EXIT_SUCCESS;
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int FuseVolumesDisplacementFieldTest()
+{
+  //test procedure:
+  //-create a moving volume of single voxel features and 2 empty reference volumes with the same grid
+  //-fuse into the first reference with a manual translation
+  //-fuse into the second reference with an identity transformation and a coarse displacement field holding the same translation everywhere
+  //-both fused volumes should be the moving volume shifted by the translation
+
+  static const size_t dX = 12, dY = 10, dZ = 8;
+  const float shift[3] = {2.0f, -1.0f, 3.0f};//moving -> reference
+
+  QVector<size_t> dims(3);
+  dims[0] = dX;
+  dims[1] = dY;
+  dims[2] = dZ;
+  QVector<size_t> cDims(1, 1);
+  DataArray<int32_t>::Pointer pMovingIds = DataArray<int32_t>::CreateArray(dims, cDims, "FeatureIds");
+  int32_t* movingIds = pMovingIds->getPointer(0);
+  for(size_t i = 0; i < dX * dY * dZ; i++)
+    movingIds[i] = static_cast<int32_t>(i + 1);
+
+  float origin[3] = {0.0f, 0.0f, 0.0f};
+  float res[3] = {1.0f, 1.0f, 1.0f};
+  DataContainerArray::Pointer dca = DataContainerArray::New();
+
+  AttributeMatrix::Pointer movAm = AttributeMatrix::New(dims, "MovingCellData", DREAM3D::AttributeMatrixType::Cell);
+  movAm->addAttributeArray(pMovingIds->getName(), pMovingIds);
+  ImageGeom::Pointer movImage = ImageGeom::CreateGeometry(DREAM3D::Geometry::ImageGeometry);
+  movImage->setDimensions(dims.data());
+  movImage->setResolution(res);
+  movImage->setOrigin(origin);
+  DataContainer::Pointer movDC = DataContainer::New("MovingData");
+  movDC->setGeometry(movImage);
+  movDC->addAttributeMatrix(movAm->getName(), movAm);
+  dca->addDataContainer(movDC);
+
+  //reference volumes (same grid as the moving volume)
+  QStringList refNames;
+  refNames << "AffineData" << "FieldData";
+  for(int r = 0; r < refNames.size(); r++)
+  {
+    AttributeMatrix::Pointer refAm = AttributeMatrix::New(dims, "ReferenceCellData", DREAM3D::AttributeMatrixType::Cell);
+    ImageGeom::Pointer refImage = ImageGeom::CreateGeometry(DREAM3D::Geometry::ImageGeometry);
+    refImage->setDimensions(dims.data());
+    refImage->setResolution(res);
+    refImage->setOrigin(origin);
+    DataContainer::Pointer refDC = DataContainer::New(refNames[r]);
+    refDC->setGeometry(refImage);
+    refDC->addAttributeMatrix(refAm->getName(), refAm);
+    dca->addDataContainer(refDC);
+  }
+
+  //coarse displacement field covering (and extending past) the reference volume with the shift everywhere
+  QVector<size_t> fieldDims(3, 3);
+  QVector<size_t> fieldComps(1, 3);
+  DataArray<float>::Pointer pField = DataArray<float>::CreateArray(fieldDims, fieldComps, "Displacements");
+  for(size_t i = 0; i < pField->getNumberOfTuples(); i++)
+    for(size_t j = 0; j < 3; j++)
+      pField->setComponent(i, j, shift[j]);
+  AttributeMatrix::Pointer fieldAm = AttributeMatrix::New(fieldDims, "DisplacementData", DREAM3D::AttributeMatrixType::Cell);
+  fieldAm->addAttributeArray(pField->getName(), pField);
+  float fieldOrigin[3] = {-2.0f, -2.0f, -2.0f};
+  float fieldRes[3] = {6.0f, 5.0f, 4.0f};
+  ImageGeom::Pointer fieldImage = ImageGeom::CreateGeometry(DREAM3D::Geometry::ImageGeometry);
+  fieldImage->setDimensions(fieldDims.data());
+  fieldImage->setResolution(fieldRes);
+  fieldImage->setOrigin(fieldOrigin);
+  DataContainer::Pointer fieldDC = DataContainer::New("DisplacementField");
+  fieldDC->setGeometry(fieldImage);
+  fieldDC->addAttributeMatrix(fieldAm->getName(), fieldAm);
+  dca->addDataContainer(fieldDC);
+
+  QString filtName = "FuseVolumes";
+  FilterManager* fm = FilterManager::Instance();
+  IFilterFactory::Pointer filterFactory = fm->getFactoryForFilter(filtName);
+  if(NULL != filterFactory.get())
+  {
+    QString prefix("prefix_");
+    for(int r = 0; r < refNames.size(); r++)
+    {
+      const bool useField = 1 == r;
+      AbstractFilter::Pointer filter = filterFactory->create();
+      filter->setDataContainerArray(dca);
+
+      QVariant var;
+      bool propWasSet;
+      DataArrayPath path;
+
+      //affine translation or identity (the field supplies the translation)
+      std::vector< std::vector<double> > transform(3, std::vector<double>(4, 0));
+      for(size_t i = 0; i < 3; i++)
+      {
+        transform[i][i] = 1.0;
+        transform[i][3] = useField ? 0.0 : shift[i];
+      }
+      DynamicTableData tableData;
+      tableData.setTableData(transform);
+
+      var.setValue(prefix);
+      propWasSet = filter->setProperty("Prefix", var);
+      DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+      var.setValue(1);//0: computed value, 1: manual entry
+      propWasSet = filter->setProperty("TransformationType", var);
+      DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+      var.setValue(tableData);
+      propWasSet = filter->setProperty("ManualTransformation", var);
+      DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+      var.setValue(useField);
+      propWasSet = filter->setProperty("UseDisplacementField", var);
+      DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+      path.update(fieldDC->getName(), fieldAm->getName(), pField->getName());
+      var.setValue(path);
+      propWasSet = filter->setProperty("DisplacementFieldArrayPath", var);
+      DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+      path.update(refNames[r], "ReferenceCellData", "");
+      var.setValue(path);
+      propWasSet = filter->setProperty("ReferenceVolume", var);
+      DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+      path.update(movDC->getName(), movAm->getName(), "");
+      var.setValue(path);
+      propWasSet = filter->setProperty("MovingVolume", var);
+      DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+      filter->execute();
+      DREAM3D_REQUIRED(filter->getErrorCondition(), >= , 0);
+    }
+
+    //get both fused volumes
+    DataArray<int32_t>* pAffineIds = DataArray<int32_t>::SafePointerDownCast(dca->getDataContainer(refNames[0])->getAttributeMatrix("ReferenceCellData")->getAttributeArray(prefix + pMovingIds->getName()).get());
+    DataArray<int32_t>* pFieldIds = DataArray<int32_t>::SafePointerDownCast(dca->getDataContainer(refNames[1])->getAttributeMatrix("ReferenceCellData")->getAttributeArray(prefix + pMovingIds->getName()).get());
+    DREAM3D_REQUIRE_VALID_POINTER(pAffineIds)
+    DREAM3D_REQUIRE_VALID_POINTER(pFieldIds)
+    int32_t* affineIds = pAffineIds->getPointer(0);
+    int32_t* fieldIds = pFieldIds->getPointer(0);
+
+    //the field should reproduce the affine fusion everywhere
+    for(size_t i = 0; i < pAffineIds->getNumberOfTuples(); i++) {
+      DREAM3D_REQUIRE_EQUAL(affineIds[i], fieldIds[i])
+    }
+
+    //and the affine fusion should be the shifted moving volume (reference voxel p holds moving voxel p - shift, 0 outside the moving volume)
+    for(size_t k = 0; k < dZ - 1; k++) {
+      for(size_t j = 0; j < dY - 1; j++) {
+        for(size_t i = 0; i < dX - 1; i++) {
+          const int x = static_cast<int>(i) - static_cast<int>(shift[0]);
+          const int y = static_cast<int>(j) - static_cast<int>(shift[1]);
+          const int z = static_cast<int>(k) - static_cast<int>(shift[2]);
+          int32_t expected = 0;
+          if(x >= 0 && y >= 0 && z >= 0 && x < static_cast<int>(dX) && y < static_cast<int>(dY) && z < static_cast<int>(dZ))
+            expected = movingIds[(z * dY + y) * dX + x];
+          DREAM3D_REQUIRE_EQUAL(expected, affineIds[(k * dY + j) * dX + i])
+        }
+      }
+    }
+  }
+  else
+  {
+    QString ss = QObject::tr("FuseVolumesTest Error creating filter '%1'. Filter was not created/executed. Please notify the developers.").arg(filtName);
+    DREAM3D_TEST_THROW_EXCEPTION(ss.toStdString())
+  }
+
+  return EXIT_SUCCESS;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -254,6 +427,7 @@ int main(int argc, char** argv)
   DREAM3D_REGISTER_TEST( TestFilterAvailability() );
 
   DREAM3D_REGISTER_TEST( FuseVolumesTestTest() )
+  DREAM3D_REGISTER_TEST( FuseVolumesDisplacementFieldTest() )
 
   PRINT_TEST_SUMMARY();
   return err;
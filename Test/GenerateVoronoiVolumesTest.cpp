@@ -0,0 +1,237 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ *                                                                             *
+ * Copyright (c) 2015 William Lenthe                                           *
+ *                                                                             *
+ * This program is free software: you can redistribute it and/or modify        *
+ * it under the terms of the GNU Lesser General Public License as published by *
+ * the Free Software Foundation, either version 3 of the License, or           *
+ * (at your option) any later version.                                         *
+ *                                                                             *
+ * This program is distributed in the hope that it will be useful,             *
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of              *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the               *
+ * GNU Lesser General Public License for more details.                         *
+ *                                                                             *
+ * You should have received a copy of the GNU Lesser General Public License    *
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.       *
+ *                                                                             *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#include <QtCore/QCoreApplication>
+#include <QtCore/QFile>
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/Common/SIMPLibSetGetMacros.h"
+#include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/Common/FilterPipeline.h"
+#include "SIMPLib/Common/FilterManager.h"
+#include "SIMPLib/Common/FilterFactory.hpp"
+#include "SIMPLib/Plugin/ISIMPLibPlugin.h"
+#include "SIMPLib/Plugin/SIMPLibPluginLoader.h"
+#include "SIMPLib/Utilities/UnitTestSupport.hpp"
+#include "SIMPLib/Utilities/QMetaObjectUtilities.h"
+
+#include "DataFusionTestFileLocations.h"
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int TestFilterAvailability()
+{
+  QString filtName = "GenerateVoronoiVolumes";
+  FilterManager* fm = FilterManager::Instance();
+  IFilterFactory::Pointer filterFactory = fm->getFactoryForFilter(filtName);
+  if (NULL == filterFactory.get())
+  {
+    std::stringstream ss;
+    ss << "The GenerateVoronoiVolumesTest Requires the use of the " << filtName.toStdString() << " filter which is found in the DataFusion Plugin";
+    DREAM3D_TEST_THROW_EXCEPTION(ss.str())
+  }
+  return 0;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+DataArray<int32_t>* getIntArray(DataContainerArray::Pointer dca, const QString& dcName, const QString& amName, const QString& arrayName)
+{
+  IDataArray::Pointer iArray = dca->getDataContainer(dcName)->getAttributeMatrix(amName)->getAttributeArray(arrayName);
+  return DataArray<int32_t>::SafePointerDownCast(iArray.get());
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int GenerateVoronoiVolumesTest(double angle, double splitFraction, double mergeFraction)
+{
+  const int numFeatures = 200;
+  IntVec3_t dims;
+  dims.x = 40;
+  dims.y = 30;
+  dims.z = 20;
+  FloatVec3_t axis;
+  axis.x = 0.0f;
+  axis.y = 0.0f;
+  axis.z = 1.0f;
+  FloatVec3_t translation;
+  translation.x = 0 == angle ? 0.0f : 29.0f;
+  translation.y = 0.0f;
+  translation.z = 0.0f;
+
+  //create generate voronoi volumes filter and execute
+  DataContainerArray::Pointer dca = DataContainerArray::New();
+  QString filtName = "GenerateVoronoiVolumes";
+  FilterManager* fm = FilterManager::Instance();
+  IFilterFactory::Pointer filterFactory = fm->getFactoryForFilter(filtName);
+  if(NULL != filterFactory.get())
+  {
+    //create filter and set parameters
+    AbstractFilter::Pointer filter = filterFactory->create();
+    filter->setDataContainerArray(dca);
+
+    QVariant var;
+    bool propWasSet;
+
+    var.setValue(dims);
+    propWasSet = filter->setProperty("Dimensions", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    var.setValue(numFeatures);
+    propWasSet = filter->setProperty("NumberOfFeatures", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    var.setValue(axis);
+    propWasSet = filter->setProperty("RotationAxis", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    var.setValue(angle);
+    propWasSet = filter->setProperty("RotationAngle", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    var.setValue(translation);
+    propWasSet = filter->setProperty("Translation", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    var.setValue(splitFraction);
+    propWasSet = filter->setProperty("SplitFraction", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    var.setValue(mergeFraction);
+    propWasSet = filter->setProperty("MergeFraction", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    //execute filter and get output arrays
+    filter->execute();
+    DREAM3D_REQUIRED(filter->getErrorCondition(), >= , 0);
+
+    DataArray<int32_t>* pReferenceIds = getIntArray(dca, "Reference", DREAM3D::Defaults::CellAttributeMatrixName, DREAM3D::CellData::FeatureIds);
+    DataArray<int32_t>* pMovingIds = getIntArray(dca, "Moving", DREAM3D::Defaults::CellAttributeMatrixName, DREAM3D::CellData::FeatureIds);
+    DataArray<int32_t>* pGroundTruth = getIntArray(dca, "Moving", DREAM3D::Defaults::CellFeatureAttributeMatrixName, "GroundTruthIds");
+    DataArray<int32_t>* pMergedInto = getIntArray(dca, "Reference", DREAM3D::Defaults::CellFeatureAttributeMatrixName, "MergedIntoIds");
+    DREAM3D_REQUIRE_VALID_POINTER(pReferenceIds)
+    DREAM3D_REQUIRE_VALID_POINTER(pMovingIds)
+    DREAM3D_REQUIRE_VALID_POINTER(pGroundTruth)
+    DREAM3D_REQUIRE_VALID_POINTER(pMergedInto)
+    DREAM3D_REQUIRE_EQUAL(pReferenceIds->getNumberOfTuples(), dims.x * dims.y * dims.z)
+    DREAM3D_REQUIRE_EQUAL(dca->getDataContainer("Reference")->getAttributeMatrix(DREAM3D::Defaults::CellFeatureAttributeMatrixName)->getNumTuples(), numFeatures + 1)
+
+    //merged features absorb a neighbor and split features gain a fragment
+    size_t numMoving = numFeatures + static_cast<size_t>(numFeatures * splitFraction + 0.5) - static_cast<size_t>(numFeatures * mergeFraction + 0.5);
+    DREAM3D_REQUIRE_EQUAL(pGroundTruth->getNumberOfTuples(), numMoving + 1)
+
+    DataArray<float>* pTransformation = DataArray<float>::SafePointerDownCast(dca->getDataContainer("Moving")->getAttributeMatrix("Transformation")->getAttributeArray("Transformation").get());
+    DREAM3D_REQUIRE_VALID_POINTER(pTransformation)
+    float* transformation = pTransformation->getPointer(0);
+    DREAM3D_REQUIRE_EQUAL(transformation[15], 1.0f)
+
+    //every merged feature absorbed a feature that shares a face with it
+    int32_t* referenceIds = pReferenceIds->getPointer(0);
+    int32_t* movingIds = pMovingIds->getPointer(0);
+    int32_t* groundTruth = pGroundTruth->getPointer(0);
+    int32_t* mergedInto = pMergedInto->getPointer(0);
+    size_t numMerged = 0;
+    for(int32_t i = 1; i <= numFeatures; i++)
+    {
+      if(0 == mergedInto[i]) continue;
+      numMerged++;
+      bool adjacent = false;
+      for(int j = 0; j < dims.x * dims.y * dims.z && !adjacent; j++)
+      {
+        if(referenceIds[j] != i) continue;
+        int x = j % dims.x, y = (j / dims.x) % dims.y, z = j / (dims.x * dims.y);
+        adjacent = (x + 1 < dims.x && referenceIds[j + 1] == mergedInto[i]) || (x > 0 && referenceIds[j - 1] == mergedInto[i])
+                || (y + 1 < dims.y && referenceIds[j + dims.x] == mergedInto[i]) || (y > 0 && referenceIds[j - dims.x] == mergedInto[i])
+                || (z + 1 < dims.z && referenceIds[j + dims.x * dims.y] == mergedInto[i]) || (z > 0 && referenceIds[j - dims.x * dims.y] == mergedInto[i]);
+      }
+      DREAM3D_REQUIRE_EQUAL(adjacent, true)
+    }
+    DREAM3D_REQUIRE_EQUAL(numMerged, static_cast<size_t>(numFeatures * mergeFraction + 0.5))
+
+    //moving voxels belong to the ground truth feature of the reference voxel they're mapped onto (or the feature it was merged into)
+    size_t matches = 0, count = 0;
+    for(int z = 0; z < dims.z; z++)
+    {
+      for(int y = 0; y < dims.y; y++)
+      {
+        for(int x = 0; x < dims.x; x++)
+        {
+          int coords[3];
+          for(size_t i = 0; i < 3; i++)
+            coords[i] = static_cast<int>(std::floor(transformation[4 * i] * x + transformation[4 * i + 1] * y + transformation[4 * i + 2] * z + transformation[4 * i + 3] + 0.5f));
+          if(coords[0] < 0 || coords[1] < 0 || coords[2] < 0 || coords[0] >= dims.x || coords[1] >= dims.y || coords[2] >= dims.z) continue;
+          int32_t movingId = movingIds[(z * dims.y + y) * dims.x + x];
+          DREAM3D_REQUIRED(movingId, >, 0)
+          DREAM3D_REQUIRED(static_cast<size_t>(movingId), <=, numMoving)
+          count++;
+          int32_t referenceId = referenceIds[(coords[2] * dims.y + coords[1]) * dims.x + coords[0]];
+          if(groundTruth[movingId] == referenceId || groundTruth[movingId] == mergedInto[referenceId]) matches++;
+        }
+      }
+    }
+    DREAM3D_REQUIRED(count, >, 0)
+    DREAM3D_REQUIRE_EQUAL(matches, count)
+  }
+  else
+  {
+    QString ss = QObject::tr("GenerateVoronoiVolumesTest Error creating filter '%1'. Filter was not created/executed. Please notify the developers.").arg(filtName);
+    DREAM3D_TEST_THROW_EXCEPTION(ss.toStdString())
+  }
+
+  return EXIT_SUCCESS;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void loadFilterPlugins()
+{
+  // Register all the filters including trying to load those from Plugins
+  FilterManager* fm = FilterManager::Instance();
+  SIMPLibPluginLoader::LoadPluginFilters(fm);
+
+  // Send progress messages from PipelineBuilder to this object for display
+  QMetaObjectUtilities::RegisterMetaTypes();
+}
+
+// -----------------------------------------------------------------------------
+//  Use test framework
+// -----------------------------------------------------------------------------
+int main(int argc, char** argv)
+{
+  // Instantiate the QCoreApplication that we need to get the current path and load plugins.
+  QCoreApplication app(argc, argv);
+  QCoreApplication::setOrganizationName("");
+  QCoreApplication::setOrganizationDomain("");
+  QCoreApplication::setApplicationName("GenerateVoronoiVolumesTest");
+
+  int err = EXIT_SUCCESS;
+  DREAM3D_REGISTER_TEST( loadFilterPlugins() );
+  DREAM3D_REGISTER_TEST( TestFilterAvailability() );
+
+  DREAM3D_REGISTER_TEST( GenerateVoronoiVolumesTest(0.0, 0.0, 0.0) )
+  DREAM3D_REGISTER_TEST( GenerateVoronoiVolumesTest(90.0, 0.0, 0.0) )
+  DREAM3D_REGISTER_TEST( GenerateVoronoiVolumesTest(0.0, 0.2, 0.1) )
+
+  PRINT_TEST_SUMMARY();
+  return err;
+}
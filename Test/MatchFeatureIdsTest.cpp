@@ -20,9 +20,15 @@
 #include <QtCore/QCoreApplication>
 #include <QtCore/QFile>
 
+#include <algorithm>
+#include <map>
+#include <random>
+
 #include "SIMPLib/SIMPLib.h"
 #include "SIMPLib/Common/SIMPLibSetGetMacros.h"
+#include "SIMPLib/Common/Constants.h"
 #include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/DataArrays/NeighborList.hpp"
 #include "SIMPLib/Common/FilterPipeline.h"
 #include "SIMPLib/Common/FilterManager.h"
 #include "SIMPLib/Common/FilterFactory.hpp"
@@ -31,6 +37,12 @@
 #include "SIMPLib/Utilities/UnitTestSupport.hpp"
 #include "SIMPLib/Utilities/QMetaObjectUtilities.h"
 
+#include "SIMPLib/Math/QuaternionMath.hpp"
+#include "OrientationLib/SpaceGroupOps/SpaceGroupOps.h"
+
+#include "H5Support/QH5Lite.h"
+#include "H5Support/QH5Utilities.h"
+
 #include "DataFusionTestFileLocations.h"
 
 // -----------------------------------------------------------------------------
@@ -183,6 +195,1527 @@ int MatchFeatureIdsTest()
   return EXIT_SUCCESS;
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int MatchFeatureIdsOptimalTest()
+{
+  //moving feature 1 is most similar to reference feature 1 but the best total similarity matches it to reference feature 2
+  size_t dims[] = {9};
+  int32_t refID[] = {1, 1, 1, 1, 1, 1, 2, 2, 2};
+  int32_t movID[] = {2, 2, 1, 1, 1, 1, 1, 1, 1};
+  int32_t regID[] = {1, 1, 2, 2, 2, 2, 2, 2, 2};
+
+  //create cell data
+  QVector<size_t> tDims(1, dims[0]);
+  QVector<size_t> cDims(1, 1);
+  AttributeMatrix::Pointer cellAm = AttributeMatrix::New(tDims, DREAM3D::Defaults::CellAttributeMatrixName, DREAM3D::AttributeMatrixType::Cell);
+  DataArray<int32_t>::Pointer referenceIds = DataArray<int32_t>::CreateArray(tDims, cDims, "ReferenceFeatureIds");
+  DataArray<int32_t>::Pointer movingIds = DataArray<int32_t>::CreateArray(tDims, cDims, "MovingFeatureIds");
+  for(size_t i = 0; i < tDims[0]; i++) {
+    referenceIds->setValue(i, refID[i]);
+    movingIds->setValue(i, movID[i]);
+  }
+  cellAm->addAttributeArray(referenceIds->getName(), referenceIds);
+  cellAm->addAttributeArray(movingIds->getName(), movingIds);
+
+  //create (empty) cell feature data
+  tDims[0] = 3;
+  AttributeMatrix::Pointer refCellFeatAm = AttributeMatrix::New(tDims, "ReferenceCellFeatureData", DREAM3D::AttributeMatrixType::CellFeature);
+  AttributeMatrix::Pointer movCellFeatAm = AttributeMatrix::New(tDims, "MovingCellFeatureData", DREAM3D::AttributeMatrixType::CellFeature);
+
+  //fill a data container
+  ImageGeom::Pointer image = ImageGeom::CreateGeometry(DREAM3D::Geometry::ImageGeometry);
+  image->setDimensions(dims);
+  DataContainerArray::Pointer dca = DataContainerArray::New();
+  DataContainer::Pointer dc = DataContainer::New("dc");
+  dc->setGeometry(image);
+  dc->addAttributeMatrix(cellAm->getName(), cellAm);
+  dc->addAttributeMatrix(refCellFeatAm->getName(), refCellFeatAm);
+  dc->addAttributeMatrix(movCellFeatAm->getName(), movCellFeatAm);
+  dca->addDataContainer(dc);
+
+  //create match feature ids filter and execute
+  QString filtName = "MatchFeatureIds";
+  FilterManager* fm = FilterManager::Instance();
+  IFilterFactory::Pointer filterFactory = fm->getFactoryForFilter(filtName);
+  if(NULL != filterFactory.get())
+  {
+    //create filter and set parameters
+    AbstractFilter::Pointer filter = filterFactory->create();
+    filter->setDataContainerArray(dca);
+
+    QVariant var;
+    bool propWasSet;
+    DataArrayPath path;
+
+    var.setValue(1);
+    propWasSet = filter->setProperty("Metric", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    var.setValue(0.1);
+    propWasSet = filter->setProperty("MetricThreshold", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    var.setValue(1);//0: greedy, 1: optimal
+    propWasSet = filter->setProperty("MatchingMethod", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    var.setValue(false);
+    propWasSet = filter->setProperty("UseOrientations", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    path.update(dc->getName(), cellAm->getName(), referenceIds->getName());
+    var.setValue(path);
+    propWasSet = filter->setProperty("ReferenceFeatureIdsArrayPath", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    path.update(dc->getName(), cellAm->getName(), movingIds->getName());
+    var.setValue(path);
+    propWasSet = filter->setProperty("MovingFeatureIdsArrayPath", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    path.update(dc->getName(), refCellFeatAm->getName(), "");
+    var.setValue(path);
+    propWasSet = filter->setProperty("ReferenceCellFeatureAttributeMatrixPath", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    path.update(dc->getName(), movCellFeatAm->getName(), "");
+    var.setValue(path);
+    propWasSet = filter->setProperty("MovingCellFeatureAttributeMatrixPath", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    //execute filter and compare to expected ids (greedy matching would give {3, 3, 1, 1, 1, 1, 1, 1, 1})
+    filter->execute();
+    DREAM3D_REQUIRED(filter->getErrorCondition(), >= , 0);
+
+    IDataArray::Pointer iFeatureIds = dc->getAttributeMatrix(cellAm->getName())->getAttributeArray(movingIds->getName());
+    DataArray<int32_t>* pRegisteredIds = DataArray<int32_t>::SafePointerDownCast(iFeatureIds.get());
+    DREAM3D_REQUIRE_VALID_POINTER(pRegisteredIds)
+    int32_t* registeredIds = pRegisteredIds->getPointer(0);
+
+    for(size_t i = 0; i < dims[0]; i++) {
+      DREAM3D_REQUIRE_EQUAL(registeredIds[i], regID[i])
+    }
+  }
+  else
+  {
+    QString ss = QObject::tr("MatchFeatureIdsTest Error creating filter '%1'. Filter was not created/executed. Please notify the developers.").arg(filtName);
+    DREAM3D_TEST_THROW_EXCEPTION(ss.toStdString())
+  }
+
+  return EXIT_SUCCESS;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int MatchFeatureIdsSplitMergeTest()
+{
+  //reference feature 1 is split into moving features 1 and 2, only one fragment can be matched
+  size_t dims[] = {8};
+  int32_t refID[] = {1, 1, 1, 1, 2, 2, 2, 2};
+  int32_t movID[] = {1, 1, 2, 2, 3, 3, 3, 3};
+  int32_t regID[] = {3, 3, 1, 1, 2, 2, 2, 2};
+
+  //expected correspondences (moving lists are in the new moving order)
+  int32_t refGroups[] = {0, 1, 2};
+  int32_t movGroups[] = {0, 1, 2, 1};
+  int32_t refLists[][2] = {{0, 0}, {3, 1}, {2, 0}};
+  int32_t refListSizes[] = {0, 2, 1};
+  int32_t movLists[] = {0, 1, 2, 1};
+  int32_t movListSizes[] = {0, 1, 1, 1};
+
+  //create cell data
+  QVector<size_t> tDims(1, dims[0]);
+  QVector<size_t> cDims(1, 1);
+  AttributeMatrix::Pointer cellAm = AttributeMatrix::New(tDims, DREAM3D::Defaults::CellAttributeMatrixName, DREAM3D::AttributeMatrixType::Cell);
+  DataArray<int32_t>::Pointer referenceIds = DataArray<int32_t>::CreateArray(tDims, cDims, "ReferenceFeatureIds");
+  DataArray<int32_t>::Pointer movingIds = DataArray<int32_t>::CreateArray(tDims, cDims, "MovingFeatureIds");
+  for(size_t i = 0; i < tDims[0]; i++) {
+    referenceIds->setValue(i, refID[i]);
+    movingIds->setValue(i, movID[i]);
+  }
+  cellAm->addAttributeArray(referenceIds->getName(), referenceIds);
+  cellAm->addAttributeArray(movingIds->getName(), movingIds);
+
+  //create (empty) cell feature data
+  tDims[0] = 3;
+  AttributeMatrix::Pointer refCellFeatAm = AttributeMatrix::New(tDims, "ReferenceCellFeatureData", DREAM3D::AttributeMatrixType::CellFeature);
+  tDims[0] = 4;
+  AttributeMatrix::Pointer movCellFeatAm = AttributeMatrix::New(tDims, "MovingCellFeatureData", DREAM3D::AttributeMatrixType::CellFeature);
+
+  //fill a data container
+  ImageGeom::Pointer image = ImageGeom::CreateGeometry(DREAM3D::Geometry::ImageGeometry);
+  image->setDimensions(dims);
+  DataContainerArray::Pointer dca = DataContainerArray::New();
+  DataContainer::Pointer dc = DataContainer::New("dc");
+  dc->setGeometry(image);
+  dc->addAttributeMatrix(cellAm->getName(), cellAm);
+  dc->addAttributeMatrix(refCellFeatAm->getName(), refCellFeatAm);
+  dc->addAttributeMatrix(movCellFeatAm->getName(), movCellFeatAm);
+  dca->addDataContainer(dc);
+
+  //create match feature ids filter and execute
+  QString filtName = "MatchFeatureIds";
+  FilterManager* fm = FilterManager::Instance();
+  IFilterFactory::Pointer filterFactory = fm->getFactoryForFilter(filtName);
+  if(NULL != filterFactory.get())
+  {
+    //create filter and set parameters
+    AbstractFilter::Pointer filter = filterFactory->create();
+    filter->setDataContainerArray(dca);
+
+    QVariant var;
+    bool propWasSet;
+    DataArrayPath path;
+
+    var.setValue(1);
+    propWasSet = filter->setProperty("Metric", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    var.setValue(0.1);
+    propWasSet = filter->setProperty("MetricThreshold", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    var.setValue(false);
+    propWasSet = filter->setProperty("UseOrientations", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    var.setValue(true);
+    propWasSet = filter->setProperty("DetectSplitsMerges", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    var.setValue(0.75);
+    propWasSet = filter->setProperty("ContainmentThreshold", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    path.update(dc->getName(), cellAm->getName(), referenceIds->getName());
+    var.setValue(path);
+    propWasSet = filter->setProperty("ReferenceFeatureIdsArrayPath", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    path.update(dc->getName(), cellAm->getName(), movingIds->getName());
+    var.setValue(path);
+    propWasSet = filter->setProperty("MovingFeatureIdsArrayPath", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    path.update(dc->getName(), refCellFeatAm->getName(), "");
+    var.setValue(path);
+    propWasSet = filter->setProperty("ReferenceCellFeatureAttributeMatrixPath", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    path.update(dc->getName(), movCellFeatAm->getName(), "");
+    var.setValue(path);
+    propWasSet = filter->setProperty("MovingCellFeatureAttributeMatrixPath", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    //execute filter and get output arrays
+    filter->execute();
+    DREAM3D_REQUIRED(filter->getErrorCondition(), >= , 0);
+
+    IDataArray::Pointer iFeatureIds = dc->getAttributeMatrix(cellAm->getName())->getAttributeArray(movingIds->getName());
+    IDataArray::Pointer iRefGroups = dc->getAttributeMatrix(refCellFeatAm->getName())->getAttributeArray("CorrespondenceGroups");
+    IDataArray::Pointer iMovGroups = dc->getAttributeMatrix(movCellFeatAm->getName())->getAttributeArray("CorrespondenceGroups");
+    IDataArray::Pointer iRefLists = dc->getAttributeMatrix(refCellFeatAm->getName())->getAttributeArray("CorrespondingFeatures");
+    IDataArray::Pointer iMovLists = dc->getAttributeMatrix(movCellFeatAm->getName())->getAttributeArray("CorrespondingFeatures");
+
+    DataArray<int32_t>* pRegisteredIds = DataArray<int32_t>::SafePointerDownCast(iFeatureIds.get());
+    DataArray<int32_t>* pRefGroups = DataArray<int32_t>::SafePointerDownCast(iRefGroups.get());
+    DataArray<int32_t>* pMovGroups = DataArray<int32_t>::SafePointerDownCast(iMovGroups.get());
+    NeighborList<int32_t>* pRefLists = NeighborList<int32_t>::SafePointerDownCast(iRefLists.get());
+    NeighborList<int32_t>* pMovLists = NeighborList<int32_t>::SafePointerDownCast(iMovLists.get());
+
+    DREAM3D_REQUIRE_VALID_POINTER(pRegisteredIds)
+    DREAM3D_REQUIRE_VALID_POINTER(pRefGroups)
+    DREAM3D_REQUIRE_VALID_POINTER(pMovGroups)
+    DREAM3D_REQUIRE_VALID_POINTER(pRefLists)
+    DREAM3D_REQUIRE_VALID_POINTER(pMovLists)
+
+    DREAM3D_REQUIRE_EQUAL(4, pMovGroups->getNumberOfTuples())
+
+    for(size_t i = 0; i < dims[0]; i++) {
+      DREAM3D_REQUIRE_EQUAL(pRegisteredIds->getValue(i), regID[i])
+    }
+    for(int i = 0; i < 3; i++) {
+      DREAM3D_REQUIRE_EQUAL(pRefGroups->getValue(i), refGroups[i])
+      DREAM3D_REQUIRE_EQUAL(pRefLists->getListSize(i), refListSizes[i])
+      for(int j = 0; j < refListSizes[i]; j++) {
+        DREAM3D_REQUIRE_EQUAL(pRefLists->getList(i)->at(j), refLists[i][j])
+      }
+    }
+    for(int i = 0; i < 4; i++) {
+      DREAM3D_REQUIRE_EQUAL(pMovGroups->getValue(i), movGroups[i])
+      DREAM3D_REQUIRE_EQUAL(pMovLists->getListSize(i), movListSizes[i])
+      if(movListSizes[i] > 0) {
+        DREAM3D_REQUIRE_EQUAL(pMovLists->getList(i)->at(0), movLists[i])
+      }
+    }
+  }
+  else
+  {
+    QString ss = QObject::tr("MatchFeatureIdsTest Error creating filter '%1'. Filter was not created/executed. Please notify the developers.").arg(filtName);
+    DREAM3D_TEST_THROW_EXCEPTION(ss.toStdString())
+  }
+
+  return EXIT_SUCCESS;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int MatchFeatureIdsOverlapTableTest()
+{
+  //reference feature 1 is split into moving features 1 and 2 (renumbered to 3 and 1)
+  size_t dims[] = {8};
+  int32_t refID[] = {1, 1, 1, 1, 2, 2, 2, 2};
+  int32_t movID[] = {1, 1, 2, 2, 3, 3, 3, 3};
+
+  //expected overlap table (sorted by reference id then new moving id)
+  int32_t pairRefIDs[] = {1, 1, 2};
+  int32_t pairMovIDs[] = {1, 3, 2};
+  int64_t pairCounts[] = {2, 2, 4};
+  float pairMetric[] = {2.0f / 3.0f, 2.0f / 3.0f, 1.0f};
+  int64_t pairOffsets[] = {0, 0, 2};
+
+  //create cell data
+  QVector<size_t> tDims(1, dims[0]);
+  QVector<size_t> cDims(1, 1);
+  AttributeMatrix::Pointer cellAm = AttributeMatrix::New(tDims, DREAM3D::Defaults::CellAttributeMatrixName, DREAM3D::AttributeMatrixType::Cell);
+  DataArray<int32_t>::Pointer referenceIds = DataArray<int32_t>::CreateArray(tDims, cDims, "ReferenceFeatureIds");
+  DataArray<int32_t>::Pointer movingIds = DataArray<int32_t>::CreateArray(tDims, cDims, "MovingFeatureIds");
+  for(size_t i = 0; i < tDims[0]; i++) {
+    referenceIds->setValue(i, refID[i]);
+    movingIds->setValue(i, movID[i]);
+  }
+  cellAm->addAttributeArray(referenceIds->getName(), referenceIds);
+  cellAm->addAttributeArray(movingIds->getName(), movingIds);
+
+  //create (empty) cell feature data
+  tDims[0] = 3;
+  AttributeMatrix::Pointer refCellFeatAm = AttributeMatrix::New(tDims, "ReferenceCellFeatureData", DREAM3D::AttributeMatrixType::CellFeature);
+  tDims[0] = 4;
+  AttributeMatrix::Pointer movCellFeatAm = AttributeMatrix::New(tDims, "MovingCellFeatureData", DREAM3D::AttributeMatrixType::CellFeature);
+
+  //fill a data container
+  ImageGeom::Pointer image = ImageGeom::CreateGeometry(DREAM3D::Geometry::ImageGeometry);
+  image->setDimensions(dims);
+  DataContainerArray::Pointer dca = DataContainerArray::New();
+  DataContainer::Pointer dc = DataContainer::New("dc");
+  dc->setGeometry(image);
+  dc->addAttributeMatrix(cellAm->getName(), cellAm);
+  dc->addAttributeMatrix(refCellFeatAm->getName(), refCellFeatAm);
+  dc->addAttributeMatrix(movCellFeatAm->getName(), movCellFeatAm);
+  dca->addDataContainer(dc);
+
+  //create match feature ids filter and execute
+  QString filtName = "MatchFeatureIds";
+  FilterManager* fm = FilterManager::Instance();
+  IFilterFactory::Pointer filterFactory = fm->getFactoryForFilter(filtName);
+  if(NULL != filterFactory.get())
+  {
+    //create filter and set parameters
+    AbstractFilter::Pointer filter = filterFactory->create();
+    filter->setDataContainerArray(dca);
+
+    QVariant var;
+    bool propWasSet;
+    DataArrayPath path;
+
+    var.setValue(1);
+    propWasSet = filter->setProperty("Metric", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    var.setValue(0.1);
+    propWasSet = filter->setProperty("MetricThreshold", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    var.setValue(false);
+    propWasSet = filter->setProperty("UseOrientations", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    var.setValue(true);
+    propWasSet = filter->setProperty("ExportOverlapTable", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    path.update(dc->getName(), cellAm->getName(), referenceIds->getName());
+    var.setValue(path);
+    propWasSet = filter->setProperty("ReferenceFeatureIdsArrayPath", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    path.update(dc->getName(), cellAm->getName(), movingIds->getName());
+    var.setValue(path);
+    propWasSet = filter->setProperty("MovingFeatureIdsArrayPath", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    path.update(dc->getName(), refCellFeatAm->getName(), "");
+    var.setValue(path);
+    propWasSet = filter->setProperty("ReferenceCellFeatureAttributeMatrixPath", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    path.update(dc->getName(), movCellFeatAm->getName(), "");
+    var.setValue(path);
+    propWasSet = filter->setProperty("MovingCellFeatureAttributeMatrixPath", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    //execute filter and get output arrays
+    filter->execute();
+    DREAM3D_REQUIRED(filter->getErrorCondition(), >= , 0);
+
+    AttributeMatrix::Pointer pairAm = dc->getAttributeMatrix("FeaturePairs");
+    DREAM3D_REQUIRE_VALID_POINTER(pairAm.get())
+    DREAM3D_REQUIRE_EQUAL(3, pairAm->getNumTuples())
+
+    DataArray<int32_t>* pPairRefIds = DataArray<int32_t>::SafePointerDownCast(pairAm->getAttributeArray("ReferenceIds").get());
+    DataArray<int32_t>* pPairMovIds = DataArray<int32_t>::SafePointerDownCast(pairAm->getAttributeArray("MovingIds").get());
+    DataArray<int64_t>* pPairCounts = DataArray<int64_t>::SafePointerDownCast(pairAm->getAttributeArray("VoxelCounts").get());
+    DataArray<float>* pPairMetric = DataArray<float>::SafePointerDownCast(pairAm->getAttributeArray("SimilarityCoefficient").get());
+    DataArray<int64_t>* pPairOffsets = DataArray<int64_t>::SafePointerDownCast(dc->getAttributeMatrix(refCellFeatAm->getName())->getAttributeArray("FeaturePairOffsets").get());
+
+    DREAM3D_REQUIRE_VALID_POINTER(pPairRefIds)
+    DREAM3D_REQUIRE_VALID_POINTER(pPairMovIds)
+    DREAM3D_REQUIRE_VALID_POINTER(pPairCounts)
+    DREAM3D_REQUIRE_VALID_POINTER(pPairMetric)
+    DREAM3D_REQUIRE_VALID_POINTER(pPairOffsets)
+
+    for(size_t i = 0; i < 3; i++) {
+      DREAM3D_REQUIRE_EQUAL(pPairRefIds->getValue(i), pairRefIDs[i])
+      DREAM3D_REQUIRE_EQUAL(pPairMovIds->getValue(i), pairMovIDs[i])
+      DREAM3D_REQUIRE_EQUAL(pPairCounts->getValue(i), pairCounts[i])
+      DREAM3D_REQUIRE(fabs(pPairMetric->getValue(i) - pairMetric[i]) < 1e-6f)
+      DREAM3D_REQUIRE_EQUAL(pPairOffsets->getValue(i), pairOffsets[i])
+    }
+  }
+  else
+  {
+    QString ss = QObject::tr("MatchFeatureIdsTest Error creating filter '%1'. Filter was not created/executed. Please notify the developers.").arg(filtName);
+    DREAM3D_TEST_THROW_EXCEPTION(ss.toStdString())
+  }
+
+  return EXIT_SUCCESS;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int MatchFeatureIdsStreamingTest(bool inPlace)
+{
+  //cell data
+  size_t dims[] = {32};
+  int32_t refID[] = {0, 0, 1, 2, 2, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 5, 6, 6, 6, 6, 6, 6, 7, 7, 7, 7, 7, 7, 7, 8, 0};
+  int32_t movID[] = {0, 8, 8, 7, 6, 6, 6, 5, 5, 5, 5, 5, 5, 4, 4, 4, 3, 3, 3, 3, 3, 2, 2, 2, 1, 1, 1, 1, 1, 1, 1, 0};
+  int32_t regID[] = {0, 1, 1, 2, 3, 3, 3, 4, 4, 4, 4, 4, 4, 5, 5, 5, 6, 6, 6, 6, 6, 9, 9, 9, 7, 7, 7, 7, 7, 7, 7, 0};
+
+  //feature data
+  int32_t refSize[] = {0, 1, 2, 3, 4, 5, 6, 7, 1};
+  int32_t movSize[] = {0, 7, 3, 5, 3, 6, 3, 1, 2};
+  int32_t regSize[] = {0, 2, 1, 3, 6, 3, 5, 7, 0, 3};
+
+  //write cell data to a file (4 slices of 8 voxels)
+  QString filePath = UnitTest::TestTempDir + QString("/MatchFeatureIdsStreamingTest%1.dream3d").arg(inPlace ? "InPlace" : "");
+  hsize_t fileDims[] = {4, 8, 1};
+  hid_t fileId = QH5Utilities::createFile(filePath);
+  DREAM3D_REQUIRED(fileId, >, 0)
+  hid_t groupId = QH5Utilities::createGroup(fileId, DREAM3D::StringConstants::DataContainerGroupName);
+  hid_t dcId = QH5Utilities::createGroup(groupId, "dc");
+  hid_t amId = QH5Utilities::createGroup(dcId, DREAM3D::Defaults::CellAttributeMatrixName);
+  DREAM3D_REQUIRED(QH5Lite::writePointerDataset(amId, "ReferenceFeatureIds", 3, fileDims, refID), >=, 0)
+  DREAM3D_REQUIRED(QH5Lite::writePointerDataset(amId, "MovingFeatureIds", 3, fileDims, movID), >=, 0)
+  DREAM3D_REQUIRED(QH5Lite::writeStringAttribute(amId, "MovingFeatureIds", "ObjectType", "DataArray<int32_t>"), >=, 0)
+  std::vector<float> floatID(movID, movID + dims[0]);
+  DREAM3D_REQUIRED(QH5Lite::writePointerDataset(amId, "FloatFeatureIds", 3, fileDims, &floatID[0]), >=, 0)
+  H5Gclose(amId);
+  H5Gclose(dcId);
+  H5Gclose(groupId);
+  H5Fclose(fileId);
+
+  QVector<size_t> tDims(1, 1);
+  QVector<size_t> cDims(1, 1);
+
+  //create cell feature data
+  tDims[0] = 9;
+  AttributeMatrix::Pointer refCellFeatAm = AttributeMatrix::New(tDims, "ReferenceCellFeatureData", DREAM3D::AttributeMatrixType::CellFeature);
+  AttributeMatrix::Pointer movCellFeatAm = AttributeMatrix::New(tDims, "MovingCellFeatureData", DREAM3D::AttributeMatrixType::CellFeature);
+  DataArray<int32_t>::Pointer referenceNumCells = DataArray<int32_t>::CreateArray(tDims, cDims, "ReferenceNumCells");
+  DataArray<int32_t>::Pointer movingNumCells = DataArray<int32_t>::CreateArray(tDims, cDims, "MovingNumCells");
+  for(size_t i = 0; i < tDims[0]; i++) {
+    referenceNumCells->setValue(i, refSize[i]);
+    movingNumCells->setValue(i, movSize[i]);
+  }
+  refCellFeatAm->addAttributeArray(referenceNumCells->getName(), referenceNumCells);
+  movCellFeatAm->addAttributeArray(movingNumCells->getName(), movingNumCells);
+
+  //fill a data container
+  ImageGeom::Pointer image = ImageGeom::CreateGeometry(DREAM3D::Geometry::ImageGeometry);
+  image->setDimensions(dims);
+  DataContainerArray::Pointer dca = DataContainerArray::New();
+  DataContainer::Pointer dc = DataContainer::New("dc");
+  dc->setGeometry(image);
+  dc->addAttributeMatrix(refCellFeatAm->getName(), refCellFeatAm);
+  dc->addAttributeMatrix(movCellFeatAm->getName(), movCellFeatAm);
+  dca->addDataContainer(dc);
+
+  //create match feature ids filter and execute
+  QString filtName = "MatchFeatureIds";
+  FilterManager* fm = FilterManager::Instance();
+  IFilterFactory::Pointer filterFactory = fm->getFactoryForFilter(filtName);
+  if(NULL != filterFactory.get())
+  {
+    //create filter and set parameters
+    AbstractFilter::Pointer filter = filterFactory->create();
+    filter->setDataContainerArray(dca);
+
+    QVariant var;
+    bool propWasSet;
+    DataArrayPath path;
+
+    var.setValue(1);
+    propWasSet = filter->setProperty("Metric", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    var.setValue(0.1);
+    propWasSet = filter->setProperty("MetricThreshold", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    var.setValue(false);
+    propWasSet = filter->setProperty("UseOrientations", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    var.setValue(true);
+    propWasSet = filter->setProperty("UseStreaming", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    var.setValue(filePath);
+    propWasSet = filter->setProperty("StreamingFilePath", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    var.setValue(3);//slabs don't evenly divide the volume
+    propWasSet = filter->setProperty("SlabThickness", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    var.setValue(inPlace);
+    propWasSet = filter->setProperty("RewriteInPlace", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    path.update(dc->getName(), DREAM3D::Defaults::CellAttributeMatrixName, "ReferenceFeatureIds");
+    var.setValue(path);
+    propWasSet = filter->setProperty("ReferenceFeatureIdsArrayPath", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    path.update(dc->getName(), DREAM3D::Defaults::CellAttributeMatrixName, "MovingFeatureIds");
+    var.setValue(path);
+    propWasSet = filter->setProperty("MovingFeatureIdsArrayPath", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    path.update(dc->getName(), refCellFeatAm->getName(), "");
+    var.setValue(path);
+    propWasSet = filter->setProperty("ReferenceCellFeatureAttributeMatrixPath", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    path.update(dc->getName(), movCellFeatAm->getName(), "");
+    var.setValue(path);
+    propWasSet = filter->setProperty("MovingCellFeatureAttributeMatrixPath", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    //execute filter and get output arrays
+    filter->execute();
+    DREAM3D_REQUIRED(filter->getErrorCondition(), >= , 0);
+
+    IDataArray::Pointer iNumCells = dc->getAttributeMatrix(movCellFeatAm->getName())->getAttributeArray(movingNumCells->getName());
+    DataArray<int32_t>* pRegisteredNumCells = DataArray<int32_t>::SafePointerDownCast(iNumCells.get());
+    DREAM3D_REQUIRE_VALID_POINTER(pRegisteredNumCells)
+    DREAM3D_REQUIRE_EQUAL(tDims[0] + 1, pRegisteredNumCells->getNumberOfTuples())
+    for(size_t i = 0; i < pRegisteredNumCells->getNumberOfTuples(); i++) {
+      DREAM3D_REQUIRE_EQUAL(pRegisteredNumCells->getValue(i), regSize[i])
+    }
+
+    //relabeled moving ids were written back to the file
+    std::vector<int32_t> registeredIds(dims[0], 0);
+    fileId = QH5Utilities::openFile(filePath, true);
+    DREAM3D_REQUIRED(fileId, >, 0)
+    QString datasetPath = QString("%1/dc/%2/MovingFeatureIds").arg(DREAM3D::StringConstants::DataContainerGroupName).arg(DREAM3D::Defaults::CellAttributeMatrixName);
+    herr_t err = QH5Lite::readPointerDataset(fileId, datasetPath, &registeredIds[0]);
+    DREAM3D_REQUIRED(err, >=, 0)
+
+    //the relabeled ids replaced (or overwrote) the original dataset keeping its attributes and no temporary dataset is left
+    QString objectType;
+    err = QH5Lite::readStringAttribute(fileId, datasetPath, "ObjectType", objectType);
+    DREAM3D_REQUIRED(err, >=, 0)
+    DREAM3D_REQUIRE_EQUAL(objectType, QString("DataArray<int32_t>"))
+    DREAM3D_REQUIRE_EQUAL(QH5Lite::datasetExists(fileId, datasetPath + "_Temp"), false)
+    H5Fclose(fileId);
+    for(size_t i = 0; i < dims[0]; i++) {
+      DREAM3D_REQUIRE_EQUAL(registeredIds[i], regID[i])
+    }
+
+    //ids that aren't stored as int32 are rejected before anything is read
+    AbstractFilter::Pointer floatFilter = filterFactory->create();
+    floatFilter->setDataContainerArray(dca);
+    QList<QByteArray> names = QList<QByteArray>() << "Metric" << "MetricThreshold" << "UseOrientations" << "UseStreaming" << "StreamingFilePath" << "SlabThickness" << "ReferenceFeatureIdsArrayPath" << "ReferenceCellFeatureAttributeMatrixPath" << "MovingCellFeatureAttributeMatrixPath";
+    for(int i = 0; i < names.size(); i++)
+    {
+      propWasSet = floatFilter->setProperty(names[i].constData(), filter->property(names[i].constData()));
+      DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+    }
+    path.update(dc->getName(), DREAM3D::Defaults::CellAttributeMatrixName, "FloatFeatureIds");
+    var.setValue(path);
+    propWasSet = floatFilter->setProperty("MovingFeatureIdsArrayPath", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+    floatFilter->preflight();
+    DREAM3D_REQUIRE_EQUAL(floatFilter->getErrorCondition(), -1005)
+  } 
+  else
+  {
+    QString ss = QObject::tr("MatchFeatureIdsTest Error creating filter '%1'. Filter was not created/executed. Please notify the developers.").arg(filtName);
+    DREAM3D_TEST_THROW_EXCEPTION(ss.toStdString())
+  }
+
+#if REMOVE_TEST_FILES
+  QFile::remove(filePath);
+#endif
+
+  return EXIT_SUCCESS;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int MatchFeatureIdsCentroidTest()
+{
+  //the volumes have different grids so features are matched by (transformed) centroid instead of overlap
+  size_t refDims[] = {4, 1, 1};
+  size_t movDims[] = {6, 1, 1};
+  float movOrigin[] = {12.0f, 0.0f, 0.0f};
+  int32_t movID[] = {1, 1, 2, 2, 3, 0};
+  int32_t regID[] = {3, 3, 1, 1, 4, 0};
+  float refCentroids[] = {0.0f, 0.0f, 0.0f, 1.0f, 1.0f, 1.0f, 5.0f, 1.0f, 1.0f, 9.0f, 1.0f, 1.0f};
+  float movCentroids[] = {0.0f, 0.0f, 0.0f, -1.2f, 1.0f, 1.0f, -9.0f, 1.0f, 1.0f, 20.0f, 1.0f, 1.0f};
+  float transformation[] = {1.0f, 0.0f, 0.0f, -2.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f};
+
+  //create moving cell data (reference feature ids aren't needed)
+  QVector<size_t> tDims(1, movDims[0]);
+  QVector<size_t> cDims(1, 1);
+  AttributeMatrix::Pointer movCellAm = AttributeMatrix::New(tDims, DREAM3D::Defaults::CellAttributeMatrixName, DREAM3D::AttributeMatrixType::Cell);
+  DataArray<int32_t>::Pointer movingIds = DataArray<int32_t>::CreateArray(tDims, cDims, DREAM3D::CellData::FeatureIds);
+  for(size_t i = 0; i < tDims[0]; i++) {
+    movingIds->setValue(i, movID[i]);
+  }
+  movCellAm->addAttributeArray(movingIds->getName(), movingIds);
+
+  //create cell feature data with centroids
+  tDims[0] = 4;
+  cDims[0] = 3;
+  AttributeMatrix::Pointer refCellFeatAm = AttributeMatrix::New(tDims, DREAM3D::Defaults::CellFeatureAttributeMatrixName, DREAM3D::AttributeMatrixType::CellFeature);
+  AttributeMatrix::Pointer movCellFeatAm = AttributeMatrix::New(tDims, DREAM3D::Defaults::CellFeatureAttributeMatrixName, DREAM3D::AttributeMatrixType::CellFeature);
+  DataArray<float>::Pointer referenceCentroids = DataArray<float>::CreateArray(tDims, cDims, DREAM3D::FeatureData::Centroids);
+  DataArray<float>::Pointer movingCentroids = DataArray<float>::CreateArray(tDims, cDims, DREAM3D::FeatureData::Centroids);
+  for(size_t i = 0; i < 3 * tDims[0]; i++) {
+    referenceCentroids->setValue(i, refCentroids[i]);
+    movingCentroids->setValue(i, movCentroids[i]);
+  }
+  refCellFeatAm->addAttributeArray(referenceCentroids->getName(), referenceCentroids);
+  movCellFeatAm->addAttributeArray(movingCentroids->getName(), movingCentroids);
+
+  //create transformation (shift -2 in x)
+  tDims[0] = 1;
+  QVector<size_t> transDims(2, 4);
+  AttributeMatrix::Pointer transAm = AttributeMatrix::New(tDims, "Transformation", DREAM3D::AttributeMatrixType::MetaData);
+  DataArray<float>::Pointer transformationArray = DataArray<float>::CreateArray(tDims, transDims, "Transformation");
+  for(size_t i = 0; i < 16; i++) {
+    transformationArray->setValue(i, transformation[i]);
+  }
+  transAm->addAttributeArray(transformationArray->getName(), transformationArray);
+
+  //fill data containers
+  ImageGeom::Pointer refImage = ImageGeom::CreateGeometry(DREAM3D::Geometry::ImageGeometry);
+  refImage->setDimensions(refDims);
+  ImageGeom::Pointer movImage = ImageGeom::CreateGeometry(DREAM3D::Geometry::ImageGeometry);
+  movImage->setDimensions(movDims);
+  movImage->setOrigin(movOrigin);
+  DataContainerArray::Pointer dca = DataContainerArray::New();
+  DataContainer::Pointer refDc = DataContainer::New("reference");
+  refDc->setGeometry(refImage);
+  refDc->addAttributeMatrix(refCellFeatAm->getName(), refCellFeatAm);
+  refDc->addAttributeMatrix(transAm->getName(), transAm);
+  dca->addDataContainer(refDc);
+  DataContainer::Pointer movDc = DataContainer::New("moving");
+  movDc->setGeometry(movImage);
+  movDc->addAttributeMatrix(movCellAm->getName(), movCellAm);
+  movDc->addAttributeMatrix(movCellFeatAm->getName(), movCellFeatAm);
+  dca->addDataContainer(movDc);
+
+  //create match feature ids filter and execute
+  QString filtName = "MatchFeatureIds";
+  FilterManager* fm = FilterManager::Instance();
+  IFilterFactory::Pointer filterFactory = fm->getFactoryForFilter(filtName);
+  if(NULL != filterFactory.get())
+  {
+    //create filter and set parameters
+    AbstractFilter::Pointer filter = filterFactory->create();
+    filter->setDataContainerArray(dca);
+
+    QVariant var;
+    bool propWasSet;
+    DataArrayPath path;
+
+    var.setValue(1);//0: voxel overlap, 1: feature centroids
+    propWasSet = filter->setProperty("CorrespondenceSource", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    var.setValue(1.0);
+    propWasSet = filter->setProperty("CentroidTolerance", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    var.setValue(0.5);
+    propWasSet = filter->setProperty("MetricThreshold", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    var.setValue(true);
+    propWasSet = filter->setProperty("UseTransformation", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    path.update(refDc->getName(), transAm->getName(), transformationArray->getName());
+    var.setValue(path);
+    propWasSet = filter->setProperty("TransformationArrayPath", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    path.update(refDc->getName(), refCellFeatAm->getName(), referenceCentroids->getName());
+    var.setValue(path);
+    propWasSet = filter->setProperty("ReferenceCentroidsArrayPath", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    path.update(movDc->getName(), movCellFeatAm->getName(), movingCentroids->getName());
+    var.setValue(path);
+    propWasSet = filter->setProperty("MovingCentroidsArrayPath", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    path.update(movDc->getName(), movCellAm->getName(), movingIds->getName());
+    var.setValue(path);
+    propWasSet = filter->setProperty("MovingFeatureIdsArrayPath", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    path.update(refDc->getName(), refCellFeatAm->getName(), "");
+    var.setValue(path);
+    propWasSet = filter->setProperty("ReferenceCellFeatureAttributeMatrixPath", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    path.update(movDc->getName(), movCellFeatAm->getName(), "");
+    var.setValue(path);
+    propWasSet = filter->setProperty("MovingCellFeatureAttributeMatrixPath", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    //execute filter and compare to expected ids
+    filter->execute();
+    DREAM3D_REQUIRED(filter->getErrorCondition(), >= , 0);
+
+    IDataArray::Pointer iFeatureIds = movCellAm->getAttributeArray(movingIds->getName());
+    DataArray<int32_t>* pRegisteredIds = DataArray<int32_t>::SafePointerDownCast(iFeatureIds.get());
+    DREAM3D_REQUIRE_VALID_POINTER(pRegisteredIds)
+    int32_t* registeredIds = pRegisteredIds->getPointer(0);
+    for(size_t i = 0; i < movDims[0]; i++) {
+      DREAM3D_REQUIRE_EQUAL(registeredIds[i], regID[i])
+    }
+
+    //moving centroids follow their features (unmatched feature is appended after the reference ids)
+    DREAM3D_REQUIRE_EQUAL(movCellFeatAm->getNumTuples(), 5)
+    IDataArray::Pointer iCentroids = movCellFeatAm->getAttributeArray(movingCentroids->getName());
+    DataArray<float>* pCentroids = DataArray<float>::SafePointerDownCast(iCentroids.get());
+    DREAM3D_REQUIRE_VALID_POINTER(pCentroids)
+    DREAM3D_REQUIRE_EQUAL(pCentroids->getComponent(3, 0), movCentroids[3])
+    DREAM3D_REQUIRE_EQUAL(pCentroids->getComponent(1, 0), movCentroids[6])
+    DREAM3D_REQUIRE_EQUAL(pCentroids->getComponent(4, 0), movCentroids[9])
+  }
+  else
+  {
+    QString ss = QObject::tr("MatchFeatureIdsTest Error creating filter '%1'. Filter was not created/executed. Please notify the developers.").arg(filtName);
+    DREAM3D_TEST_THROW_EXCEPTION(ss.toStdString())
+  }
+
+  return EXIT_SUCCESS;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int MatchFeatureIdsDilationTest()
+{
+  //thin reference feature 2 is shifted by a voxel in the moving volume so it only overlaps within a neighborhood
+  size_t dims[] = {8, 1, 1};
+  int32_t refID[] = {1, 1, 1, 1, 2, 3, 3, 3};
+  int32_t movID[] = {2, 2, 2, 2, 2, 3, 1, 1};
+  int32_t regID[] = {1, 1, 1, 1, 1, 2, 3, 3};
+
+  //create cell data
+  QVector<size_t> tDims(1, dims[0]);
+  QVector<size_t> cDims(1, 1);
+  AttributeMatrix::Pointer cellAm = AttributeMatrix::New(tDims, DREAM3D::Defaults::CellAttributeMatrixName, DREAM3D::AttributeMatrixType::Cell);
+  DataArray<int32_t>::Pointer referenceIds = DataArray<int32_t>::CreateArray(tDims, cDims, "ReferenceFeatureIds");
+  DataArray<int32_t>::Pointer movingIds = DataArray<int32_t>::CreateArray(tDims, cDims, "MovingFeatureIds");
+  for(size_t i = 0; i < tDims[0]; i++) {
+    referenceIds->setValue(i, refID[i]);
+    movingIds->setValue(i, movID[i]);
+  }
+  cellAm->addAttributeArray(referenceIds->getName(), referenceIds);
+  cellAm->addAttributeArray(movingIds->getName(), movingIds);
+
+  //create (empty) cell feature data
+  tDims[0] = 4;
+  AttributeMatrix::Pointer refCellFeatAm = AttributeMatrix::New(tDims, "ReferenceCellFeatureData", DREAM3D::AttributeMatrixType::CellFeature);
+  AttributeMatrix::Pointer movCellFeatAm = AttributeMatrix::New(tDims, "MovingCellFeatureData", DREAM3D::AttributeMatrixType::CellFeature);
+
+  //fill a data container
+  ImageGeom::Pointer image = ImageGeom::CreateGeometry(DREAM3D::Geometry::ImageGeometry);
+  image->setDimensions(dims);
+  DataContainerArray::Pointer dca = DataContainerArray::New();
+  DataContainer::Pointer dc = DataContainer::New("dc");
+  dc->setGeometry(image);
+  dc->addAttributeMatrix(cellAm->getName(), cellAm);
+  dc->addAttributeMatrix(refCellFeatAm->getName(), refCellFeatAm);
+  dc->addAttributeMatrix(movCellFeatAm->getName(), movCellFeatAm);
+  dca->addDataContainer(dc);
+
+  //create match feature ids filter and execute
+  QString filtName = "MatchFeatureIds";
+  FilterManager* fm = FilterManager::Instance();
+  IFilterFactory::Pointer filterFactory = fm->getFactoryForFilter(filtName);
+  if(NULL != filterFactory.get())
+  {
+    //create filter and set parameters
+    AbstractFilter::Pointer filter = filterFactory->create();
+    filter->setDataContainerArray(dca);
+
+    QVariant var;
+    bool propWasSet;
+    DataArrayPath path;
+
+    var.setValue(1);
+    propWasSet = filter->setProperty("Metric", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    var.setValue(0.6);
+    propWasSet = filter->setProperty("MetricThreshold", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    var.setValue(0);//0: greedy, 1: optimal
+    propWasSet = filter->setProperty("MatchingMethod", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    var.setValue(false);
+    propWasSet = filter->setProperty("UseOrientations", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    var.setValue(true);
+    propWasSet = filter->setProperty("UseDilation", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    var.setValue(1);
+    propWasSet = filter->setProperty("DilationRadius", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    path.update(dc->getName(), cellAm->getName(), referenceIds->getName());
+    var.setValue(path);
+    propWasSet = filter->setProperty("ReferenceFeatureIdsArrayPath", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    path.update(dc->getName(), cellAm->getName(), movingIds->getName());
+    var.setValue(path);
+    propWasSet = filter->setProperty("MovingFeatureIdsArrayPath", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    path.update(dc->getName(), refCellFeatAm->getName(), "");
+    var.setValue(path);
+    propWasSet = filter->setProperty("ReferenceCellFeatureAttributeMatrixPath", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    path.update(dc->getName(), movCellFeatAm->getName(), "");
+    var.setValue(path);
+    propWasSet = filter->setProperty("MovingCellFeatureAttributeMatrixPath", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    //execute filter and compare to expected ids (without the neighborhood moving feature 3 would get the new id 4)
+    filter->execute();
+    DREAM3D_REQUIRED(filter->getErrorCondition(), >= , 0);
+
+    IDataArray::Pointer iFeatureIds = dc->getAttributeMatrix(cellAm->getName())->getAttributeArray(movingIds->getName());
+    DataArray<int32_t>* pRegisteredIds = DataArray<int32_t>::SafePointerDownCast(iFeatureIds.get());
+    DREAM3D_REQUIRE_VALID_POINTER(pRegisteredIds)
+    int32_t* registeredIds = pRegisteredIds->getPointer(0);
+
+    for(size_t i = 0; i < dims[0]; i++) {
+      DREAM3D_REQUIRE_EQUAL(registeredIds[i], regID[i])
+    }
+  }
+  else
+  {
+    QString ss = QObject::tr("MatchFeatureIdsTest Error creating filter '%1'. Filter was not created/executed. Please notify the developers.").arg(filtName);
+    DREAM3D_TEST_THROW_EXCEPTION(ss.toStdString())
+  }
+
+  return EXIT_SUCCESS;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int MatchFeatureIdsOrientationTest()
+{
+  //each moving feature only overlaps the reference feature with the same id, so a pair is matched exactly when the misorientation (computed by
+  //SIMPL's LaueOps) is within the tolerance
+  //odd features are cubic, even features are hexagonal, and the last pair has identical orientations but different crystal structures
+  const size_t numFeatures = 201;
+  const float tolerance = 5.0f;
+  size_t dims[] = {numFeatures};
+  QVector<SpaceGroupOps::Pointer> ops = SpaceGroupOps::getOrientationOpsQVector();
+  unsigned int xtals[] = {Ebsd::CrystalStructure::UnknownCrystalStructure, Ebsd::CrystalStructure::Cubic_High, Ebsd::CrystalStructure::Hexagonal_High};
+
+  std::vector<QuatF> refQuats(numFeatures + 1), movQuats(numFeatures + 1);
+  std::vector<int32_t> refPhases(numFeatures + 1, 0), movPhases(numFeatures + 1, 0);
+  std::vector<int32_t> regID(numFeatures, 0);
+  refQuats[0] = QuaternionMathF::New(0.0f, 0.0f, 0.0f, 1.0f);
+  movQuats[0] = refQuats[0];
+  std::mt19937 gen(5489);
+  std::uniform_real_distribution<float> uniform(0.0f, 1.0f);
+  std::normal_distribution<float> normal(0.0f, 1.0f);
+  int32_t newId = static_cast<int32_t>(numFeatures + 1);
+  size_t numMatched = 0;
+  for(size_t i = 1; i < numFeatures; i++)
+  {
+    refPhases[i] = movPhases[i] = 1 + static_cast<int32_t>((i + 1) % 2);
+    unsigned int xtal = xtals[refPhases[i]];
+    float misorientation = 0.0f;
+    do
+    {
+      //random reference orientation
+      float u1 = uniform(gen);
+      float u2 = 2.0f * SIMPLib::Constants::k_Pi * uniform(gen);
+      float u3 = 2.0f * SIMPLib::Constants::k_Pi * uniform(gen);
+      refQuats[i] = QuaternionMathF::New(sqrt(1.0f - u1) * sin(u2), sqrt(1.0f - u1) * cos(u2), sqrt(u1) * sin(u3), sqrt(u1) * cos(u3));
+
+      //moving orientation rotated up to twice the tolerance about a random axis then replaced by a random symmetric equivalent
+      float axis[3] = {normal(gen), normal(gen), normal(gen)};
+      float length = sqrt(axis[0] * axis[0] + axis[1] * axis[1] + axis[2] * axis[2]);
+      float halfAngle = uniform(gen) * tolerance * SIMPLib::Constants::k_Pi / 180.0f;
+      QuatF rotation = QuaternionMathF::New(axis[0] / length * sin(halfAngle), axis[1] / length * sin(halfAngle), axis[2] / length * sin(halfAngle), cos(halfAngle));
+      QuatF symOp, rotated;
+      ops[xtal]->getQuatSymOp(static_cast<int>(uniform(gen) * ops[xtal]->getNumSymOps()) % ops[xtal]->getNumSymOps(), symOp);
+      QuaternionMathF::Multiply(refQuats[i], rotation, rotated);
+      QuaternionMathF::Multiply(symOp, rotated, movQuats[i]);
+
+      //skip pairs too close to the tolerance for float round off to decide
+      float n1, n2, n3;
+      QuatF q1 = refQuats[i];
+      QuatF q2 = movQuats[i];
+      misorientation = ops[xtal]->getMisoQuat(q1, q2, n1, n2, n3) * 180.0f / SIMPLib::Constants::k_Pi;
+    }
+    while(fabs(misorientation - tolerance) < 0.05f);
+
+    if(misorientation <= tolerance)
+    {
+      regID[i - 1] = static_cast<int32_t>(i);
+      numMatched++;
+    }
+    else
+    {
+      regID[i - 1] = newId++;
+    }
+  }
+  refQuats[numFeatures] = refQuats[1];
+  movQuats[numFeatures] = refQuats[1];
+  refPhases[numFeatures] = 1;
+  movPhases[numFeatures] = 2;
+  regID[numFeatures - 1] = newId++;
+
+  //the random misorientations should land on both sides of the tolerance
+  DREAM3D_REQUIRED(numMatched, >, 0)
+  DREAM3D_REQUIRED(numMatched, <, numFeatures - 1)
+
+  //create cell data
+  QVector<size_t> tDims(1, dims[0]);
+  QVector<size_t> cDims(1, 1);
+  AttributeMatrix::Pointer cellAm = AttributeMatrix::New(tDims, DREAM3D::Defaults::CellAttributeMatrixName, DREAM3D::AttributeMatrixType::Cell);
+  DataArray<int32_t>::Pointer referenceIds = DataArray<int32_t>::CreateArray(tDims, cDims, "ReferenceFeatureIds");
+  DataArray<int32_t>::Pointer movingIds = DataArray<int32_t>::CreateArray(tDims, cDims, "MovingFeatureIds");
+  for(size_t i = 0; i < tDims[0]; i++) {
+    referenceIds->setValue(i, static_cast<int32_t>(i + 1));
+    movingIds->setValue(i, static_cast<int32_t>(i + 1));
+  }
+  cellAm->addAttributeArray(referenceIds->getName(), referenceIds);
+  cellAm->addAttributeArray(movingIds->getName(), movingIds);
+
+  //create cell feature data with orientations and phases
+  tDims[0] = numFeatures + 1;
+  AttributeMatrix::Pointer refCellFeatAm = AttributeMatrix::New(tDims, "ReferenceCellFeatureData", DREAM3D::AttributeMatrixType::CellFeature);
+  AttributeMatrix::Pointer movCellFeatAm = AttributeMatrix::New(tDims, "MovingCellFeatureData", DREAM3D::AttributeMatrixType::CellFeature);
+  DataArray<int32_t>::Pointer referencePhases = DataArray<int32_t>::CreateArray(tDims, cDims, DREAM3D::FeatureData::Phases);
+  DataArray<int32_t>::Pointer movingPhases = DataArray<int32_t>::CreateArray(tDims, cDims, DREAM3D::FeatureData::Phases);
+  cDims[0] = 4;
+  DataArray<float>::Pointer referenceQuats = DataArray<float>::CreateArray(tDims, cDims, DREAM3D::FeatureData::AvgQuats);
+  DataArray<float>::Pointer movingQuats = DataArray<float>::CreateArray(tDims, cDims, DREAM3D::FeatureData::AvgQuats);
+  for(size_t i = 0; i < tDims[0]; i++) {
+    referencePhases->setValue(i, refPhases[i]);
+    movingPhases->setValue(i, movPhases[i]);
+    float* refQuat = referenceQuats->getPointer(4 * i);
+    float* movQuat = movingQuats->getPointer(4 * i);
+    refQuat[0] = refQuats[i].x; refQuat[1] = refQuats[i].y; refQuat[2] = refQuats[i].z; refQuat[3] = refQuats[i].w;
+    movQuat[0] = movQuats[i].x; movQuat[1] = movQuats[i].y; movQuat[2] = movQuats[i].z; movQuat[3] = movQuats[i].w;
+  }
+  refCellFeatAm->addAttributeArray(referencePhases->getName(), referencePhases);
+  refCellFeatAm->addAttributeArray(referenceQuats->getName(), referenceQuats);
+  movCellFeatAm->addAttributeArray(movingPhases->getName(), movingPhases);
+  movCellFeatAm->addAttributeArray(movingQuats->getName(), movingQuats);
+
+  //create crystal structures (shared by both volumes)
+  tDims[0] = 3;
+  cDims[0] = 1;
+  AttributeMatrix::Pointer ensbAm = AttributeMatrix::New(tDims, DREAM3D::Defaults::CellEnsembleAttributeMatrixName, DREAM3D::AttributeMatrixType::CellEnsemble);
+  DataArray<unsigned int>::Pointer crystalStructures = DataArray<unsigned int>::CreateArray(tDims, cDims, DREAM3D::EnsembleData::CrystalStructures);
+  for(size_t i = 0; i < tDims[0]; i++) {
+    crystalStructures->setValue(i, xtals[i]);
+  }
+  ensbAm->addAttributeArray(crystalStructures->getName(), crystalStructures);
+
+  //fill a data container
+  ImageGeom::Pointer image = ImageGeom::CreateGeometry(DREAM3D::Geometry::ImageGeometry);
+  image->setDimensions(dims);
+  DataContainerArray::Pointer dca = DataContainerArray::New();
+  DataContainer::Pointer dc = DataContainer::New("dc");
+  dc->setGeometry(image);
+  dc->addAttributeMatrix(cellAm->getName(), cellAm);
+  dc->addAttributeMatrix(refCellFeatAm->getName(), refCellFeatAm);
+  dc->addAttributeMatrix(movCellFeatAm->getName(), movCellFeatAm);
+  dc->addAttributeMatrix(ensbAm->getName(), ensbAm);
+  dca->addDataContainer(dc);
+
+  //create match feature ids filter and execute
+  QString filtName = "MatchFeatureIds";
+  FilterManager* fm = FilterManager::Instance();
+  IFilterFactory::Pointer filterFactory = fm->getFactoryForFilter(filtName);
+  if(NULL != filterFactory.get())
+  {
+    //create filter and set parameters
+    AbstractFilter::Pointer filter = filterFactory->create();
+    filter->setDataContainerArray(dca);
+
+    QVariant var;
+    bool propWasSet;
+    DataArrayPath path;
+
+    var.setValue(1);
+    propWasSet = filter->setProperty("Metric", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    var.setValue(0.1);
+    propWasSet = filter->setProperty("MetricThreshold", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    var.setValue(true);
+    propWasSet = filter->setProperty("UseOrientations", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    var.setValue(static_cast<double>(tolerance));
+    propWasSet = filter->setProperty("OrientationTolerance", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    path.update(dc->getName(), refCellFeatAm->getName(), referenceQuats->getName());
+    var.setValue(path);
+    propWasSet = filter->setProperty("ReferenceQuatsArrayPath", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    path.update(dc->getName(), movCellFeatAm->getName(), movingQuats->getName());
+    var.setValue(path);
+    propWasSet = filter->setProperty("MovingQuatsArrayPath", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    path.update(dc->getName(), refCellFeatAm->getName(), referencePhases->getName());
+    var.setValue(path);
+    propWasSet = filter->setProperty("ReferencePhasesArrayPath", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    path.update(dc->getName(), movCellFeatAm->getName(), movingPhases->getName());
+    var.setValue(path);
+    propWasSet = filter->setProperty("MovingPhasesArrayPath", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    path.update(dc->getName(), ensbAm->getName(), crystalStructures->getName());
+    var.setValue(path);
+    propWasSet = filter->setProperty("ReferenceCrystalStructuresArrayPath", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+    propWasSet = filter->setProperty("MovingCrystalStructuresArrayPath", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    path.update(dc->getName(), cellAm->getName(), referenceIds->getName());
+    var.setValue(path);
+    propWasSet = filter->setProperty("ReferenceFeatureIdsArrayPath", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    path.update(dc->getName(), cellAm->getName(), movingIds->getName());
+    var.setValue(path);
+    propWasSet = filter->setProperty("MovingFeatureIdsArrayPath", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    path.update(dc->getName(), refCellFeatAm->getName(), "");
+    var.setValue(path);
+    propWasSet = filter->setProperty("ReferenceCellFeatureAttributeMatrixPath", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    path.update(dc->getName(), movCellFeatAm->getName(), "");
+    var.setValue(path);
+    propWasSet = filter->setProperty("MovingCellFeatureAttributeMatrixPath", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    //execute filter and compare to the ids expected from LaueOps misorientations
+    filter->execute();
+    DREAM3D_REQUIRED(filter->getErrorCondition(), >= , 0);
+
+    IDataArray::Pointer iFeatureIds = dc->getAttributeMatrix(cellAm->getName())->getAttributeArray(movingIds->getName());
+    DataArray<int32_t>* pRegisteredIds = DataArray<int32_t>::SafePointerDownCast(iFeatureIds.get());
+    DREAM3D_REQUIRE_VALID_POINTER(pRegisteredIds)
+    int32_t* registeredIds = pRegisteredIds->getPointer(0);
+
+    for(size_t i = 0; i < dims[0]; i++) {
+      DREAM3D_REQUIRE_EQUAL(registeredIds[i], regID[i])
+    }
+  }
+  else
+  {
+    QString ss = QObject::tr("MatchFeatureIdsTest Error creating filter '%1'. Filter was not created/executed. Please notify the developers.").arg(filtName);
+    DREAM3D_TEST_THROW_EXCEPTION(ss.toStdString())
+  }
+
+  return EXIT_SUCCESS;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int MatchFeatureIdsTieBreakTest()
+{
+  //moving features 1-5 form a chain across reference features 1-4 (each inner moving feature overlaps two reference features equally) and
+  //reference features 5 and 6 overlap moving features 6 and 7 equally, equal similarities are resolved by the larger moving id then the
+  //larger reference id so the assignment doesn't depend on how the overlap graph is split or scheduled
+  size_t dims[] = {20};
+  int32_t refID[] = {1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 6, 6};
+  int32_t movID[] = {1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 6, 7, 6, 7};
+  int32_t regID[] = {1, 1, 7, 7, 7, 7, 2, 2, 2, 2, 3, 3, 3, 3, 4, 4, 5, 6, 5, 6};
+
+  //the greedy and optimal methods agree on these volumes
+  for(int method = 0; method < 2; method++)
+  {
+    //create cell data
+    QVector<size_t> tDims(1, dims[0]);
+    QVector<size_t> cDims(1, 1);
+    AttributeMatrix::Pointer cellAm = AttributeMatrix::New(tDims, DREAM3D::Defaults::CellAttributeMatrixName, DREAM3D::AttributeMatrixType::Cell);
+    DataArray<int32_t>::Pointer referenceIds = DataArray<int32_t>::CreateArray(tDims, cDims, "ReferenceFeatureIds");
+    DataArray<int32_t>::Pointer movingIds = DataArray<int32_t>::CreateArray(tDims, cDims, "MovingFeatureIds");
+    for(size_t i = 0; i < tDims[0]; i++) {
+      referenceIds->setValue(i, refID[i]);
+      movingIds->setValue(i, movID[i]);
+    }
+    cellAm->addAttributeArray(referenceIds->getName(), referenceIds);
+    cellAm->addAttributeArray(movingIds->getName(), movingIds);
+
+    //create (empty) cell feature data
+    tDims[0] = 7;
+    AttributeMatrix::Pointer refCellFeatAm = AttributeMatrix::New(tDims, "ReferenceCellFeatureData", DREAM3D::AttributeMatrixType::CellFeature);
+    tDims[0] = 8;
+    AttributeMatrix::Pointer movCellFeatAm = AttributeMatrix::New(tDims, "MovingCellFeatureData", DREAM3D::AttributeMatrixType::CellFeature);
+
+    //fill a data container
+    ImageGeom::Pointer image = ImageGeom::CreateGeometry(DREAM3D::Geometry::ImageGeometry);
+    image->setDimensions(dims);
+    DataContainerArray::Pointer dca = DataContainerArray::New();
+    DataContainer::Pointer dc = DataContainer::New("dc");
+    dc->setGeometry(image);
+    dc->addAttributeMatrix(cellAm->getName(), cellAm);
+    dc->addAttributeMatrix(refCellFeatAm->getName(), refCellFeatAm);
+    dc->addAttributeMatrix(movCellFeatAm->getName(), movCellFeatAm);
+    dca->addDataContainer(dc);
+
+    //create match feature ids filter and execute
+    QString filtName = "MatchFeatureIds";
+    FilterManager* fm = FilterManager::Instance();
+    IFilterFactory::Pointer filterFactory = fm->getFactoryForFilter(filtName);
+    if(NULL != filterFactory.get())
+    {
+      //create filter and set parameters
+      AbstractFilter::Pointer filter = filterFactory->create();
+      filter->setDataContainerArray(dca);
+
+      QVariant var;
+      bool propWasSet;
+      DataArrayPath path;
+
+      var.setValue(1);
+      propWasSet = filter->setProperty("Metric", var);
+      DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+      var.setValue(0.1);
+      propWasSet = filter->setProperty("MetricThreshold", var);
+      DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+      var.setValue(method);//0: greedy, 1: optimal
+      propWasSet = filter->setProperty("MatchingMethod", var);
+      DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+      var.setValue(false);
+      propWasSet = filter->setProperty("UseOrientations", var);
+      DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+      path.update(dc->getName(), cellAm->getName(), referenceIds->getName());
+      var.setValue(path);
+      propWasSet = filter->setProperty("ReferenceFeatureIdsArrayPath", var);
+      DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+      path.update(dc->getName(), cellAm->getName(), movingIds->getName());
+      var.setValue(path);
+      propWasSet = filter->setProperty("MovingFeatureIdsArrayPath", var);
+      DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+      path.update(dc->getName(), refCellFeatAm->getName(), "");
+      var.setValue(path);
+      propWasSet = filter->setProperty("ReferenceCellFeatureAttributeMatrixPath", var);
+      DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+      path.update(dc->getName(), movCellFeatAm->getName(), "");
+      var.setValue(path);
+      propWasSet = filter->setProperty("MovingCellFeatureAttributeMatrixPath", var);
+      DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+      //execute filter and compare to expected ids (unmatched moving feature 2 gets the new id 7)
+      filter->execute();
+      DREAM3D_REQUIRED(filter->getErrorCondition(), >= , 0);
+
+      IDataArray::Pointer iFeatureIds = dc->getAttributeMatrix(cellAm->getName())->getAttributeArray(movingIds->getName());
+      DataArray<int32_t>* pRegisteredIds = DataArray<int32_t>::SafePointerDownCast(iFeatureIds.get());
+      DREAM3D_REQUIRE_VALID_POINTER(pRegisteredIds)
+      int32_t* registeredIds = pRegisteredIds->getPointer(0);
+
+      for(size_t i = 0; i < dims[0]; i++) {
+        DREAM3D_REQUIRE_EQUAL(registeredIds[i], regID[i])
+      }
+    }
+    else
+    {
+      QString ss = QObject::tr("MatchFeatureIdsTest Error creating filter '%1'. Filter was not created/executed. Please notify the developers.").arg(filtName);
+      DREAM3D_TEST_THROW_EXCEPTION(ss.toStdString())
+    }
+  }
+
+  return EXIT_SUCCESS;
+}
+
+// -----------------------------------------------------------------------------
+// blocky reference and moving volumes (offset grids of boxes with shuffled moving ids and scattered background voxels) with several
+// pairs per row so counting is split between tasks
+// -----------------------------------------------------------------------------
+void createOverlapVolumes(const size_t dims[3], std::vector<int32_t>& refIds, std::vector<int32_t>& movIds, int32_t& numRef, int32_t& numMov)
+{
+  const size_t refBox = 5;
+  const size_t movBox = 4;
+  size_t refBoxes[3], movBoxes[3];
+  for(size_t k = 0; k < 3; k++) {
+    refBoxes[k] = (dims[k] + refBox - 1) / refBox;
+    movBoxes[k] = (dims[k] + 2 + movBox - 1) / movBox;
+  }
+  numRef = static_cast<int32_t>(refBoxes[0] * refBoxes[1] * refBoxes[2] + 1);
+  numMov = static_cast<int32_t>(movBoxes[0] * movBoxes[1] * movBoxes[2] + 1);
+
+  std::vector<int32_t> shuffled(numMov - 1);
+  for(size_t i = 0; i < shuffled.size(); i++) {
+    shuffled[i] = static_cast<int32_t>(i + 1);
+  }
+  std::mt19937 gen(5489);
+  std::shuffle(shuffled.begin(), shuffled.end(), gen);
+
+  refIds.resize(dims[0] * dims[1] * dims[2]);
+  movIds.resize(refIds.size());
+  for(size_t z = 0; z < dims[2]; z++) {
+    for(size_t y = 0; y < dims[1]; y++) {
+      for(size_t x = 0; x < dims[0]; x++) {
+        size_t i = x + dims[0] * (y + dims[1] * z);
+        refIds[i] = static_cast<int32_t>(1 + x / refBox + refBoxes[0] * (y / refBox + refBoxes[1] * (z / refBox)));
+        movIds[i] = shuffled[(x + 2) / movBox + movBoxes[0] * ((y + 1) / movBox + movBoxes[1] * ((z + 2) / movBox))];
+        if(0 == (x + 2 * y + 3 * z) % 13) refIds[i] = 0;
+        if(0 == (3 * x + y + 2 * z) % 11) movIds[i] = 0;
+      }
+    }
+  }
+}
+
+// -----------------------------------------------------------------------------
+// compares an exported overlap table (dice coefficient) to a serial voxel by voxel count of the reference and (relabeled) moving ids
+// -----------------------------------------------------------------------------
+void checkOverlapTable(AttributeMatrix::Pointer pairAm, const std::vector<int32_t>& refIds, const std::vector<int32_t>& movIds)
+{
+  std::map<std::pair<int32_t, int32_t>, int64_t> pairs;
+  std::map<int32_t, int64_t> refVolumes, movVolumes;
+  for(size_t i = 0; i < refIds.size(); i++) {
+    if(refIds[i] > 0 && movIds[i] > 0) {
+      pairs[std::make_pair(refIds[i], movIds[i])]++;
+      refVolumes[refIds[i]]++;
+      movVolumes[movIds[i]]++;
+    }
+  }
+
+  DREAM3D_REQUIRE_VALID_POINTER(pairAm.get())
+  DREAM3D_REQUIRE_EQUAL(pairs.size(), pairAm->getNumTuples())
+  DataArray<int32_t>* pPairRefIds = DataArray<int32_t>::SafePointerDownCast(pairAm->getAttributeArray("ReferenceIds").get());
+  DataArray<int32_t>* pPairMovIds = DataArray<int32_t>::SafePointerDownCast(pairAm->getAttributeArray("MovingIds").get());
+  DataArray<int64_t>* pPairCounts = DataArray<int64_t>::SafePointerDownCast(pairAm->getAttributeArray("VoxelCounts").get());
+  DataArray<float>* pPairMetric = DataArray<float>::SafePointerDownCast(pairAm->getAttributeArray("SimilarityCoefficient").get());
+  DREAM3D_REQUIRE_VALID_POINTER(pPairRefIds)
+  DREAM3D_REQUIRE_VALID_POINTER(pPairMovIds)
+  DREAM3D_REQUIRE_VALID_POINTER(pPairCounts)
+  DREAM3D_REQUIRE_VALID_POINTER(pPairMetric)
+
+  //the table is sorted by reference id then moving id, the same order as the map
+  size_t k = 0;
+  for(std::map<std::pair<int32_t, int32_t>, int64_t>::const_iterator iter = pairs.begin(); iter != pairs.end(); ++iter, ++k) {
+    DREAM3D_REQUIRE_EQUAL(pPairRefIds->getValue(k), iter->first.first)
+    DREAM3D_REQUIRE_EQUAL(pPairMovIds->getValue(k), iter->first.second)
+    DREAM3D_REQUIRE_EQUAL(pPairCounts->getValue(k), iter->second)
+    float dice = static_cast<float>(2 * iter->second) / (refVolumes[iter->first.first] + movVolumes[iter->first.second]);
+    DREAM3D_REQUIRE(fabs(pPairMetric->getValue(k) - dice) < 1e-6f)
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int MatchFeatureIdsStreamingCountTest()
+{
+  //the overlap counted from slabs split between parallel tasks must match a serial count of every voxel
+  size_t dims[] = {40, 36, 32};
+  std::vector<int32_t> refIds, movIds;
+  int32_t numRef = 0, numMov = 0;
+  createOverlapVolumes(dims, refIds, movIds, numRef, numMov);
+
+  //write cell data to a file
+  QString filePath = UnitTest::TestTempDir + "/MatchFeatureIdsStreamingCountTest.dream3d";
+  hsize_t fileDims[] = {dims[2], dims[1], dims[0]};
+  hid_t fileId = QH5Utilities::createFile(filePath);
+  DREAM3D_REQUIRED(fileId, >, 0)
+  hid_t groupId = QH5Utilities::createGroup(fileId, DREAM3D::StringConstants::DataContainerGroupName);
+  hid_t dcId = QH5Utilities::createGroup(groupId, "dc");
+  hid_t amId = QH5Utilities::createGroup(dcId, DREAM3D::Defaults::CellAttributeMatrixName);
+  DREAM3D_REQUIRED(QH5Lite::writePointerDataset(amId, "ReferenceFeatureIds", 3, fileDims, &refIds[0]), >=, 0)
+  DREAM3D_REQUIRED(QH5Lite::writePointerDataset(amId, "MovingFeatureIds", 3, fileDims, &movIds[0]), >=, 0)
+  H5Gclose(amId);
+  H5Gclose(dcId);
+  H5Gclose(groupId);
+  H5Fclose(fileId);
+
+  //create (empty) cell feature data
+  QVector<size_t> tDims(1, numRef);
+  AttributeMatrix::Pointer refCellFeatAm = AttributeMatrix::New(tDims, "ReferenceCellFeatureData", DREAM3D::AttributeMatrixType::CellFeature);
+  tDims[0] = numMov;
+  AttributeMatrix::Pointer movCellFeatAm = AttributeMatrix::New(tDims, "MovingCellFeatureData", DREAM3D::AttributeMatrixType::CellFeature);
+
+  //fill a data container
+  ImageGeom::Pointer image = ImageGeom::CreateGeometry(DREAM3D::Geometry::ImageGeometry);
+  image->setDimensions(dims);
+  DataContainerArray::Pointer dca = DataContainerArray::New();
+  DataContainer::Pointer dc = DataContainer::New("dc");
+  dc->setGeometry(image);
+  dc->addAttributeMatrix(refCellFeatAm->getName(), refCellFeatAm);
+  dc->addAttributeMatrix(movCellFeatAm->getName(), movCellFeatAm);
+  dca->addDataContainer(dc);
+
+  //create match feature ids filter and execute
+  QString filtName = "MatchFeatureIds";
+  FilterManager* fm = FilterManager::Instance();
+  IFilterFactory::Pointer filterFactory = fm->getFactoryForFilter(filtName);
+  if(NULL != filterFactory.get())
+  {
+    //create filter and set parameters
+    AbstractFilter::Pointer filter = filterFactory->create();
+    filter->setDataContainerArray(dca);
+
+    QVariant var;
+    bool propWasSet;
+    DataArrayPath path;
+
+    var.setValue(1);
+    propWasSet = filter->setProperty("Metric", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    var.setValue(0.1);
+    propWasSet = filter->setProperty("MetricThreshold", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    var.setValue(false);
+    propWasSet = filter->setProperty("UseOrientations", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    var.setValue(true);
+    propWasSet = filter->setProperty("ExportOverlapTable", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    var.setValue(true);
+    propWasSet = filter->setProperty("UseStreaming", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    var.setValue(filePath);
+    propWasSet = filter->setProperty("StreamingFilePath", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    var.setValue(7);//slabs don't evenly divide the volume
+    propWasSet = filter->setProperty("SlabThickness", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    path.update(dc->getName(), DREAM3D::Defaults::CellAttributeMatrixName, "ReferenceFeatureIds");
+    var.setValue(path);
+    propWasSet = filter->setProperty("ReferenceFeatureIdsArrayPath", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    path.update(dc->getName(), DREAM3D::Defaults::CellAttributeMatrixName, "MovingFeatureIds");
+    var.setValue(path);
+    propWasSet = filter->setProperty("MovingFeatureIdsArrayPath", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    path.update(dc->getName(), refCellFeatAm->getName(), "");
+    var.setValue(path);
+    propWasSet = filter->setProperty("ReferenceCellFeatureAttributeMatrixPath", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    path.update(dc->getName(), movCellFeatAm->getName(), "");
+    var.setValue(path);
+    propWasSet = filter->setProperty("MovingCellFeatureAttributeMatrixPath", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    filter->execute();
+    DREAM3D_REQUIRED(filter->getErrorCondition(), >= , 0);
+
+    //compare against the relabeled moving ids written back to the file
+    std::vector<int32_t> registeredIds(movIds.size(), 0);
+    fileId = QH5Utilities::openFile(filePath, true);
+    DREAM3D_REQUIRED(fileId, >, 0)
+    QString datasetPath = QString("%1/dc/%2/MovingFeatureIds").arg(DREAM3D::StringConstants::DataContainerGroupName).arg(DREAM3D::Defaults::CellAttributeMatrixName);
+    herr_t err = QH5Lite::readPointerDataset(fileId, datasetPath, &registeredIds[0]);
+    H5Fclose(fileId);
+    DREAM3D_REQUIRED(err, >=, 0)
+    checkOverlapTable(dc->getAttributeMatrix("FeaturePairs"), refIds, registeredIds);
+  }
+  else
+  {
+    QString ss = QObject::tr("MatchFeatureIdsTest Error creating filter '%1'. Filter was not created/executed. Please notify the developers.").arg(filtName);
+    DREAM3D_TEST_THROW_EXCEPTION(ss.toStdString())
+  }
+
+#if REMOVE_TEST_FILES
+  QFile::remove(filePath);
+#endif
+
+  return EXIT_SUCCESS;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int MatchFeatureIdsCandidateCountTest()
+{
+  //the overlap counted in memory (only for pairs with intersecting bounding boxes) must match an unfiltered count of every voxel
+  size_t dims[] = {40, 36, 32};
+  std::vector<int32_t> refIds, movIds;
+  int32_t numRef = 0, numMov = 0;
+  createOverlapVolumes(dims, refIds, movIds, numRef, numMov);
+
+  //create cell data
+  QVector<size_t> tDims(1, refIds.size());
+  QVector<size_t> cDims(1, 1);
+  AttributeMatrix::Pointer cellAm = AttributeMatrix::New(tDims, DREAM3D::Defaults::CellAttributeMatrixName, DREAM3D::AttributeMatrixType::Cell);
+  DataArray<int32_t>::Pointer referenceIds = DataArray<int32_t>::CreateArray(tDims, cDims, "ReferenceFeatureIds");
+  DataArray<int32_t>::Pointer movingIds = DataArray<int32_t>::CreateArray(tDims, cDims, "MovingFeatureIds");
+  for(size_t i = 0; i < refIds.size(); i++) {
+    referenceIds->setValue(i, refIds[i]);
+    movingIds->setValue(i, movIds[i]);
+  }
+  cellAm->addAttributeArray(referenceIds->getName(), referenceIds);
+  cellAm->addAttributeArray(movingIds->getName(), movingIds);
+
+  //create (empty) cell feature data
+  tDims[0] = numRef;
+  AttributeMatrix::Pointer refCellFeatAm = AttributeMatrix::New(tDims, "ReferenceCellFeatureData", DREAM3D::AttributeMatrixType::CellFeature);
+  tDims[0] = numMov;
+  AttributeMatrix::Pointer movCellFeatAm = AttributeMatrix::New(tDims, "MovingCellFeatureData", DREAM3D::AttributeMatrixType::CellFeature);
+
+  //fill a data container
+  ImageGeom::Pointer image = ImageGeom::CreateGeometry(DREAM3D::Geometry::ImageGeometry);
+  image->setDimensions(dims);
+  DataContainerArray::Pointer dca = DataContainerArray::New();
+  DataContainer::Pointer dc = DataContainer::New("dc");
+  dc->setGeometry(image);
+  dc->addAttributeMatrix(cellAm->getName(), cellAm);
+  dc->addAttributeMatrix(refCellFeatAm->getName(), refCellFeatAm);
+  dc->addAttributeMatrix(movCellFeatAm->getName(), movCellFeatAm);
+  dca->addDataContainer(dc);
+
+  //create match feature ids filter and execute
+  QString filtName = "MatchFeatureIds";
+  FilterManager* fm = FilterManager::Instance();
+  IFilterFactory::Pointer filterFactory = fm->getFactoryForFilter(filtName);
+  if(NULL != filterFactory.get())
+  {
+    //create filter and set parameters
+    AbstractFilter::Pointer filter = filterFactory->create();
+    filter->setDataContainerArray(dca);
+
+    QVariant var;
+    bool propWasSet;
+    DataArrayPath path;
+
+    var.setValue(1);
+    propWasSet = filter->setProperty("Metric", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    var.setValue(0.1);
+    propWasSet = filter->setProperty("MetricThreshold", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    var.setValue(false);
+    propWasSet = filter->setProperty("UseOrientations", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    var.setValue(true);
+    propWasSet = filter->setProperty("ExportOverlapTable", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    path.update(dc->getName(), cellAm->getName(), referenceIds->getName());
+    var.setValue(path);
+    propWasSet = filter->setProperty("ReferenceFeatureIdsArrayPath", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    path.update(dc->getName(), cellAm->getName(), movingIds->getName());
+    var.setValue(path);
+    propWasSet = filter->setProperty("MovingFeatureIdsArrayPath", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    path.update(dc->getName(), refCellFeatAm->getName(), "");
+    var.setValue(path);
+    propWasSet = filter->setProperty("ReferenceCellFeatureAttributeMatrixPath", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    path.update(dc->getName(), movCellFeatAm->getName(), "");
+    var.setValue(path);
+    propWasSet = filter->setProperty("MovingCellFeatureAttributeMatrixPath", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    filter->execute();
+    DREAM3D_REQUIRED(filter->getErrorCondition(), >= , 0);
+
+    //compare against the relabeled moving ids
+    std::vector<int32_t> registeredIds(movingIds->getPointer(0), movingIds->getPointer(0) + movingIds->getNumberOfTuples());
+    checkOverlapTable(dc->getAttributeMatrix("FeaturePairs"), refIds, registeredIds);
+  }
+  else
+  {
+    QString ss = QObject::tr("MatchFeatureIdsTest Error creating filter '%1'. Filter was not created/executed. Please notify the developers.").arg(filtName);
+    DREAM3D_TEST_THROW_EXCEPTION(ss.toStdString())
+  }
+
+  return EXIT_SUCCESS;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -212,6 +1745,17 @@ int main(int argc, char** argv)
   DREAM3D_REGISTER_TEST( TestFilterAvailability() );
 
   DREAM3D_REGISTER_TEST( MatchFeatureIdsTest() )
+  DREAM3D_REGISTER_TEST( MatchFeatureIdsOptimalTest() )
+  DREAM3D_REGISTER_TEST( MatchFeatureIdsSplitMergeTest() )
+  DREAM3D_REGISTER_TEST( MatchFeatureIdsOverlapTableTest() )
+  DREAM3D_REGISTER_TEST( MatchFeatureIdsStreamingTest(false) )
+  DREAM3D_REGISTER_TEST( MatchFeatureIdsStreamingTest(true) )
+  DREAM3D_REGISTER_TEST( MatchFeatureIdsCentroidTest() )
+  DREAM3D_REGISTER_TEST( MatchFeatureIdsDilationTest() )
+  DREAM3D_REGISTER_TEST( MatchFeatureIdsOrientationTest() )
+  DREAM3D_REGISTER_TEST( MatchFeatureIdsStreamingCountTest() )
+  DREAM3D_REGISTER_TEST( MatchFeatureIdsCandidateCountTest() )
+  DREAM3D_REGISTER_TEST( MatchFeatureIdsTieBreakTest() )
 
   PRINT_TEST_SUMMARY();
   return err;
@@ -20,8 +20,12 @@
 #include <QtCore/QCoreApplication>
 #include <QtCore/QFile>
 
+#include <algorithm>
+#include <random>
+
 #include "SIMPLib/SIMPLib.h"
 #include "SIMPLib/Common/SIMPLibSetGetMacros.h"
+#include "SIMPLib/Common/Constants.h"
 #include "SIMPLib/DataArrays/DataArray.hpp"
 #include "SIMPLib/Common/FilterPipeline.h"
 #include "SIMPLib/Common/FilterManager.h"
@@ -231,6 +235,1000 @@ int RegisterPointSetsTest()
   return EXIT_SUCCESS;
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int RegisterPointSetsICPTest()
+{
+  //create input points: random reference points, moving points are the transformed reference points in a different order
+  static const size_t numPoints = 500;
+  QVector<size_t> tDims(1, numPoints);
+  QVector<size_t> cDims(1, 3);
+  DataArray<float>::Pointer pReferencePoints = DataArray<float>::CreateArray(tDims, cDims, "ReferenceCentroids");
+  DataArray<float>::Pointer pMovingPoints = DataArray<float>::CreateArray(tDims, cDims, "MovingCentroids");
+  float* refPoints = pReferencePoints->getPointer(0);
+  float* movPoints = pMovingPoints->getPointer(0);
+  std::mt19937 generator(5);
+  std::uniform_real_distribution<float> distribution(0.0f, 40.0f);
+  for(size_t i = 0; i < 3 * numPoints; i++)
+    refPoints[i] = distribution(generator);
+  std::vector<size_t> order(numPoints);
+  for(size_t i = 0; i < numPoints; i++)
+    order[i] = i;
+  std::shuffle(order.begin(), order.end(), generator);
+
+  //moving -> reference: rotate 3 @ 001, shift (0.5, -0.3, 0.2)
+  float translation[3] = {0.5f, -0.3f, 0.2f};
+  float c = std::cos(3.0f * static_cast<float>(SIMPLib::Constants::k_Pi) / 180.0f);
+  float s = std::sin(3.0f * static_cast<float>(SIMPLib::Constants::k_Pi) / 180.0f);
+  float rotation[9] = {c,   -s, 0.0f,
+                       s,    c, 0.0f,
+                       0.0f, 0.0f, 1.0f};
+  for(size_t i = 0; i < numPoints; i++) {
+    float* y = refPoints + 3 * order[i];
+    for(size_t j = 0; j < 3; j++)
+      movPoints[3 * i + j] = rotation[j] * (y[0] - translation[0]) + rotation[3 + j] * (y[1] - translation[1]) + rotation[6 + j] * (y[2] - translation[2]);
+  }
+
+  //create + fill data container
+  AttributeMatrix::Pointer am = AttributeMatrix::New(tDims, DREAM3D::Defaults::FeatureAttributeMatrixName, DREAM3D::AttributeMatrixObjectType::Feature);
+  am->addAttributeArray(pReferencePoints->getName(), pReferencePoints);
+  am->addAttributeArray(pMovingPoints->getName(), pMovingPoints);
+
+  DataContainer::Pointer dc = DataContainer::New(DREAM3D::Defaults::DataContainerName);
+  dc->setGeometry(ImageGeom::CreateGeometry(DREAM3D::Geometry::ImageGeometry));
+  dc->addAttributeMatrix(am->getName(), am);
+
+  DataContainerArray::Pointer dca = DataContainerArray::New();
+  dca->addDataContainer(dc);
+
+  //create register point sets filter and execute
+  QString filtName = "RegisterPointSets";
+  FilterManager* fm = FilterManager::Instance();
+  IFilterFactory::Pointer filterFactory = fm->getFactoryForFilter(filtName);
+  if(NULL != filterFactory.get())
+  {
+    //create filter and set parameters
+    AbstractFilter::Pointer filter = filterFactory->create();
+    filter->setDataContainerArray(dca);
+
+    QVariant var;
+    bool propWasSet;
+    DataArrayPath path;
+
+    var.setValue(false);
+    propWasSet = filter->setProperty("UseGoodPoints", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    var.setValue(false);
+    propWasSet = filter->setProperty("UseWeights", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    var.setValue(false);
+    propWasSet = filter->setProperty("AllowScaling", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    var.setValue(false);
+    propWasSet = filter->setProperty("AllowShearing", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    var.setValue(1);//0: matching indices, 1: closest points
+    propWasSet = filter->setProperty("CorrespondenceType", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    path.update(dc->getName(), am->getName(), pReferencePoints->getName());
+    var.setValue(path);
+    propWasSet = filter->setProperty("ReferenceCentroidsArrayPath", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    path.update(dc->getName(), am->getName(), pMovingPoints->getName());
+    var.setValue(path);
+    propWasSet = filter->setProperty("MovingCentroidsArrayPath", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    filter->execute();
+    DREAM3D_REQUIRED(filter->getErrorCondition(), >= , 0);
+
+    //get computed transformation and compare to applied transformation
+    IDataArray::Pointer iTransform = dc->getAttributeMatrix("Transformation")->getAttributeArray("Transformation");
+    DataArray<float>* pTransform = DataArray<float>::SafePointerDownCast(iTransform.get());
+    DREAM3D_REQUIRE_VALID_POINTER(pTransform)
+    float* transform = pTransform->getPointer(0);
+    for(size_t i = 0; i < 3; i++) {
+      DREAM3D_REQUIRED(std::fabs(rotation[3 * i + 0] - transform[4 * i + 0]), <, 1e-4f)
+      DREAM3D_REQUIRED(std::fabs(rotation[3 * i + 1] - transform[4 * i + 1]), <, 1e-4f)
+      DREAM3D_REQUIRED(std::fabs(rotation[3 * i + 2] - transform[4 * i + 2]), <, 1e-4f)
+      DREAM3D_REQUIRED(std::fabs(translation[i] - transform[4 * i + 3]), <, 1e-3f)
+    }
+  }
+  else
+  {
+    QString ss = QObject::tr("RegisterPointSetsTest Error creating filter '%1'. Filter was not created/executed. Please notify the developers.").arg(filtName);
+    DREAM3D_TEST_THROW_EXCEPTION(ss.toStdString())
+  }
+
+  return EXIT_SUCCESS;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int RegisterPointSetsWeightedTest()
+{
+  //create input points: random reference points far from the origin, moving points are the transformed reference points with some mismatched pairs that have no weight
+  static const size_t numPoints = 500;
+  static const size_t numOutliers = 100;
+  QVector<size_t> tDims(1, numPoints);
+  QVector<size_t> cDims(1, 3);
+  DataArray<float>::Pointer pReferencePoints = DataArray<float>::CreateArray(tDims, cDims, "ReferenceCentroids");
+  DataArray<float>::Pointer pMovingPoints = DataArray<float>::CreateArray(tDims, cDims, "MovingCentroids");
+  DataArray<float>::Pointer pWeights = DataArray<float>::CreateArray(tDims, QVector<size_t>(1, 1), "Weights");
+  float* refPoints = pReferencePoints->getPointer(0);
+  float* movPoints = pMovingPoints->getPointer(0);
+  std::mt19937 generator(7);
+  std::uniform_real_distribution<float> distribution(0.0f, 40.0f);
+  for(size_t i = 0; i < 3 * numPoints; i++)
+    refPoints[i] = 1000.0f + distribution(generator);
+  float* weights = pWeights->getPointer(0);
+  for(size_t i = 0; i < numPoints; i++)
+    weights[i] = 0 == i % 5 ? 0.0f : 1.0f + distribution(generator);
+
+  //moving -> reference: rotate 30 @ 001, shift (5, -3, 2)
+  float translation[3] = {5.0f, -3.0f, 2.0f};
+  float c = std::cos(30.0f * static_cast<float>(SIMPLib::Constants::k_Pi) / 180.0f);
+  float s = std::sin(30.0f * static_cast<float>(SIMPLib::Constants::k_Pi) / 180.0f);
+  float rotation[9] = {c,   -s, 0.0f,
+                       s,    c, 0.0f,
+                       0.0f, 0.0f, 1.0f};
+  for(size_t i = 0; i < numPoints; i++) {
+    float* y = refPoints + 3 * i;
+    for(size_t j = 0; j < 3; j++)
+      movPoints[3 * i + j] = rotation[j] * (y[0] - translation[0]) + rotation[3 + j] * (y[1] - translation[1]) + rotation[6 + j] * (y[2] - translation[2]);
+  }
+
+  //every 5th pair is mismatched (moved at least 10 away from its true position)
+  for(size_t i = 0; i < numOutliers; i++) {
+    float* x = movPoints + 3 * (5 * i);
+    x[0] += 10.0f + distribution(generator);
+    x[1] -= 10.0f + distribution(generator);
+  }
+
+  //create + fill data container
+  AttributeMatrix::Pointer am = AttributeMatrix::New(tDims, DREAM3D::Defaults::FeatureAttributeMatrixName, DREAM3D::AttributeMatrixObjectType::Feature);
+  am->addAttributeArray(pReferencePoints->getName(), pReferencePoints);
+  am->addAttributeArray(pMovingPoints->getName(), pMovingPoints);
+  am->addAttributeArray(pWeights->getName(), pWeights);
+
+  DataContainer::Pointer dc = DataContainer::New(DREAM3D::Defaults::DataContainerName);
+  dc->setGeometry(ImageGeom::CreateGeometry(DREAM3D::Geometry::ImageGeometry));
+  dc->addAttributeMatrix(am->getName(), am);
+
+  DataContainerArray::Pointer dca = DataContainerArray::New();
+  dca->addDataContainer(dc);
+
+  //create register point sets filter and execute
+  QString filtName = "RegisterPointSets";
+  FilterManager* fm = FilterManager::Instance();
+  IFilterFactory::Pointer filterFactory = fm->getFactoryForFilter(filtName);
+  if(NULL != filterFactory.get())
+  {
+    //create filter and set parameters
+    AbstractFilter::Pointer filter = filterFactory->create();
+    filter->setDataContainerArray(dca);
+
+    QVariant var;
+    bool propWasSet;
+    DataArrayPath path;
+
+    var.setValue(false);
+    propWasSet = filter->setProperty("UseGoodPoints", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    var.setValue(true);
+    propWasSet = filter->setProperty("UseWeights", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    path.update(dc->getName(), am->getName(), pWeights->getName());
+    var.setValue(path);
+    propWasSet = filter->setProperty("WeightsArrayPath", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    var.setValue(false);
+    propWasSet = filter->setProperty("AllowScaling", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    var.setValue(false);
+    propWasSet = filter->setProperty("AllowShearing", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    path.update(dc->getName(), am->getName(), pReferencePoints->getName());
+    var.setValue(path);
+    propWasSet = filter->setProperty("ReferenceCentroidsArrayPath", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    path.update(dc->getName(), am->getName(), pMovingPoints->getName());
+    var.setValue(path);
+    propWasSet = filter->setProperty("MovingCentroidsArrayPath", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    filter->execute();
+    DREAM3D_REQUIRED(filter->getErrorCondition(), >= , 0);
+
+    //get computed transformation and compare to applied transformation
+    IDataArray::Pointer iTransform = dc->getAttributeMatrix("Transformation")->getAttributeArray("Transformation");
+    DataArray<float>* pTransform = DataArray<float>::SafePointerDownCast(iTransform.get());
+    DREAM3D_REQUIRE_VALID_POINTER(pTransform)
+    float* transform = pTransform->getPointer(0);
+    for(size_t i = 0; i < 3; i++) {
+      DREAM3D_REQUIRED(std::fabs(rotation[3 * i + 0] - transform[4 * i + 0]), <, 1e-4f)
+      DREAM3D_REQUIRED(std::fabs(rotation[3 * i + 1] - transform[4 * i + 1]), <, 1e-4f)
+      DREAM3D_REQUIRED(std::fabs(rotation[3 * i + 2] - transform[4 * i + 2]), <, 1e-4f)
+      DREAM3D_REQUIRED(std::fabs(translation[i] - transform[4 * i + 3]), <, 1e-2f)
+    }
+  }
+  else
+  {
+    QString ss = QObject::tr("RegisterPointSetsTest Error creating filter '%1'. Filter was not created/executed. Please notify the developers.").arg(filtName);
+    DREAM3D_TEST_THROW_EXCEPTION(ss.toStdString())
+  }
+
+  return EXIT_SUCCESS;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int RegisterPointSetsRANSACTest()
+{
+  //create input points: random reference points, moving points are the transformed reference points with some pairs replaced by random points (mismatched features)
+  static const size_t numPoints = 500;
+  static const size_t numOutliers = 100;
+  QVector<size_t> tDims(1, numPoints);
+  QVector<size_t> cDims(1, 3);
+  DataArray<float>::Pointer pReferencePoints = DataArray<float>::CreateArray(tDims, cDims, "ReferenceCentroids");
+  DataArray<float>::Pointer pMovingPoints = DataArray<float>::CreateArray(tDims, cDims, "MovingCentroids");
+  float* refPoints = pReferencePoints->getPointer(0);
+  float* movPoints = pMovingPoints->getPointer(0);
+  std::mt19937 generator(7);
+  std::uniform_real_distribution<float> distribution(0.0f, 40.0f);
+  for(size_t i = 0; i < 3 * numPoints; i++)
+    refPoints[i] = distribution(generator);
+
+  //moving -> reference: rotate 30 @ 001, shift (5, -3, 2)
+  float translation[3] = {5.0f, -3.0f, 2.0f};
+  float c = std::cos(30.0f * static_cast<float>(SIMPLib::Constants::k_Pi) / 180.0f);
+  float s = std::sin(30.0f * static_cast<float>(SIMPLib::Constants::k_Pi) / 180.0f);
+  float rotation[9] = {c,   -s, 0.0f,
+                       s,    c, 0.0f,
+                       0.0f, 0.0f, 1.0f};
+  for(size_t i = 0; i < numPoints; i++) {
+    float* y = refPoints + 3 * i;
+    for(size_t j = 0; j < 3; j++)
+      movPoints[3 * i + j] = rotation[j] * (y[0] - translation[0]) + rotation[3 + j] * (y[1] - translation[1]) + rotation[6 + j] * (y[2] - translation[2]);
+  }
+
+  //every 5th pair is an outlier (moved at least 10 away from its true position)
+  for(size_t i = 0; i < numOutliers; i++) {
+    float* x = movPoints + 3 * (5 * i);
+    x[0] += 10.0f + distribution(generator);
+    x[1] -= 10.0f + distribution(generator);
+  }
+
+  //create + fill data container
+  AttributeMatrix::Pointer am = AttributeMatrix::New(tDims, DREAM3D::Defaults::FeatureAttributeMatrixName, DREAM3D::AttributeMatrixObjectType::Feature);
+  am->addAttributeArray(pReferencePoints->getName(), pReferencePoints);
+  am->addAttributeArray(pMovingPoints->getName(), pMovingPoints);
+
+  DataContainer::Pointer dc = DataContainer::New(DREAM3D::Defaults::DataContainerName);
+  dc->setGeometry(ImageGeom::CreateGeometry(DREAM3D::Geometry::ImageGeometry));
+  dc->addAttributeMatrix(am->getName(), am);
+
+  DataContainerArray::Pointer dca = DataContainerArray::New();
+  dca->addDataContainer(dc);
+
+  //create register point sets filter and execute
+  QString filtName = "RegisterPointSets";
+  FilterManager* fm = FilterManager::Instance();
+  IFilterFactory::Pointer filterFactory = fm->getFactoryForFilter(filtName);
+  if(NULL != filterFactory.get())
+  {
+    //create filter and set parameters
+    AbstractFilter::Pointer filter = filterFactory->create();
+    filter->setDataContainerArray(dca);
+
+    QVariant var;
+    bool propWasSet;
+    DataArrayPath path;
+
+    var.setValue(false);
+    propWasSet = filter->setProperty("UseGoodPoints", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    var.setValue(false);
+    propWasSet = filter->setProperty("UseWeights", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    var.setValue(false);
+    propWasSet = filter->setProperty("AllowScaling", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    var.setValue(false);
+    propWasSet = filter->setProperty("AllowShearing", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    var.setValue(1);//0: none, 1: RANSAC
+    propWasSet = filter->setProperty("RobustMethod", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    var.setValue(1.0);
+    propWasSet = filter->setProperty("InlierDistance", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    path.update(dc->getName(), am->getName(), pReferencePoints->getName());
+    var.setValue(path);
+    propWasSet = filter->setProperty("ReferenceCentroidsArrayPath", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    path.update(dc->getName(), am->getName(), pMovingPoints->getName());
+    var.setValue(path);
+    propWasSet = filter->setProperty("MovingCentroidsArrayPath", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    filter->execute();
+    DREAM3D_REQUIRED(filter->getErrorCondition(), >= , 0);
+
+    //get computed transformation and compare to applied transformation
+    IDataArray::Pointer iTransform = dc->getAttributeMatrix("Transformation")->getAttributeArray("Transformation");
+    DataArray<float>* pTransform = DataArray<float>::SafePointerDownCast(iTransform.get());
+    DREAM3D_REQUIRE_VALID_POINTER(pTransform)
+    float* transform = pTransform->getPointer(0);
+    for(size_t i = 0; i < 3; i++) {
+      DREAM3D_REQUIRED(std::fabs(rotation[3 * i + 0] - transform[4 * i + 0]), <, 1e-4f)
+      DREAM3D_REQUIRED(std::fabs(rotation[3 * i + 1] - transform[4 * i + 1]), <, 1e-4f)
+      DREAM3D_REQUIRED(std::fabs(rotation[3 * i + 2] - transform[4 * i + 2]), <, 1e-4f)
+      DREAM3D_REQUIRED(std::fabs(translation[i] - transform[4 * i + 3]), <, 1e-3f)
+    }
+
+    //only the corrupted pairs should be outliers
+    IDataArray::Pointer iInliers = am->getAttributeArray("Inliers");
+    DataArray<bool>* pInliers = DataArray<bool>::SafePointerDownCast(iInliers.get());
+    DREAM3D_REQUIRE_VALID_POINTER(pInliers)
+    bool* inliers = pInliers->getPointer(0);
+    for(size_t i = 0; i < numPoints; i++)
+      DREAM3D_REQUIRE_EQUAL(inliers[i], 0 != i % 5)
+
+    //inliers fit exactly and outliers aren't part of the fit
+    IDataArray::Pointer iResiduals = am->getAttributeArray("Residuals");
+    DataArray<float>* pResiduals = DataArray<float>::SafePointerDownCast(iResiduals.get());
+    DREAM3D_REQUIRE_VALID_POINTER(pResiduals)
+    float* residuals = pResiduals->getPointer(0);
+    for(size_t i = 0; i < numPoints; i++) {
+      if(0 == i % 5) {
+        DREAM3D_REQUIRE_EQUAL(residuals[i], -1.0f)
+      } else {
+        DREAM3D_REQUIRED(residuals[i], <, 1e-3f)
+      }
+    }
+
+    AttributeMatrix::Pointer quality = dc->getAttributeMatrix("Transformation");
+    DataArray<float>* pRms = DataArray<float>::SafePointerDownCast(quality->getAttributeArray("RmsResidual").get());
+    DataArray<float>* pMax = DataArray<float>::SafePointerDownCast(quality->getAttributeArray("MaxResidual").get());
+    DataArray<float>* pCondition = DataArray<float>::SafePointerDownCast(quality->getAttributeArray("ConditionNumber").get());
+    DREAM3D_REQUIRE_VALID_POINTER(pRms)
+    DREAM3D_REQUIRE_VALID_POINTER(pMax)
+    DREAM3D_REQUIRE_VALID_POINTER(pCondition)
+    DREAM3D_REQUIRED(pRms->getValue(0), <=, pMax->getValue(0))
+    DREAM3D_REQUIRED(pMax->getValue(0), <, 1e-3f)
+    DREAM3D_REQUIRED(pCondition->getValue(0), >=, 1.0f)
+    DREAM3D_REQUIRED(pCondition->getValue(0), <, 10.0f)
+  }
+  else
+  {
+    QString ss = QObject::tr("RegisterPointSetsTest Error creating filter '%1'. Filter was not created/executed. Please notify the developers.").arg(filtName);
+    DREAM3D_TEST_THROW_EXCEPTION(ss.toStdString())
+  }
+
+  return EXIT_SUCCESS;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int RegisterPointSetsIRLSTest()
+{
+  //create input points: random reference points, moving points are the transformed reference points with noise and some badly mismatched pairs
+  static const size_t numPoints = 500;
+  static const size_t numOutliers = 100;
+  QVector<size_t> tDims(1, numPoints);
+  QVector<size_t> cDims(1, 3);
+  DataArray<float>::Pointer pReferencePoints = DataArray<float>::CreateArray(tDims, cDims, "ReferenceCentroids");
+  DataArray<float>::Pointer pMovingPoints = DataArray<float>::CreateArray(tDims, cDims, "MovingCentroids");
+  float* refPoints = pReferencePoints->getPointer(0);
+  float* movPoints = pMovingPoints->getPointer(0);
+  std::mt19937 generator(7);
+  std::uniform_real_distribution<float> distribution(0.0f, 40.0f);
+  std::normal_distribution<float> noise(0.0f, 0.05f);
+  for(size_t i = 0; i < 3 * numPoints; i++)
+    refPoints[i] = distribution(generator);
+
+  //moving -> reference: rotate 30 @ 001, shift (5, -3, 2)
+  float translation[3] = {5.0f, -3.0f, 2.0f};
+  float c = std::cos(30.0f * static_cast<float>(SIMPLib::Constants::k_Pi) / 180.0f);
+  float s = std::sin(30.0f * static_cast<float>(SIMPLib::Constants::k_Pi) / 180.0f);
+  float rotation[9] = {c,   -s, 0.0f,
+                       s,    c, 0.0f,
+                       0.0f, 0.0f, 1.0f};
+  for(size_t i = 0; i < numPoints; i++) {
+    float* y = refPoints + 3 * i;
+    for(size_t j = 0; j < 3; j++)
+      movPoints[3 * i + j] = rotation[j] * (y[0] - translation[0]) + rotation[3 + j] * (y[1] - translation[1]) + rotation[6 + j] * (y[2] - translation[2]) + noise(generator);
+  }
+
+  //every 5th pair is an outlier (moved at least 10 away from its true position)
+  for(size_t i = 0; i < numOutliers; i++) {
+    float* x = movPoints + 3 * (5 * i);
+    x[0] += 10.0f + distribution(generator);
+    x[1] -= 10.0f + distribution(generator);
+  }
+
+  //create + fill data container
+  AttributeMatrix::Pointer am = AttributeMatrix::New(tDims, DREAM3D::Defaults::FeatureAttributeMatrixName, DREAM3D::AttributeMatrixObjectType::Feature);
+  am->addAttributeArray(pReferencePoints->getName(), pReferencePoints);
+  am->addAttributeArray(pMovingPoints->getName(), pMovingPoints);
+
+  DataContainer::Pointer dc = DataContainer::New(DREAM3D::Defaults::DataContainerName);
+  dc->setGeometry(ImageGeom::CreateGeometry(DREAM3D::Geometry::ImageGeometry));
+  dc->addAttributeMatrix(am->getName(), am);
+
+  DataContainerArray::Pointer dca = DataContainerArray::New();
+  dca->addDataContainer(dc);
+
+  //create register point sets filter and execute
+  QString filtName = "RegisterPointSets";
+  FilterManager* fm = FilterManager::Instance();
+  IFilterFactory::Pointer filterFactory = fm->getFactoryForFilter(filtName);
+  if(NULL != filterFactory.get())
+  {
+    //create filter and set parameters
+    AbstractFilter::Pointer filter = filterFactory->create();
+    filter->setDataContainerArray(dca);
+
+    QVariant var;
+    bool propWasSet;
+    DataArrayPath path;
+
+    var.setValue(false);
+    propWasSet = filter->setProperty("UseGoodPoints", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    var.setValue(false);
+    propWasSet = filter->setProperty("UseWeights", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    var.setValue(false);
+    propWasSet = filter->setProperty("AllowScaling", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    var.setValue(false);
+    propWasSet = filter->setProperty("AllowShearing", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    var.setValue(2);//0: none, 1: RANSAC, 2: M-estimator
+    propWasSet = filter->setProperty("RobustMethod", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    var.setValue(1);//0: Huber, 1: Tukey biweight
+    propWasSet = filter->setProperty("WeightFunction", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    var.setValue(true);
+    propWasSet = filter->setProperty("EstimateUncertainty", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    var.setValue(200);
+    propWasSet = filter->setProperty("BootstrapResamples", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    path.update(dc->getName(), am->getName(), pReferencePoints->getName());
+    var.setValue(path);
+    propWasSet = filter->setProperty("ReferenceCentroidsArrayPath", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    path.update(dc->getName(), am->getName(), pMovingPoints->getName());
+    var.setValue(path);
+    propWasSet = filter->setProperty("MovingCentroidsArrayPath", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    filter->execute();
+    DREAM3D_REQUIRED(filter->getErrorCondition(), >= , 0);
+
+    //get computed transformation and compare to applied transformation (within the noise)
+    IDataArray::Pointer iTransform = dc->getAttributeMatrix("Transformation")->getAttributeArray("Transformation");
+    DataArray<float>* pTransform = DataArray<float>::SafePointerDownCast(iTransform.get());
+    DREAM3D_REQUIRE_VALID_POINTER(pTransform)
+    float* transform = pTransform->getPointer(0);
+    for(size_t i = 0; i < 3; i++) {
+      DREAM3D_REQUIRED(std::fabs(rotation[3 * i + 0] - transform[4 * i + 0]), <, 1e-3f)
+      DREAM3D_REQUIRED(std::fabs(rotation[3 * i + 1] - transform[4 * i + 1]), <, 1e-3f)
+      DREAM3D_REQUIRED(std::fabs(rotation[3 * i + 2] - transform[4 * i + 2]), <, 1e-3f)
+      DREAM3D_REQUIRED(std::fabs(translation[i] - transform[4 * i + 3]), <, 2e-2f)
+    }
+
+    //bootstrap spread of the translation should be on the order of the noise over the square root of the number of inliers and cover the actual error
+    IDataArray::Pointer iUncertainty = dc->getAttributeMatrix("Transformation")->getAttributeArray("TransformationUncertainty");
+    DataArray<float>* pUncertainty = DataArray<float>::SafePointerDownCast(iUncertainty.get());
+    DREAM3D_REQUIRE_VALID_POINTER(pUncertainty)
+    DREAM3D_REQUIRE_EQUAL(pUncertainty->getNumberOfComponents(), 12)
+    float* uncertainty = pUncertainty->getPointer(0);
+    for(size_t i = 0; i < 3; i++) {
+      DREAM3D_REQUIRED(uncertainty[8 + i], >, 1e-4f)
+      DREAM3D_REQUIRED(uncertainty[8 + i], <, 2e-2f)
+      DREAM3D_REQUIRED(std::fabs(translation[i] - transform[4 * i + 3]), <, 5.0f * uncertainty[8 + i])
+    }
+
+    //rotation angle spread is small but nonzero, the percentile bounds the rms, and rigid fits have no scale spread
+    DREAM3D_REQUIRED(uncertainty[0], >, 0.0f)
+    DREAM3D_REQUIRED(uncertainty[0], <, 0.1f)
+    DREAM3D_REQUIRED(uncertainty[1], >=, uncertainty[0])
+    for(size_t i = 0; i < 3; i++) {
+      DREAM3D_REQUIRED(uncertainty[2 + i], >, 0.0f)
+      DREAM3D_REQUIRED(uncertainty[5 + i], <, 1e-5f)
+    }
+    DREAM3D_REQUIRE_EQUAL(uncertainty[11], 0.0f)
+  }
+  else
+  {
+    QString ss = QObject::tr("RegisterPointSetsTest Error creating filter '%1'. Filter was not created/executed. Please notify the developers.").arg(filtName);
+    DREAM3D_TEST_THROW_EXCEPTION(ss.toStdString())
+  }
+
+  return EXIT_SUCCESS;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int RegisterPointSetsDescriptorTest()
+{
+  //create input points: random reference points with random shape descriptors, moving points are the transformed reference points in a different order with some unmatched points
+  static const size_t numPoints = 500;
+  static const size_t numComponents = 4;
+  QVector<size_t> tDims(1, numPoints);
+  QVector<size_t> cDims(1, 3);
+  QVector<size_t> dDims(1, numComponents);
+  DataArray<float>::Pointer pReferencePoints = DataArray<float>::CreateArray(tDims, cDims, "ReferenceCentroids");
+  DataArray<float>::Pointer pMovingPoints = DataArray<float>::CreateArray(tDims, cDims, "MovingCentroids");
+  DataArray<float>::Pointer pReferenceDescriptors = DataArray<float>::CreateArray(tDims, dDims, "ReferenceDescriptors");
+  DataArray<float>::Pointer pMovingDescriptors = DataArray<float>::CreateArray(tDims, dDims, "MovingDescriptors");
+  float* refPoints = pReferencePoints->getPointer(0);
+  float* movPoints = pMovingPoints->getPointer(0);
+  float* refDescriptors = pReferenceDescriptors->getPointer(0);
+  float* movDescriptors = pMovingDescriptors->getPointer(0);
+  std::mt19937 generator(11);
+  std::uniform_real_distribution<float> distribution(0.0f, 100.0f);
+  for(size_t i = 0; i < 3 * numPoints; i++)
+    refPoints[i] = distribution(generator);
+  for(size_t i = 0; i < numComponents * numPoints; i++)
+    refDescriptors[i] = distribution(generator) * (1 + i % numComponents);//components with different scales (e.g. volume and aspect ratio)
+
+  //moving -> reference: rotate 120 @ 111, shift (50, -30, 20) so the sets aren't close to aligned
+  float translation[3] = {50.0f, -30.0f, 20.0f};
+  float rotation[9] = {0.0f, 0.0f, 1.0f,
+                       1.0f, 0.0f, 0.0f,
+                       0.0f, 1.0f, 0.0f};
+  std::normal_distribution<float> noise(0.0f, 0.02f);
+  for(size_t i = 0; i < numPoints; i++) {
+    //every 10th moving point has no counterpart
+    if(0 == i % 10) {
+      for(size_t j = 0; j < 3; j++)
+        movPoints[3 * i + j] = distribution(generator);
+      for(size_t j = 0; j < numComponents; j++)
+        movDescriptors[numComponents * i + j] = distribution(generator) * (1 + j);
+      continue;
+    }
+
+    //moving points are in a different order than the reference points with slightly different descriptors
+    size_t r = (7 * i + 3) % numPoints;
+    float* y = refPoints + 3 * r;
+    for(size_t j = 0; j < 3; j++)
+      movPoints[3 * i + j] = rotation[j] * (y[0] - translation[0]) + rotation[3 + j] * (y[1] - translation[1]) + rotation[6 + j] * (y[2] - translation[2]);
+    for(size_t j = 0; j < numComponents; j++)
+      movDescriptors[numComponents * i + j] = refDescriptors[numComponents * r + j] * (1.0f + noise(generator));
+  }
+
+  //create + fill data container
+  AttributeMatrix::Pointer am = AttributeMatrix::New(tDims, DREAM3D::Defaults::FeatureAttributeMatrixName, DREAM3D::AttributeMatrixObjectType::Feature);
+  am->addAttributeArray(pReferencePoints->getName(), pReferencePoints);
+  am->addAttributeArray(pMovingPoints->getName(), pMovingPoints);
+  am->addAttributeArray(pReferenceDescriptors->getName(), pReferenceDescriptors);
+  am->addAttributeArray(pMovingDescriptors->getName(), pMovingDescriptors);
+
+  DataContainer::Pointer dc = DataContainer::New(DREAM3D::Defaults::DataContainerName);
+  dc->setGeometry(ImageGeom::CreateGeometry(DREAM3D::Geometry::ImageGeometry));
+  dc->addAttributeMatrix(am->getName(), am);
+
+  DataContainerArray::Pointer dca = DataContainerArray::New();
+  dca->addDataContainer(dc);
+
+  //create register point sets filter and execute
+  QString filtName = "RegisterPointSets";
+  FilterManager* fm = FilterManager::Instance();
+  IFilterFactory::Pointer filterFactory = fm->getFactoryForFilter(filtName);
+  if(NULL != filterFactory.get())
+  {
+    //create filter and set parameters
+    AbstractFilter::Pointer filter = filterFactory->create();
+    filter->setDataContainerArray(dca);
+
+    QVariant var;
+    bool propWasSet;
+    DataArrayPath path;
+
+    var.setValue(false);
+    propWasSet = filter->setProperty("UseGoodPoints", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    var.setValue(false);
+    propWasSet = filter->setProperty("UseWeights", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    var.setValue(false);
+    propWasSet = filter->setProperty("AllowScaling", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    var.setValue(false);
+    propWasSet = filter->setProperty("AllowShearing", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    var.setValue(2);//0: matching indices, 1: ICP, 2: shape descriptors
+    propWasSet = filter->setProperty("CorrespondenceType", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    var.setValue(1);//0: none, 1: RANSAC
+    propWasSet = filter->setProperty("RobustMethod", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    var.setValue(1.0);
+    propWasSet = filter->setProperty("InlierDistance", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    path.update(dc->getName(), am->getName(), pReferencePoints->getName());
+    var.setValue(path);
+    propWasSet = filter->setProperty("ReferenceCentroidsArrayPath", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    path.update(dc->getName(), am->getName(), pMovingPoints->getName());
+    var.setValue(path);
+    propWasSet = filter->setProperty("MovingCentroidsArrayPath", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    path.update(dc->getName(), am->getName(), pReferenceDescriptors->getName());
+    var.setValue(path);
+    propWasSet = filter->setProperty("ReferenceDescriptorsArrayPath", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    path.update(dc->getName(), am->getName(), pMovingDescriptors->getName());
+    var.setValue(path);
+    propWasSet = filter->setProperty("MovingDescriptorsArrayPath", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    filter->execute();
+    DREAM3D_REQUIRED(filter->getErrorCondition(), >= , 0);
+
+    //get computed transformation and compare to applied transformation
+    IDataArray::Pointer iTransform = dc->getAttributeMatrix("Transformation")->getAttributeArray("Transformation");
+    DataArray<float>* pTransform = DataArray<float>::SafePointerDownCast(iTransform.get());
+    DREAM3D_REQUIRE_VALID_POINTER(pTransform)
+    float* transform = pTransform->getPointer(0);
+    for(size_t i = 0; i < 3; i++) {
+      DREAM3D_REQUIRED(std::fabs(rotation[3 * i + 0] - transform[4 * i + 0]), <, 1e-4f)
+      DREAM3D_REQUIRED(std::fabs(rotation[3 * i + 1] - transform[4 * i + 1]), <, 1e-4f)
+      DREAM3D_REQUIRED(std::fabs(rotation[3 * i + 2] - transform[4 * i + 2]), <, 1e-4f)
+      DREAM3D_REQUIRED(std::fabs(translation[i] - transform[4 * i + 3]), <, 1e-2f)
+    }
+
+    //unmatched points can't be inliers and most matched points should be found
+    IDataArray::Pointer iInliers = am->getAttributeArray("Inliers");
+    DataArray<bool>* pInliers = DataArray<bool>::SafePointerDownCast(iInliers.get());
+    DREAM3D_REQUIRE_VALID_POINTER(pInliers)
+    bool* inliers = pInliers->getPointer(0);
+    size_t numInliers = 0;
+    for(size_t i = 0; i < numPoints; i++) {
+      if(0 == i % 10) {
+        DREAM3D_REQUIRE_EQUAL(inliers[i], false)
+      } else if(inliers[i]) {
+        ++numInliers;
+      }
+    }
+    DREAM3D_REQUIRED(numInliers, >, numPoints / 2)
+  }
+  else
+  {
+    QString ss = QObject::tr("RegisterPointSetsTest Error creating filter '%1'. Filter was not created/executed. Please notify the developers.").arg(filtName);
+    DREAM3D_TEST_THROW_EXCEPTION(ss.toStdString())
+  }
+
+  return EXIT_SUCCESS;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int RegisterPointSetsBatchTest()
+{
+  //create a series of steps: random points for the first step, each following step holds the previous step's points under a different transformation
+  static const size_t numPoints = 200;
+  static const size_t numSteps = 4;
+  QVector<size_t> tDims(1, numPoints);
+  QVector<size_t> cDims(1, 3);
+  DataContainerArray::Pointer dca = DataContainerArray::New();
+  std::mt19937 generator(3);
+  std::uniform_real_distribution<float> distribution(0.0f, 40.0f);
+  std::vector<float> rotations(9 * (numSteps - 1)), translations(3 * (numSteps - 1));
+  float* previousPoints = NULL;
+  for(size_t k = 0; k < numSteps; k++)
+  {
+    DataArray<float>::Pointer pPoints = DataArray<float>::CreateArray(tDims, cDims, "Centroids");
+    float* points = pPoints->getPointer(0);
+    if(0 == k) {
+      for(size_t i = 0; i < 3 * numPoints; i++)
+        points[i] = distribution(generator);
+    } else {
+      //step k -> step k - 1: rotate 10k @ 001, shift (k, -2k, 3)
+      float* rotation = rotations.data() + 9 * (k - 1);
+      float* translation = translations.data() + 3 * (k - 1);
+      float c = std::cos(10.0f * k * static_cast<float>(SIMPLib::Constants::k_Pi) / 180.0f);
+      float s = std::sin(10.0f * k * static_cast<float>(SIMPLib::Constants::k_Pi) / 180.0f);
+      rotation[0] = c;    rotation[1] = -s;   rotation[2] = 0.0f;
+      rotation[3] = s;    rotation[4] = c;    rotation[5] = 0.0f;
+      rotation[6] = 0.0f; rotation[7] = 0.0f; rotation[8] = 1.0f;
+      translation[0] = static_cast<float>(k);
+      translation[1] = -2.0f * k;
+      translation[2] = 3.0f;
+      for(size_t i = 0; i < numPoints; i++) {
+        float* y = previousPoints + 3 * i;
+        for(size_t j = 0; j < 3; j++)
+          points[3 * i + j] = rotation[j] * (y[0] - translation[0]) + rotation[3 + j] * (y[1] - translation[1]) + rotation[6 + j] * (y[2] - translation[2]);
+      }
+    }
+    previousPoints = points;
+
+    AttributeMatrix::Pointer am = AttributeMatrix::New(tDims, DREAM3D::Defaults::FeatureAttributeMatrixName, DREAM3D::AttributeMatrixObjectType::Feature);
+    am->addAttributeArray(pPoints->getName(), pPoints);
+    DataContainer::Pointer dc = DataContainer::New(QString("Section%1").arg(k));
+    dc->setGeometry(ImageGeom::CreateGeometry(DREAM3D::Geometry::ImageGeometry));
+    dc->addAttributeMatrix(am->getName(), am);
+    dca->addDataContainer(dc);
+  }
+
+  //create register point sets filter and execute
+  QString filtName = "RegisterPointSets";
+  FilterManager* fm = FilterManager::Instance();
+  IFilterFactory::Pointer filterFactory = fm->getFactoryForFilter(filtName);
+  if(NULL != filterFactory.get())
+  {
+    //create filter and set parameters
+    AbstractFilter::Pointer filter = filterFactory->create();
+    filter->setDataContainerArray(dca);
+
+    QVariant var;
+    bool propWasSet;
+    DataArrayPath path;
+
+    var.setValue(false);
+    propWasSet = filter->setProperty("UseGoodPoints", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    var.setValue(false);
+    propWasSet = filter->setProperty("UseWeights", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    var.setValue(false);
+    propWasSet = filter->setProperty("AllowScaling", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    var.setValue(false);
+    propWasSet = filter->setProperty("AllowShearing", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    var.setValue(true);
+    propWasSet = filter->setProperty("BatchRegistration", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    var.setValue(QString("Section"));
+    propWasSet = filter->setProperty("DataContainerPrefix", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    //the selected arrays give the attribute matrix and array names of every step
+    path.update("Section0", DREAM3D::Defaults::FeatureAttributeMatrixName, "Centroids");
+    var.setValue(path);
+    propWasSet = filter->setProperty("ReferenceCentroidsArrayPath", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    path.update("Section1", DREAM3D::Defaults::FeatureAttributeMatrixName, "Centroids");
+    var.setValue(path);
+    propWasSet = filter->setProperty("MovingCentroidsArrayPath", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    filter->execute();
+    DREAM3D_REQUIRED(filter->getErrorCondition(), >= , 0);
+
+    //get stacked transformations and compare to the applied transformations
+    IDataArray::Pointer iTransform = dca->getDataContainer("Section0")->getAttributeMatrix("Transformation")->getAttributeArray("Transformation");
+    DataArray<float>* pTransform = DataArray<float>::SafePointerDownCast(iTransform.get());
+    DREAM3D_REQUIRE_VALID_POINTER(pTransform)
+    DREAM3D_REQUIRE_EQUAL(pTransform->getNumberOfTuples(), numSteps - 1)
+    for(size_t k = 0; k < numSteps - 1; k++) {
+      float* transform = pTransform->getPointer(16 * k);
+      float* rotation = rotations.data() + 9 * k;
+      float* translation = translations.data() + 3 * k;
+      for(size_t i = 0; i < 3; i++) {
+        DREAM3D_REQUIRED(std::fabs(rotation[3 * i + 0] - transform[4 * i + 0]), <, 1e-4f)
+        DREAM3D_REQUIRED(std::fabs(rotation[3 * i + 1] - transform[4 * i + 1]), <, 1e-4f)
+        DREAM3D_REQUIRED(std::fabs(rotation[3 * i + 2] - transform[4 * i + 2]), <, 1e-4f)
+        DREAM3D_REQUIRED(std::fabs(translation[i] - transform[4 * i + 3]), <, 1e-3f)
+      }
+    }
+
+    //residuals are stored next to the points of each moving step
+    for(size_t k = 1; k < numSteps; k++) {
+      AttributeMatrix::Pointer am = dca->getDataContainer(QString("Section%1").arg(k))->getAttributeMatrix(DREAM3D::Defaults::FeatureAttributeMatrixName);
+      DataArray<float>* pResiduals = DataArray<float>::SafePointerDownCast(am->getAttributeArray("Residuals").get());
+      DREAM3D_REQUIRE_VALID_POINTER(pResiduals)
+      for(size_t i = 0; i < numPoints; i++) {
+        DREAM3D_REQUIRED(pResiduals->getValue(i), >=, 0.0f)
+        DREAM3D_REQUIRED(pResiduals->getValue(i), <, 1e-3f)
+      }
+    }
+  }
+  else
+  {
+    QString ss = QObject::tr("RegisterPointSetsTest Error creating filter '%1'. Filter was not created/executed. Please notify the developers.").arg(filtName);
+    DREAM3D_TEST_THROW_EXCEPTION(ss.toStdString())
+  }
+
+  return EXIT_SUCCESS;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int RegisterPointSetsBatchPairsTest()
+{
+  //create a 2x2 mosaic of tiles: every tile holds the same random points shifted by the stage position of the tile
+  //each tile is registered to its left and lower neighbors, so the bottom right tile is the moving step of 2 pairs
+  static const size_t numPoints = 200;
+  static const size_t numTiles = 4;
+  static const size_t numPairs = 4;
+  QVector<size_t> tDims(1, numPoints);
+  QVector<size_t> cDims(1, 3);
+  DataContainerArray::Pointer dca = DataContainerArray::New();
+  std::mt19937 generator(5);
+  std::uniform_real_distribution<float> distribution(0.0f, 40.0f);
+  std::vector<float> globalPoints(3 * numPoints);
+  for(size_t i = 0; i < 3 * numPoints; i++)
+    globalPoints[i] = distribution(generator);
+
+  const char* tileNames[numTiles] = {"Tile_0_0", "Tile_1_0", "Tile_0_1", "Tile_1_1"};
+  const float offsets[3 * numTiles] = { 0.0f,  0.0f, 0.0f,
+                                       30.0f,  1.0f, 0.5f,
+                                       -2.0f, 25.0f, 0.0f,
+                                       28.0f, 27.0f, 1.5f};
+  for(size_t k = 0; k < numTiles; k++)
+  {
+    DataArray<float>::Pointer pPoints = DataArray<float>::CreateArray(tDims, cDims, "Centroids");
+    float* points = pPoints->getPointer(0);
+    for(size_t i = 0; i < numPoints; i++)
+      for(size_t j = 0; j < 3; j++)
+        points[3 * i + j] = globalPoints[3 * i + j] - offsets[3 * k + j];
+
+    AttributeMatrix::Pointer am = AttributeMatrix::New(tDims, DREAM3D::Defaults::FeatureAttributeMatrixName, DREAM3D::AttributeMatrixObjectType::Feature);
+    am->addAttributeArray(pPoints->getName(), pPoints);
+    DataContainer::Pointer dc = DataContainer::New(tileNames[k]);
+    dc->setGeometry(ImageGeom::CreateGeometry(DREAM3D::Geometry::ImageGeometry));
+    dc->addAttributeMatrix(am->getName(), am);
+    dca->addDataContainer(dc);
+  }
+
+  //(reference, moving) tile indices of each pair
+  const size_t pairTiles[numPairs][2] = {{0, 1}, {0, 2}, {1, 3}, {2, 3}};
+
+  //create register point sets filter and execute
+  QString filtName = "RegisterPointSets";
+  FilterManager* fm = FilterManager::Instance();
+  IFilterFactory::Pointer filterFactory = fm->getFactoryForFilter(filtName);
+  if(NULL != filterFactory.get())
+  {
+    //create filter and set parameters
+    AbstractFilter::Pointer filter = filterFactory->create();
+    filter->setDataContainerArray(dca);
+
+    QVariant var;
+    bool propWasSet;
+    DataArrayPath path;
+
+    var.setValue(false);
+    propWasSet = filter->setProperty("UseGoodPoints", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    var.setValue(false);
+    propWasSet = filter->setProperty("UseWeights", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    var.setValue(false);
+    propWasSet = filter->setProperty("AllowScaling", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    var.setValue(false);
+    propWasSet = filter->setProperty("AllowShearing", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    var.setValue(true);
+    propWasSet = filter->setProperty("BatchRegistration", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    var.setValue(QString("Tile_0_0,Tile_1_0; Tile_0_0,Tile_0_1; Tile_1_0,Tile_1_1; Tile_0_1,Tile_1_1"));
+    propWasSet = filter->setProperty("RegistrationPairs", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    //the selected arrays give the attribute matrix and array names of every tile
+    path.update(tileNames[0], DREAM3D::Defaults::FeatureAttributeMatrixName, "Centroids");
+    var.setValue(path);
+    propWasSet = filter->setProperty("ReferenceCentroidsArrayPath", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    path.update(tileNames[1], DREAM3D::Defaults::FeatureAttributeMatrixName, "Centroids");
+    var.setValue(path);
+    propWasSet = filter->setProperty("MovingCentroidsArrayPath", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    filter->execute();
+    DREAM3D_REQUIRED(filter->getErrorCondition(), >= , 0);
+
+    //pair i should be a pure translation by the difference in stage positions (moving tile - reference tile)
+    IDataArray::Pointer iTransform = dca->getDataContainer(tileNames[0])->getAttributeMatrix("Transformation")->getAttributeArray("Transformation");
+    DataArray<float>* pTransform = DataArray<float>::SafePointerDownCast(iTransform.get());
+    DREAM3D_REQUIRE_VALID_POINTER(pTransform)
+    DREAM3D_REQUIRE_EQUAL(pTransform->getNumberOfTuples(), numPairs)
+    for(size_t k = 0; k < numPairs; k++) {
+      float* transform = pTransform->getPointer(16 * k);
+      const float* reference = offsets + 3 * pairTiles[k][0];
+      const float* moving = offsets + 3 * pairTiles[k][1];
+      for(size_t i = 0; i < 3; i++) {
+        for(size_t j = 0; j < 3; j++) {
+          DREAM3D_REQUIRED(std::fabs((i == j ? 1.0f : 0.0f) - transform[4 * i + j]), <, 1e-4f)
+        }
+        DREAM3D_REQUIRED(std::fabs(moving[i] - reference[i] - transform[4 * i + 3]), <, 1e-3f)
+      }
+    }
+
+    //residuals of each pair are stored next to the moving tile's points, named by the reference tile
+    for(size_t k = 0; k < numPairs; k++) {
+      AttributeMatrix::Pointer am = dca->getDataContainer(tileNames[pairTiles[k][1]])->getAttributeMatrix(DREAM3D::Defaults::FeatureAttributeMatrixName);
+      DataArray<float>* pResiduals = DataArray<float>::SafePointerDownCast(am->getAttributeArray(QString("Residuals_") + tileNames[pairTiles[k][0]]).get());
+      DREAM3D_REQUIRE_VALID_POINTER(pResiduals)
+      for(size_t i = 0; i < numPoints; i++) {
+        DREAM3D_REQUIRED(pResiduals->getValue(i), >=, 0.0f)
+        DREAM3D_REQUIRED(pResiduals->getValue(i), <, 1e-3f)
+      }
+    }
+
+    //pairs naming missing data containers are rejected
+    var.setValue(QString("Tile_0_0,Tile_1_0; Tile_0_0,Tile_2_0"));
+    propWasSet = filter->setProperty("RegistrationPairs", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+    filter->preflight();
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCondition(), -1009)
+  }
+  else
+  {
+    QString ss = QObject::tr("RegisterPointSetsTest Error creating filter '%1'. Filter was not created/executed. Please notify the developers.").arg(filtName);
+    DREAM3D_TEST_THROW_EXCEPTION(ss.toStdString())
+  }
+
+  return EXIT_SUCCESS;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -260,6 +1258,13 @@ int main(int argc, char** argv)
   DREAM3D_REGISTER_TEST( TestFilterAvailability() );
 
   DREAM3D_REGISTER_TEST( RegisterPointSetsTest() )
+  DREAM3D_REGISTER_TEST( RegisterPointSetsICPTest() )
+  DREAM3D_REGISTER_TEST( RegisterPointSetsWeightedTest() )
+  DREAM3D_REGISTER_TEST( RegisterPointSetsRANSACTest() )
+  DREAM3D_REGISTER_TEST( RegisterPointSetsIRLSTest() )
+  DREAM3D_REGISTER_TEST( RegisterPointSetsDescriptorTest() )
+  DREAM3D_REGISTER_TEST( RegisterPointSetsBatchTest() )
+  DREAM3D_REGISTER_TEST( RegisterPointSetsBatchPairsTest() )
 
   PRINT_TEST_SUMMARY();
   return err;
@@ -17,6 +17,10 @@
  *                                                                             *
  * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
+#include <algorithm>
+#include <random>
+#include <vector>
+
 #include <QtCore/QCoreApplication>
 #include <QtCore/QFile>
 
@@ -184,6 +188,118 @@ int RenumberFeaturesTest()
   return EXIT_SUCCESS;
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int RenumberFeaturesGridTest()
+{
+  //features are consecutive segments (in raster order) of distinct lengths so runs cross rows, labels are shuffled
+  //the same ids are renumbered on an image geometry (one run at a time) and without a geometry (voxel by voxel)
+  size_t dims[] = {16, 12, 10};
+  const size_t numCells = dims[0] * dims[1] * dims[2];
+  const int32_t numFeatures = 61;//61 * 62 / 2 = 1891 voxels, the rest are feature 0
+  std::vector<int32_t> labels(numFeatures);
+  for(int32_t i = 0; i < numFeatures; i++)
+    labels[i] = i + 1;
+  std::mt19937 gen(5489);
+  std::shuffle(labels.begin(), labels.end(), gen);
+
+  std::vector<int32_t> ids(numCells, 0), expectedIds(numCells, 0);
+  std::vector<int32_t> sizes(numFeatures + 1, 0);
+  size_t cell = 0;
+  for(int32_t length = 1; length <= numFeatures; length++)
+  {
+    int32_t label = labels[length - 1];
+    sizes[label] = length;
+    for(int32_t i = 0; i < length; i++, cell++)
+    {
+      ids[cell] = label;
+      expectedIds[cell] = numFeatures - length + 1;//descending by size
+    }
+  }
+
+  DataContainerArray::Pointer dca = DataContainerArray::New();
+  QVector<size_t> cDims(1, 1);
+  for(int geometry = 0; geometry < 2; geometry++)
+  {
+    QVector<size_t> tDims(1, numCells);
+    AttributeMatrix::Pointer cellAm = AttributeMatrix::New(tDims, DREAM3D::Defaults::CellAttributeMatrixName, DREAM3D::AttributeMatrixType::Cell);
+    DataArray<int32_t>::Pointer featureIds = DataArray<int32_t>::CreateArray(tDims, cDims, "FeatureIds");
+    std::copy(ids.begin(), ids.end(), featureIds->getPointer(0));
+    cellAm->addAttributeArray(featureIds->getName(), featureIds);
+
+    tDims[0] = numFeatures + 1;
+    AttributeMatrix::Pointer featAm = AttributeMatrix::New(tDims, "CellFeatureData", DREAM3D::AttributeMatrixType::CellFeature);
+    DataArray<int32_t>::Pointer featureSizes = DataArray<int32_t>::CreateArray(tDims, cDims, "NumCells");
+    std::copy(sizes.begin(), sizes.end(), featureSizes->getPointer(0));
+    featAm->addAttributeArray(featureSizes->getName(), featureSizes);
+
+    DataContainer::Pointer dc = DataContainer::New(0 == geometry ? "grid" : "cells");
+    if(0 == geometry)
+    {
+      ImageGeom::Pointer image = ImageGeom::CreateGeometry(DREAM3D::Geometry::ImageGeometry);
+      image->setDimensions(dims);
+      dc->setGeometry(image);
+    }
+    dc->addAttributeMatrix(cellAm->getName(), cellAm);
+    dc->addAttributeMatrix(featAm->getName(), featAm);
+    dca->addDataContainer(dc);
+  }
+
+  //create filter, execute, and check results
+  QString filtName = "RenumberFeatures";
+  FilterManager* fm = FilterManager::Instance();
+  IFilterFactory::Pointer filterFactory = fm->getFactoryForFilter(filtName);
+  if(NULL != filterFactory.get())
+  {
+    QList<QString> dcNames = dca->getDataContainerNames();
+    for(QList<QString>::iterator iter = dcNames.begin(); iter != dcNames.end(); ++iter)
+    {
+      AbstractFilter::Pointer filter = filterFactory->create();
+      filter->setDataContainerArray(dca);
+
+      QVariant var;
+      bool propWasSet;
+      DataArrayPath path;
+
+      var.setValue(0);//0: Descending, 1: Ascending
+      propWasSet = filter->setProperty("Order", var);
+      DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+      path.update(*iter, DREAM3D::Defaults::CellAttributeMatrixName, "FeatureIds");
+      var.setValue(path);
+      propWasSet = filter->setProperty("FeatureIdsArrayPath", var);
+      DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+      path.update(*iter, "CellFeatureData", "NumCells");
+      var.setValue(path);
+      propWasSet = filter->setProperty("ScalarArrayPath", var);
+      DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+      filter->execute();
+      DREAM3D_REQUIRED(filter->getErrorCondition(), >= , 0);
+
+      DataArray<int32_t>* pFeatureIds = DataArray<int32_t>::SafePointerDownCast(dca->getDataContainer(*iter)->getAttributeMatrix(DREAM3D::Defaults::CellAttributeMatrixName)->getAttributeArray("FeatureIds").get());
+      DataArray<int32_t>* pNumCells = DataArray<int32_t>::SafePointerDownCast(dca->getDataContainer(*iter)->getAttributeMatrix("CellFeatureData")->getAttributeArray("NumCells").get());
+      DREAM3D_REQUIRE_VALID_POINTER(pFeatureIds)
+      DREAM3D_REQUIRE_VALID_POINTER(pNumCells)
+      for(size_t i = 0; i < numCells; i++) {
+        DREAM3D_REQUIRE_EQUAL(pFeatureIds->getValue(i), expectedIds[i])
+      }
+      for(int32_t i = 1; i <= numFeatures; i++) {
+        DREAM3D_REQUIRE_EQUAL(pNumCells->getValue(i), numFeatures - i + 1)
+      }
+    }
+  }
+  else
+  {
+    QString ss = QObject::tr("RenumberFeaturesTest Error creating filter '%1'. Filter was not created/executed. Please notify the developers.").arg(filtName);
+    DREAM3D_TEST_THROW_EXCEPTION(ss.toStdString())
+  }
+
+  return EXIT_SUCCESS;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -213,6 +329,7 @@ int main(int argc, char** argv)
   DREAM3D_REGISTER_TEST( TestFilterAvailability() );
 
   DREAM3D_REGISTER_TEST( RenumberFeaturesTest() )
+  DREAM3D_REGISTER_TEST( RenumberFeaturesGridTest() )
 
   PRINT_TEST_SUMMARY();
   return err;
@@ -0,0 +1,220 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ *                                                                             *
+ * Copyright (c) 2015 William Lenthe                                           *
+ *                                                                             *
+ * This program is free software: you can redistribute it and/or modify        *
+ * it under the terms of the GNU Lesser General Public License as published by *
+ * the Free Software Foundation, either version 3 of the License, or           *
+ * (at your option) any later version.                                         *
+ *                                                                             *
+ * This program is distributed in the hope that it will be useful,             *
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of              *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the               *
+ * GNU Lesser General Public License for more details.                         *
+ *                                                                             *
+ * You should have received a copy of the GNU Lesser General Public License    *
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.       *
+ *                                                                             *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#include <QtCore/QCoreApplication>
+#include <QtCore/QFile>
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/Common/SIMPLibSetGetMacros.h"
+#include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/DataArrays/NeighborList.hpp"
+#include "SIMPLib/Common/FilterPipeline.h"
+#include "SIMPLib/Common/FilterManager.h"
+#include "SIMPLib/Common/FilterFactory.hpp"
+#include "SIMPLib/Plugin/ISIMPLibPlugin.h"
+#include "SIMPLib/Plugin/SIMPLibPluginLoader.h"
+#include "SIMPLib/Utilities/UnitTestSupport.hpp"
+#include "SIMPLib/Utilities/QMetaObjectUtilities.h"
+
+#include "H5Support/QH5Lite.h"
+#include "H5Support/QH5Utilities.h"
+
+#include "DataFusionTestFileLocations.h"
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int TestFilterAvailability()
+{
+  QString filtName = "TrackFeatureIds";
+  FilterManager* fm = FilterManager::Instance();
+  IFilterFactory::Pointer filterFactory = fm->getFactoryForFilter(filtName);
+  if (NULL == filterFactory.get())
+  {
+    std::stringstream ss;
+    ss << "The TrackFeatureIdsTest Requires the use of the " << filtName.toStdString() << " filter which is found in the DataFusion Plugin";
+    DREAM3D_TEST_THROW_EXCEPTION(ss.str())
+  }
+  return 0;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int TrackFeatureIdsTest()
+{
+  //cell data of each time step (feature 2 of the first steps ends and a new feature appears in the last step)
+  size_t dims[] = {8, 1, 1};
+  const size_t numSteps = 3;
+  int32_t stepID[numSteps][8] = { {1, 1, 2, 2, 3, 3, 0, 0},
+                                  {3, 3, 1, 1, 2, 2, 0, 0},
+                                  {1, 1, 1, 2, 2, 2, 3, 3} };
+  int32_t trackedID[numSteps][8] = { {1, 1, 2, 2, 3, 3, 0, 0},
+                                     {1, 1, 2, 2, 3, 3, 0, 0},
+                                     {1, 1, 1, 3, 3, 3, 4, 4} };
+
+  //track data
+  int64_t stepVolumes[] = {0, 0, 0, 2, 2, 3, 2, 2, 0, 2, 2, 3, 0, 0, 2};
+  int32_t firstStep[] = {-1, 0, 0, 0, 2};
+  int32_t lastStep[] = {-1, 2, 1, 2, 2};
+
+  //fill a data container for each time step (last step first, steps must be ordered by name not insertion)
+  DataContainerArray::Pointer dca = DataContainerArray::New();
+  QVector<size_t> cDims(1, 1);
+  for(size_t r = 0; r < numSteps; r++)
+  {
+    size_t s = numSteps - 1 - r;
+    QVector<size_t> tDims(1, dims[0]);
+    AttributeMatrix::Pointer cellAm = AttributeMatrix::New(tDims, DREAM3D::Defaults::CellAttributeMatrixName, DREAM3D::AttributeMatrixType::Cell);
+    DataArray<int32_t>::Pointer featureIds = DataArray<int32_t>::CreateArray(tDims, cDims, DREAM3D::CellData::FeatureIds);
+    for(size_t i = 0; i < tDims[0]; i++) featureIds->setValue(i, stepID[s][i]);
+    cellAm->addAttributeArray(featureIds->getName(), featureIds);
+
+    tDims[0] = 4;
+    AttributeMatrix::Pointer cellFeatAm = AttributeMatrix::New(tDims, DREAM3D::Defaults::CellFeatureAttributeMatrixName, DREAM3D::AttributeMatrixType::CellFeature);
+    DataArray<int32_t>::Pointer numCells = DataArray<int32_t>::CreateArray(tDims, cDims, "NumCells");
+    numCells->initializeWithZeros();
+    cellFeatAm->addAttributeArray(numCells->getName(), numCells);
+
+    ImageGeom::Pointer image = ImageGeom::CreateGeometry(DREAM3D::Geometry::ImageGeometry);
+    image->setDimensions(dims);
+    DataContainer::Pointer dc = DataContainer::New(QString("Step%1").arg(s));
+    dc->setGeometry(image);
+    dc->addAttributeMatrix(cellAm->getName(), cellAm);
+    dc->addAttributeMatrix(cellFeatAm->getName(), cellFeatAm);
+    dca->addDataContainer(dc);
+  }
+
+  //create track feature ids filter and execute
+  QString filtName = "TrackFeatureIds";
+  FilterManager* fm = FilterManager::Instance();
+  IFilterFactory::Pointer filterFactory = fm->getFactoryForFilter(filtName);
+  if(NULL != filterFactory.get())
+  {
+    //create filter and set parameters
+    AbstractFilter::Pointer filter = filterFactory->create();
+    filter->setDataContainerArray(dca);
+
+    QVariant var;
+    bool propWasSet;
+
+    var.setValue(QString("Step"));
+    propWasSet = filter->setProperty("DataContainerPrefix", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    var.setValue(1);
+    propWasSet = filter->setProperty("Metric", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    var.setValue(0.5);
+    propWasSet = filter->setProperty("MetricThreshold", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    var.setValue(0);
+    propWasSet = filter->setProperty("MatchingMethod", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    var.setValue(false);
+    propWasSet = filter->setProperty("UseOrientations", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    //execute filter and get output arrays
+    filter->execute();
+    DREAM3D_REQUIRED(filter->getErrorCondition(), >= , 0);
+
+    for(size_t s = 0; s < numSteps; s++)
+    {
+      DataContainer::Pointer dc = dca->getDataContainer(QString("Step%1").arg(s));
+      IDataArray::Pointer iFeatureIds = dc->getAttributeMatrix(DREAM3D::Defaults::CellAttributeMatrixName)->getAttributeArray(DREAM3D::CellData::FeatureIds);
+      DataArray<int32_t>* pTrackedIds = DataArray<int32_t>::SafePointerDownCast(iFeatureIds.get());
+      DREAM3D_REQUIRE_VALID_POINTER(pTrackedIds)
+      int32_t* trackedIds = pTrackedIds->getPointer(0);
+      for(size_t i = 0; i < dims[0]; i++) {
+        DREAM3D_REQUIRE_EQUAL(trackedIds[i], trackedID[s][i])
+      }
+    }
+    DREAM3D_REQUIRE_EQUAL(dca->getDataContainer("Step2")->getAttributeMatrix(DREAM3D::Defaults::CellFeatureAttributeMatrixName)->getNumTuples(), 5)
+
+    //feature 2 of the second step has no match in the last step
+    IDataArray::Pointer iEnding = dca->getDataContainer("Step1")->getAttributeMatrix(DREAM3D::Defaults::CellFeatureAttributeMatrixName)->getAttributeArray("EndingFeatures");
+    DataArray<bool>* pEnding = DataArray<bool>::SafePointerDownCast(iEnding.get());
+    DREAM3D_REQUIRE_VALID_POINTER(pEnding)
+    DREAM3D_REQUIRE_EQUAL(pEnding->getValue(1), false)
+    DREAM3D_REQUIRE_EQUAL(pEnding->getValue(2), true)
+
+    AttributeMatrix::Pointer trackAm = dca->getDataContainer("FeatureTracks")->getAttributeMatrix("Tracks");
+    DREAM3D_REQUIRE_VALID_POINTER(trackAm.get())
+    DREAM3D_REQUIRE_EQUAL(trackAm->getNumTuples(), 5)
+
+    DataArray<int64_t>* pStepVolumes = DataArray<int64_t>::SafePointerDownCast(trackAm->getAttributeArray("StepVolumes").get());
+    DataArray<int32_t>* pFirstStep = DataArray<int32_t>::SafePointerDownCast(trackAm->getAttributeArray("FirstStep").get());
+    DataArray<int32_t>* pLastStep = DataArray<int32_t>::SafePointerDownCast(trackAm->getAttributeArray("LastStep").get());
+    DREAM3D_REQUIRE_VALID_POINTER(pStepVolumes)
+    DREAM3D_REQUIRE_VALID_POINTER(pFirstStep)
+    DREAM3D_REQUIRE_VALID_POINTER(pLastStep)
+    for(size_t i = 0; i < 5 * numSteps; i++) {
+      DREAM3D_REQUIRE_EQUAL(pStepVolumes->getValue(i), stepVolumes[i])
+    }
+    for(size_t i = 0; i < 5; i++) {
+      DREAM3D_REQUIRE_EQUAL(pFirstStep->getValue(i), firstStep[i])
+      DREAM3D_REQUIRE_EQUAL(pLastStep->getValue(i), lastStep[i])
+    }
+  }
+  else
+  {
+    QString ss = QObject::tr("TrackFeatureIdsTest Error creating filter '%1'. Filter was not created/executed. Please notify the developers.").arg(filtName);
+    DREAM3D_TEST_THROW_EXCEPTION(ss.toStdString())
+  }
+
+  return EXIT_SUCCESS;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void loadFilterPlugins()
+{
+  // Register all the filters including trying to load those from Plugins
+  FilterManager* fm = FilterManager::Instance();
+  SIMPLibPluginLoader::LoadPluginFilters(fm);
+
+  // Send progress messages from PipelineBuilder to this object for display
+  QMetaObjectUtilities::RegisterMetaTypes();
+}
+
+// -----------------------------------------------------------------------------
+//  Use test framework
+// -----------------------------------------------------------------------------
+int main(int argc, char** argv)
+{
+  // Instantiate the QCoreApplication that we need to get the current path and load plugins.
+  QCoreApplication app(argc, argv);
+  QCoreApplication::setOrganizationName("");
+  QCoreApplication::setOrganizationDomain("");
+  QCoreApplication::setApplicationName("TrackFeatureIdsTest");
+
+  int err = EXIT_SUCCESS;
+  DREAM3D_REGISTER_TEST( loadFilterPlugins() );
+  DREAM3D_REGISTER_TEST( TestFilterAvailability() );
+
+  DREAM3D_REGISTER_TEST( TrackFeatureIdsTest() )
+
+  PRINT_TEST_SUMMARY();
+  return err;
+}